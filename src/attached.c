@@ -0,0 +1,171 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#include "attached.h"
+
+#include "extensions.h"
+#include "geometry.h"
+#include "glstate.h"
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <assert.h>
+
+// Number of blocks whose matrices are worked out together when a mesh is
+// rebuilt.
+#define rebuild_chunk 64
+
+// Free everything held by the mesh, leaving it empty.
+void attached_mesh_clear(AttachedMesh * mesh)
+{
+    free(mesh->vertices);
+    if (mesh->buffer != 0) {
+        glDeleteBuffers(1, &mesh->buffer);
+    }
+    mesh->vertices = 0;
+    mesh->count = 0;
+    mesh->capacity = 0;
+    mesh->blocks = 0;
+    mesh->buffer = 0;
+    mesh->buffer_capacity = 0;
+    mesh->uploaded = 0;
+}
+
+// Bake a block into the mesh, rotated by the matrix of its orientation.
+static void add_block(AttachedMesh * mesh, const BlockStore * store,
+                      unsigned int index, const float matrix[16])
+{
+    assert(index >= store->ground && index < store->count);
+
+    if (mesh->count + GEOMETRY_CUBE_VERTICES > mesh->capacity) {
+        mesh->capacity = mesh->capacity ? mesh->capacity * 2
+                                        : GEOMETRY_CUBE_VERTICES * 64;
+        mesh->vertices = realloc(mesh->vertices,
+                                 mesh->capacity * sizeof(AttachedVertex));
+        assert(mesh->vertices != 0);
+    }
+
+    const float offset[3] = { store->x[index], store->y[index],
+                              store->z[index] };
+    const float size = store->scale[index];
+    GLubyte colour[4];
+    int i, j;
+    for (j = 0; j < 4; ++j) {
+        colour[j] = store->diffuse[index][j] * 255.f + .5f;
+    }
+
+    AttachedVertex * out = &mesh->vertices[mesh->count];
+    for (i = 0; i < GEOMETRY_CUBE_VERTICES; ++i, ++out) {
+        const float * in = geometry_cube_vertices[i];
+        float p[3];
+        for (j = 0; j < 3; ++j) {
+            p[j] = offset[j] + in[j] * size;
+        }
+        for (j = 0; j < 3; ++j) {
+            out->position[j] = matrix[j] * p[0] + matrix[4 + j] * p[1] +
+                               matrix[8 + j] * p[2];
+            out->normal[j] = matrix[j] * in[3] + matrix[4 + j] * in[4] +
+                             matrix[8 + j] * in[5];
+            out->colour[j] = colour[j];
+        }
+        out->colour[3] = colour[3];
+    }
+
+    mesh->count += GEOMETRY_CUBE_VERTICES;
+    ++mesh->blocks;
+}
+
+// Bake the attached block at the given index of the store into the mesh.
+// The block is placed with the same transform render_scene() used to apply
+// to each block in turn, less the scale of the whole calamari.
+void attached_mesh_add(AttachedMesh * mesh, const BlockStore * store,
+                       unsigned int index)
+{
+    float matrix[16];
+    quaternion_rotmatrix(&store->orientation[index], matrix);
+    add_block(mesh, store, index, matrix);
+}
+
+// Make sure the mesh holds every block attached in the store. Blocks are
+// added to the mesh as they are picked up, so the mesh can only be missing
+// blocks if some have been removed from the store, in which case it is
+// rebuilt from scratch.
+void attached_mesh_update(AttachedMesh * mesh, const BlockStore * store)
+{
+    if (mesh->blocks == store->count - store->ground) {
+        return;
+    }
+    mesh->count = 0;
+    mesh->blocks = 0;
+    mesh->uploaded = 0;
+
+    // Work out the matrices of the blocks a chunk at a time, so they can be
+    // done several at once.
+    float matrices[rebuild_chunk][16];
+    unsigned int i, j;
+    for (i = store->ground; i < store->count; i += rebuild_chunk) {
+        unsigned int n = store->count - i;
+        n = n < rebuild_chunk ? n : rebuild_chunk;
+        quaternion_rotmatrix_array(&store->orientation[i], matrices, n);
+        for (j = 0; j < n; ++j) {
+            add_block(mesh, store, i + j, matrices[j]);
+        }
+    }
+}
+
+// Copy any vertices added since the last upload into the buffer object,
+// growing it if required.
+static void attached_mesh_upload(AttachedMesh * mesh)
+{
+    if (mesh->buffer == 0) {
+        glGenBuffers(1, &mesh->buffer);
+    }
+    glstate_bind_array_buffer(mesh->buffer);
+    if (mesh->count > mesh->buffer_capacity) {
+        mesh->buffer_capacity = mesh->capacity;
+        glBufferData(GL_ARRAY_BUFFER,
+                     mesh->buffer_capacity * sizeof(AttachedVertex),
+                     NULL, GL_DYNAMIC_DRAW);
+        mesh->uploaded = 0;
+    }
+    glBufferSubData(GL_ARRAY_BUFFER, mesh->uploaded * sizeof(AttachedVertex),
+                    (mesh->count - mesh->uploaded) * sizeof(AttachedVertex),
+                    &mesh->vertices[mesh->uploaded]);
+    mesh->uploaded = mesh->count;
+}
+
+// Draw the whole mesh in one call. The current modelview should be the
+// calamari's orientation and scale.
+void attached_mesh_draw(AttachedMesh * mesh)
+{
+    if (mesh->count == 0) {
+        return;
+    }
+
+    const AttachedVertex * base = mesh->vertices;
+    if (geometry_buffers()) {
+        if (mesh->uploaded != mesh->count) {
+            attached_mesh_upload(mesh);
+        }
+        base = 0;
+    }
+
+    // The colour of each vertex is used as the material.
+    glColorMaterial(GL_FRONT, GL_AMBIENT_AND_DIFFUSE);
+    glstate_enable(GL_COLOR_MATERIAL);
+    glstate_bind_array_buffer(mesh->buffer);
+    glstate_enable_client(GL_NORMAL_ARRAY);
+    glstate_enable_client(GL_COLOR_ARRAY);
+    glstate_vertex_pointer(3, GL_FLOAT, sizeof(AttachedVertex),
+                           (const char *)base +
+                           offsetof(AttachedVertex, position));
+    glstate_normal_pointer(GL_FLOAT, sizeof(AttachedVertex),
+                           (const char *)base +
+                           offsetof(AttachedVertex, normal));
+    glstate_color_pointer(4, GL_UNSIGNED_BYTE, sizeof(AttachedVertex),
+                          (const char *)base +
+                          offsetof(AttachedVertex, colour));
+    glDrawArrays(GL_QUADS, 0, mesh->count);
+    glstate_disable(GL_COLOR_MATERIAL);
+}
@@ -0,0 +1,41 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#ifndef ATTACHED_H
+#define ATTACHED_H
+
+#include "blocks.h"
+
+#include <SDL_opengl.h>
+
+// Vertex of a block baked into the calamari, in the calamari's own
+// coordinates before it is scaled to the screen.
+typedef struct attached_vertex {
+    float position[3];
+    float normal[3];
+    GLubyte colour[4];
+} AttachedVertex;
+
+// All the blocks attached to the calamari from one store, baked into a
+// single batch of quads which is drawn under the calamari's orientation.
+// Blocks are appended as they are picked up, and only the new vertices
+// are uploaded.
+typedef struct attached_mesh {
+    AttachedVertex * vertices;
+    unsigned int count;
+    unsigned int capacity;
+    unsigned int blocks;
+
+    GLuint buffer;
+    unsigned int buffer_capacity;
+    unsigned int uploaded;
+} AttachedMesh;
+
+void attached_mesh_clear(AttachedMesh * mesh);
+void attached_mesh_add(AttachedMesh * mesh, const BlockStore * store,
+                       unsigned int index);
+void attached_mesh_update(AttachedMesh * mesh, const BlockStore * store);
+void attached_mesh_draw(AttachedMesh * mesh);
+
+#endif // ATTACHED_H
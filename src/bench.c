@@ -0,0 +1,575 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+// Microbenchmarks for the maths and simulation code, run by "make bench".
+// Each benchmark is timed over a number of samples, each long enough to
+// swamp the cost of reading the clock, and the time per operation reported
+// along with its spread. Results are written to stderr for reading, and
+// as tab separated values to a file for comparing runs.
+
+#ifndef M_PI
+#define M_PI 3.14159265f
+#endif
+
+#include "world.h"
+#include "chunk.h"
+#include "collide.h"
+#include "generate.h"
+#include "logger.h"
+#include "pick.h"
+#include "rng.h"
+#include "snapshot.h"
+#include "vector.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Number of inputs each maths benchmark cycles through. This is small
+// enough to stay in cache, so it is the arithmetic being measured.
+#define input_count 256
+
+static const int default_samples = 20;
+
+// Length of time each sample should take.
+static const double sample_time = 0.01;
+
+// Number of tiers in each world the collision benchmark is run against.
+static const int world_sizes[] = { 1, 2, 4, 8, 16 };
+#define world_size_count (sizeof(world_sizes) / sizeof(int))
+
+// Height the calamari is held at while testing collision, so every block
+// near it is tested without any being picked up or bounced off.
+static const float collide_height = 100.f;
+
+// Snapshot each world is saved to, to time loading it.
+static const char * const snapshot_filename = "bench-snapshot.tmp";
+
+// Number of blocks the collision kernels are timed against, and the
+// kernels to time, of both collision and quaternions.
+#define kernel_blocks 1024
+static const char * const kernel_names[] = { "scalar", "sse2", "avx" };
+#define kernel_name_count (sizeof(kernel_names) / sizeof(char *))
+
+static Quaternion quaternions[input_count];
+static float axes[input_count][3];
+static float angles[input_count];
+static float vectors[input_count][2];
+
+// Unit quaternions the batched benchmarks multiply and convert, copied
+// before the benchmarks above change the inputs, and the results of the
+// batched benchmarks. The results are never fed back in as inputs, as
+// repeated products would shrink towards denormals.
+static Quaternion batch_inputs[input_count];
+static Quaternion * batch_lhs;
+static Quaternion * batch_rhs;
+static Quaternion * batch_quaternions;
+static float (*batch_matrices)[16];
+
+// Stream the inputs are drawn from.
+static Rng rng;
+
+static CollideBatch kernel_batch;
+static CollideQuery kernel_query;
+
+// Written to by the benchmarks so the work they do is not optimised away.
+static volatile float sink;
+
+// Number of items processed by the last call to a benchmark, where that
+// differs from the number of operations.
+static unsigned long items;
+
+typedef void (*BenchFunc)(unsigned long ops);
+
+static double now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void init_inputs()
+{
+    rng_seed(&rng, 1, 0);
+    int i;
+    for (i = 0; i < input_count; ++i) {
+        quaternion_init(&quaternions[i]);
+        axes[i][0] = rng_uniform(&rng, -1.f, 1.f);
+        axes[i][1] = rng_uniform(&rng, -1.f, 1.f);
+        axes[i][2] = rng_uniform(&rng, 0.1f, 1.f);
+        quaternions[i] = quaternion_rotate(&quaternions[i], axes[i],
+                                           rng_uniform(&rng, -M_PI, M_PI));
+        vectors[i][0] = rng_uniform(&rng, -1.f, 1.f);
+        vectors[i][1] = rng_uniform(&rng, -1.f, 1.f);
+    }
+    for (i = 0; i < input_count; ++i) {
+        angles[i] = rng_uniform(&rng, -M_PI, M_PI);
+    }
+    memcpy(batch_inputs, quaternions, sizeof(batch_inputs));
+}
+
+static void bench_quaternion_rotate(unsigned long ops)
+{
+    unsigned long i;
+    for (i = 0; i < ops; ++i) {
+        Quaternion * q = &quaternions[i % input_count];
+        *q = quaternion_rotate(q, axes[i % input_count], 0.01f);
+    }
+    sink = quaternions[0].w;
+}
+
+static void bench_quaternion_rotmatrix(unsigned long ops)
+{
+    float matrix[16];
+    float total = 0;
+    unsigned long i;
+    for (i = 0; i < ops; ++i) {
+        quaternion_rotmatrix(&quaternions[i % input_count], matrix);
+        total += matrix[i % 16];
+    }
+    sink = total;
+}
+
+static void bench_quaternion_invert(unsigned long ops)
+{
+    unsigned long i;
+    for (i = 0; i < ops; ++i) {
+        quaternion_invert(&quaternions[i % input_count]);
+    }
+    sink = quaternions[0].vec[0];
+}
+
+// Each batched quaternion benchmark works through the whole array of
+// inputs per operation, with the kernel currently selected.
+static void bench_quaternion_mult_batch(unsigned long ops)
+{
+    unsigned long i;
+    for (i = 0; i < ops; ++i) {
+        quaternion_mult_batch(batch_lhs, batch_rhs, batch_quaternions,
+                              input_count);
+    }
+    items = ops * input_count;
+    sink = batch_quaternions[0].w;
+}
+
+// Rotations by unit quaternions keep the batch at unit length, so it can
+// be rotated in place.
+static void bench_quaternion_rotate_batch(unsigned long ops)
+{
+    unsigned long i;
+    for (i = 0; i < ops; ++i) {
+        quaternion_rotate_batch(batch_quaternions, axes, angles,
+                                input_count);
+    }
+    items = ops * input_count;
+    sink = batch_quaternions[0].w;
+}
+
+static void bench_quaternion_normalise_batch(unsigned long ops)
+{
+    unsigned long i;
+    for (i = 0; i < ops; ++i) {
+        quaternion_normalise_batch(batch_quaternions, input_count);
+    }
+    items = ops * input_count;
+    sink = batch_quaternions[0].w;
+}
+
+static void bench_quaternion_rotmatrix_batch(unsigned long ops)
+{
+    unsigned long i;
+    for (i = 0; i < ops; ++i) {
+        quaternion_rotmatrix_batch(batch_lhs, batch_matrices, input_count);
+    }
+    items = ops * input_count;
+    sink = batch_matrices[0][0];
+}
+
+static void bench_vector2_dot(unsigned long ops)
+{
+    float total = 0;
+    unsigned long i;
+    for (i = 0; i < ops; ++i) {
+        total += vector2_dot(vectors[i % input_count],
+                             vectors[(i + 1) % input_count]);
+    }
+    sink = total;
+}
+
+static void bench_rng_uniform(unsigned long ops)
+{
+    float total = 0;
+    unsigned long i;
+    for (i = 0; i < ops; ++i) {
+        total += rng_uniform(&rng, -1.f, 1.f);
+    }
+    sink = total;
+}
+
+// Generate one chunk of the smallest tier per operation, moving to a
+// different chunk each time.
+static void bench_generate_chunk(unsigned long ops)
+{
+    static GeneratedBlock blocks[(2 * grid_width + 3) * (2 * grid_height + 3)];
+    unsigned long i;
+    items = 0;
+    for (i = 0; i < ops; ++i) {
+        items += generate_chunk(blocks, 1.f, 0.05f, 0.5f,
+                                grid_width, grid_height,
+                                (int)(i % 7) - 3, (int)(i / 7 % 5) - 2,
+                                world_seed, 0);
+    }
+    sink = blocks[0].size;
+}
+
+// Test the calamari for collision at a different place in the world each
+// operation. The world is set up by bench_world().
+static void bench_collide(unsigned long ops)
+{
+    unsigned long start = blocks_tested;
+    float support = 0;
+    unsigned long i;
+    for (i = 0; i < ops; ++i) {
+        pos_x = ((i * 7) % 97) / 97.f * grid_width - grid_width / 2.f;
+        pos_y = ((i * 13) % 89) / 89.f * grid_height - grid_height / 2.f;
+        collide(&support);
+    }
+    items = blocks_tested - start;
+    sink = support;
+}
+
+// Cast a ray down at the ground from above and behind the calamari, as the
+// camera does, aimed at a different place in the world each operation.
+static void bench_pick(unsigned long ops)
+{
+    PickResult hit;
+    unsigned int blocks_hit = 0;
+    unsigned long i;
+    for (i = 0; i < ops; ++i) {
+        float x = ((i * 7) % 97) / 97.f * grid_width - grid_width / 2.f;
+        float y = ((i * 13) % 89) / 89.f * grid_height - grid_height / 2.f;
+        float start[3] = { x, y - 5.f, 10.f };
+        float end[3] = { x, y + 0.5f, -1.f };
+        if (pick_ray(start, end, &hit) && hit.tier >= 0) {
+            ++blocks_hit;
+        }
+    }
+    items = ops;
+    sink = blocks_hit;
+}
+
+// Load the world set up by bench_world() from the snapshot saved of it,
+// each operation. Loading only maps the file, so the blocks themselves
+// are not read in until they are used.
+static void bench_snapshot_load(unsigned long ops)
+{
+    unsigned long i;
+    int t;
+    items = 0;
+    for (i = 0; i < ops; ++i) {
+        if (!snapshot_load(snapshot_filename)) {
+            abort();
+        }
+        for (t = 0; t < tier_count; ++t) {
+            items += tiers[t].blocks.count;
+        }
+    }
+}
+
+// Scatter blocks around the calamari for the collision kernels, close
+// enough that a good number of them touch it.
+static void init_kernel_batch()
+{
+    static const float colour[4] = { 1.f, 1.f, 1.f, 1.f };
+    BlockStore store;
+    BlockHandle handles[kernel_blocks];
+    block_store_init(&store);
+    int i;
+    for (i = 0; i < kernel_blocks; ++i) {
+        float x = rng_uniform(&rng, -2.f, 2.f);
+        float y = rng_uniform(&rng, -2.f, 2.f);
+        float size = rng_uniform(&rng, 0.05f, 1.f);
+        handles[i] = block_store_add(&store, x, y, size, colour);
+    }
+    collide_batch_init(&kernel_batch);
+    collide_batch_gather(&kernel_batch, &store, handles, kernel_blocks);
+    block_store_clear(&store);
+
+    kernel_query.x = 0.f;
+    kernel_query.y = 0.f;
+    kernel_query.z = 0.2f;
+    kernel_query.radius = 0.5f;
+}
+
+// Test every block in the batch against the calamari once per operation,
+// with the kernel currently selected.
+static void bench_collide_kernel(unsigned long ops)
+{
+    unsigned int hits = 0;
+    unsigned long i;
+    for (i = 0; i < ops; ++i) {
+        hits += collide_batch_test(&kernel_batch, &kernel_query);
+    }
+    items = ops * kernel_blocks;
+    sink = hits;
+}
+
+// Build a world of the given number of tiers, each covering the same
+// range of block sizes, so larger worlds are denser rather than wider.
+static void bench_world(int size)
+{
+    world_clear();
+    int t;
+    for (t = 0; t < size; ++t) {
+        level(1);
+    }
+    chunk_stream_fill();
+    pos_z = collide_height;
+}
+
+// Run one benchmark, doubling the operations per sample until a sample
+// takes long enough to time, then report the mean, standard deviation
+// and minimum time per operation over the given number of samples.
+static void bench_run(const char * name, BenchFunc func, int samples,
+                      FILE * out)
+{
+    unsigned long ops = 1;
+    double elapsed;
+    for (;;) {
+        items = 0;
+        double start = now();
+        func(ops);
+        elapsed = now() - start;
+        if (elapsed >= sample_time) {
+            break;
+        }
+        ops *= 2;
+    }
+
+    double sum = 0, sum_squares = 0, least = elapsed / ops * 1e9;
+    unsigned long total_items = 0;
+    int s;
+    for (s = 0; s < samples; ++s) {
+        items = ops;
+        double start = now();
+        func(ops);
+        double ns = (now() - start) / ops * 1e9;
+        total_items += items;
+        sum += ns;
+        sum_squares += ns * ns;
+        least = fmin(least, ns);
+    }
+    double mean = sum / samples;
+    double stddev = sqrt(fmax(sum_squares / samples - mean * mean, 0.));
+    double ops_per_second = 1e9 / mean;
+    double items_per_second = ops_per_second * total_items /
+                              ((double)ops * samples);
+
+    fprintf(stderr, "%-28s %12.2f ns/op %8.2f%% %14.0f ops/s %14.0f items/s\n",
+            name, mean, mean > 0 ? stddev / mean * 100. : 0.,
+            ops_per_second, items_per_second);
+    if (out != NULL) {
+        fprintf(out, "%s\t%lu\t%d\t%.3f\t%.3f\t%.3f\t%.0f\t%.0f\n",
+                name, ops, samples, mean, stddev, least, ops_per_second,
+                items_per_second);
+    }
+}
+
+// Time each collision kernel the processor supports, after checking it
+// finds exactly the same hits as the scalar kernel.
+static void bench_collide_kernels(int samples, FILE * out)
+{
+    const char * best = collide_kernel_name();
+    init_kernel_batch();
+
+    collide_kernel_select("scalar");
+    unsigned int expected = collide_batch_test(&kernel_batch, &kernel_query);
+    unsigned int * hits = malloc(expected * sizeof(unsigned int));
+    unsigned char * flags = malloc(expected);
+    memcpy(hits, kernel_batch.hits, expected * sizeof(unsigned int));
+    memcpy(flags, kernel_batch.flags, expected);
+
+    unsigned int k;
+    for (k = 0; k < kernel_name_count; ++k) {
+        if (!collide_kernel_select(kernel_names[k])) {
+            continue;
+        }
+        if (collide_batch_test(&kernel_batch, &kernel_query) != expected ||
+            memcmp(hits, kernel_batch.hits,
+                   expected * sizeof(unsigned int)) != 0 ||
+            memcmp(flags, kernel_batch.flags, expected) != 0) {
+            fprintf(stderr, "Kernel %s does not match the scalar kernel\n",
+                    kernel_names[k]);
+        }
+        char name[64];
+        snprintf(name, sizeof(name), "collide_kernel/%s", kernel_names[k]);
+        bench_run(name, bench_collide_kernel, samples, out);
+    }
+
+    free(hits);
+    free(flags);
+    collide_batch_clear(&kernel_batch);
+    collide_kernel_select(best);
+}
+
+// Return true if every kernel gives the same products, rotations, unit
+// quaternions and matrices as the scalar functions. They are meant to be exact, so any
+// difference at all is reported.
+static int check_quaternion_kernel()
+{
+    static Quaternion products[input_count], units[input_count];
+    static Quaternion rotated[input_count];
+    static float matrices[input_count][16];
+    static Quaternion expected_products[input_count];
+    static Quaternion expected_rotated[input_count];
+    static Quaternion expected_units[input_count];
+    static float expected_matrices[input_count][16];
+    int i;
+    for (i = 0; i < input_count; ++i) {
+        expected_products[i] = quaternion_mult(&quaternions[i],
+                                               &quaternions[(i + 1) %
+                                                            input_count]);
+        expected_units[i] = expected_products[i];
+        quaternion_normalise(&expected_units[i]);
+        quaternion_rotmatrix(&expected_units[i], expected_matrices[i]);
+        expected_rotated[i] = quaternion_rotate(&quaternions[i], axes[i],
+                                                angles[i]);
+        products[i] = quaternions[(i + 1) % input_count];
+    }
+    quaternion_mult_batch(quaternions, products, products, input_count);
+    memcpy(rotated, quaternions, sizeof(rotated));
+    quaternion_rotate_batch(rotated, axes, angles, input_count);
+    memcpy(units, products, sizeof(units));
+    quaternion_normalise_batch(units, input_count);
+    quaternion_rotmatrix_batch(units, matrices, input_count);
+    return memcmp(products, expected_products, sizeof(products)) == 0 &&
+           memcmp(rotated, expected_rotated, sizeof(rotated)) == 0 &&
+           memcmp(units, expected_units, sizeof(units)) == 0 &&
+           memcmp(matrices, expected_matrices, sizeof(matrices)) == 0;
+}
+
+static void bench_quaternion_kernels(int samples, FILE * out)
+{
+    const char * best = quaternion_kernel_name();
+    batch_lhs = quaternion_array_alloc(input_count);
+    batch_rhs = quaternion_array_alloc(input_count);
+    batch_quaternions = quaternion_array_alloc(input_count);
+    batch_matrices = malloc(input_count * sizeof(float[16]));
+    int i;
+    for (i = 0; i < input_count; ++i) {
+        batch_lhs[i] = batch_inputs[i];
+        batch_rhs[i] = batch_inputs[(i + 1) % input_count];
+    }
+
+    unsigned int k;
+    for (k = 0; k < kernel_name_count; ++k) {
+        if (!quaternion_kernel_select(kernel_names[k])) {
+            continue;
+        }
+        if (!check_quaternion_kernel()) {
+            fprintf(stderr, "Quaternion kernel %s does not match the "
+                    "scalar functions\n", kernel_names[k]);
+        }
+        memcpy(batch_quaternions, batch_inputs, sizeof(batch_inputs));
+        char name[64];
+        snprintf(name, sizeof(name), "quaternion_mult/%s", kernel_names[k]);
+        bench_run(name, bench_quaternion_mult_batch, samples, out);
+        snprintf(name, sizeof(name), "quaternion_rotate/%s",
+                 kernel_names[k]);
+        bench_run(name, bench_quaternion_rotate_batch, samples, out);
+        snprintf(name, sizeof(name), "quaternion_normalise/%s",
+                 kernel_names[k]);
+        bench_run(name, bench_quaternion_normalise_batch, samples, out);
+        snprintf(name, sizeof(name), "quaternion_rotmatrix/%s",
+                 kernel_names[k]);
+        bench_run(name, bench_quaternion_rotmatrix_batch, samples, out);
+    }
+
+    free(batch_lhs);
+    free(batch_rhs);
+    free(batch_quaternions);
+    free(batch_matrices);
+    quaternion_kernel_select(best);
+}
+
+static void usage(const char * prog)
+{
+    fprintf(stderr, "usage: %s [-n samples] [results_file]\n", prog);
+}
+
+int main(int argc, char ** argv)
+{
+    int samples = default_samples;
+    const char * filename = NULL;
+    int i;
+
+    for (i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            samples = atoi(argv[++i]);
+        } else if (argv[i][0] != '-' && filename == NULL) {
+            filename = argv[i];
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (samples <= 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    FILE * out = NULL;
+    if (filename != NULL) {
+        out = fopen(filename, "w");
+        if (out == NULL) {
+            perror(filename);
+            return 1;
+        }
+        fprintf(out, "name\tops_per_sample\tsamples\tmean_ns\tstddev_ns"
+                     "\tmin_ns\tops_per_s\titems_per_s\n");
+    }
+
+    // Log messages from chunk_stream_fill() and collide() are written out
+    // in the background, as they are in the game.
+    logger_init();
+
+    init_inputs();
+    bench_run("quaternion_rotate", bench_quaternion_rotate, samples, out);
+    bench_run("quaternion_rotmatrix", bench_quaternion_rotmatrix, samples,
+              out);
+    bench_run("quaternion_invert", bench_quaternion_invert, samples, out);
+    bench_quaternion_kernels(samples, out);
+    bench_run("vector2_dot", bench_vector2_dot, samples, out);
+    bench_run("rng_uniform", bench_rng_uniform, samples, out);
+
+    bench_run("generate_chunk", bench_generate_chunk, samples, out);
+
+    bench_collide_kernels(samples, out);
+
+    unsigned int w;
+    for (w = 0; w < world_size_count; ++w) {
+        char name[64];
+        snprintf(name, sizeof(name), "collide/%d_tiers", world_sizes[w]);
+        bench_world(world_sizes[w]);
+        bench_run(name, bench_collide, samples, out);
+        snprintf(name, sizeof(name), "pick/%d_tiers", world_sizes[w]);
+        bench_run(name, bench_pick, samples, out);
+        if (!snapshot_save(snapshot_filename)) {
+            return 1;
+        }
+        snprintf(name, sizeof(name), "snapshot_load/%d_tiers",
+                 world_sizes[w]);
+        bench_run(name, bench_snapshot_load, samples, out);
+    }
+    remove(snapshot_filename);
+    world_clear();
+    logger_shutdown();
+
+    if (out != NULL) {
+        fclose(out);
+    }
+    return 0;
+}
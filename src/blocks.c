@@ -0,0 +1,291 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#include "blocks.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+static const unsigned int initial_capacity = 1024;
+static const unsigned int minimum_capacity = 64;
+
+// Number of bytes used by each block across all the packed arrays.
+static const size_t block_bytes = 4 * sizeof(float) + sizeof(unsigned char) +
+                                  sizeof(float[4]) + sizeof(Quaternion) +
+                                  sizeof(BlockHandle);
+
+void block_store_init(BlockStore * store)
+{
+    memset(store, 0, sizeof(BlockStore));
+    store->free_slot = BLOCK_HANDLE_NONE;
+}
+
+// Return a copy of an array which points into a mapped snapshot.
+static void * copy_array(const void * data, size_t bytes)
+{
+    if (bytes == 0) {
+        return 0;
+    }
+    void * copy = malloc(bytes);
+    assert(copy != 0);
+    memcpy(copy, data, bytes);
+    return copy;
+}
+
+// Make sure the store owns its arrays, so they can be resized or freed.
+static void own(BlockStore * store)
+{
+    if (!store->mapped) {
+        return;
+    }
+    const unsigned int capacity = store->capacity;
+    store->x = copy_array(store->x, capacity * sizeof(float));
+    store->y = copy_array(store->y, capacity * sizeof(float));
+    store->z = copy_array(store->z, capacity * sizeof(float));
+    store->scale = copy_array(store->scale, capacity * sizeof(float));
+    store->present = copy_array(store->present, capacity);
+    store->diffuse = copy_array(store->diffuse,
+                                capacity * sizeof(float[4]));
+    store->orientation = copy_array(store->orientation,
+                                    capacity * sizeof(Quaternion));
+    store->handle = copy_array(store->handle,
+                               capacity * sizeof(BlockHandle));
+    store->slot_index = copy_array(store->slot_index,
+                                   store->slot_capacity *
+                                   sizeof(unsigned int));
+    store->slot_generation = copy_array(store->slot_generation,
+                                        store->slot_capacity);
+    store->mapped = 0;
+}
+
+void block_store_clear(BlockStore * store)
+{
+    if (store->mapped) {
+        block_store_init(store);
+        return;
+    }
+    free(store->x);
+    free(store->y);
+    free(store->z);
+    free(store->scale);
+    free(store->present);
+    free(store->diffuse);
+    free(store->orientation);
+    free(store->handle);
+    free(store->slot_index);
+    free(store->slot_generation);
+    block_store_init(store);
+}
+
+static void resize(BlockStore * store, unsigned int capacity)
+{
+    assert(capacity >= store->count && capacity > 0);
+    own(store);
+    store->x = realloc(store->x, capacity * sizeof(float));
+    store->y = realloc(store->y, capacity * sizeof(float));
+    store->z = realloc(store->z, capacity * sizeof(float));
+    store->scale = realloc(store->scale, capacity * sizeof(float));
+    store->present = realloc(store->present, capacity);
+    store->diffuse = realloc(store->diffuse, capacity * sizeof(float[4]));
+    store->orientation = realloc(store->orientation,
+                                 capacity * sizeof(Quaternion));
+    store->handle = realloc(store->handle, capacity * sizeof(BlockHandle));
+    assert(store->x != 0 && store->y != 0 && store->z != 0 &&
+           store->scale != 0 && store->present != 0 &&
+           store->diffuse != 0 && store->orientation != 0 &&
+           store->handle != 0);
+    store->capacity = capacity;
+}
+
+void block_store_reserve(BlockStore * store, unsigned int capacity)
+{
+    if (capacity > store->capacity) {
+        resize(store, capacity);
+    }
+}
+
+// Give back the unused part of the packed arrays if less than half of it
+// is in use, and return the number of bytes reclaimed. The slot table is
+// kept, as stale handles must still be recognised.
+size_t block_store_shrink(BlockStore * store)
+{
+    unsigned int capacity = store->count;
+    if (capacity < minimum_capacity) {
+        capacity = minimum_capacity;
+    }
+    if (capacity * 2 > store->capacity) {
+        return 0;
+    }
+    size_t reclaimed = (store->capacity - capacity) * block_bytes;
+    resize(store, capacity);
+    return reclaimed;
+}
+
+size_t block_store_bytes(const BlockStore * store)
+{
+    return store->capacity * block_bytes +
+           store->slot_capacity * (sizeof(unsigned int) +
+                                   sizeof(unsigned char));
+}
+
+static unsigned int alloc_slot(BlockStore * store)
+{
+    unsigned int slot = store->free_slot;
+    if (slot != BLOCK_HANDLE_NONE) {
+        store->free_slot = store->slot_index[slot];
+        return slot;
+    }
+    if (store->slots == store->slot_capacity) {
+        unsigned int capacity = store->slot_capacity * 2;
+        if (capacity < initial_capacity) {
+            capacity = initial_capacity;
+        }
+        assert(capacity <= BLOCK_SLOT_MASK + 1);
+        own(store);
+        store->slot_index = realloc(store->slot_index,
+                                    capacity * sizeof(unsigned int));
+        store->slot_generation = realloc(store->slot_generation, capacity);
+        assert(store->slot_index != 0 && store->slot_generation != 0);
+        memset(store->slot_generation + store->slot_capacity, 0,
+               capacity - store->slot_capacity);
+        store->slot_capacity = capacity;
+    }
+    return store->slots++;
+}
+
+static void free_slot(BlockStore * store, BlockHandle handle)
+{
+    unsigned int slot = handle & BLOCK_SLOT_MASK;
+    ++store->slot_generation[slot];
+    // The last slot at the last generation would give BLOCK_HANDLE_NONE.
+    if (slot == BLOCK_SLOT_MASK && store->slot_generation[slot] == 0xff) {
+        store->slot_generation[slot] = 0;
+    }
+    store->slot_index[slot] = store->free_slot;
+    store->free_slot = slot;
+}
+
+static void mark_dirty(BlockStore * store, unsigned int index)
+{
+    if (store->dirty_count < BLOCK_DIRTY_MAX) {
+        store->dirty[store->dirty_count++] = index;
+    } else {
+        store->dirty_count = BLOCK_DIRTY_MAX + 1;
+    }
+}
+
+// Copy the block at packed index from over the block at packed index to,
+// keeping the slot table pointing at the right place.
+static void move_block(BlockStore * store, unsigned int from, unsigned int to)
+{
+    if (from == to) {
+        return;
+    }
+    store->x[to] = store->x[from];
+    store->y[to] = store->y[from];
+    store->z[to] = store->z[from];
+    store->scale[to] = store->scale[from];
+    store->present[to] = store->present[from];
+    memcpy(store->diffuse[to], store->diffuse[from], sizeof(float[4]));
+    store->orientation[to] = store->orientation[from];
+    store->handle[to] = store->handle[from];
+    store->slot_index[store->handle[to] & BLOCK_SLOT_MASK] = to;
+}
+
+BlockHandle block_store_add(BlockStore * store, float x, float y,
+                            float scale, const float diffuse[4])
+{
+    if (store->count == store->capacity) {
+        unsigned int capacity = store->capacity * 2;
+        block_store_reserve(store, capacity < initial_capacity ?
+                                   initial_capacity : capacity);
+    }
+
+    // Make room at the end of the ground range by moving the first
+    // attached block to the end of the store.
+    unsigned int index = store->ground;
+    move_block(store, index, store->count);
+
+    unsigned int slot = alloc_slot(store);
+    BlockHandle handle = slot | ((BlockHandle)store->slot_generation[slot]
+                                 << BLOCK_SLOT_BITS);
+
+    store->x[index] = x;
+    store->y[index] = y;
+    store->z[index] = 0;
+    store->scale[index] = scale;
+    store->present[index] = 0;
+    memcpy(store->diffuse[index], diffuse, sizeof(float[4]));
+    quaternion_init(&store->orientation[index]);
+    store->handle[index] = handle;
+    store->slot_index[slot] = index;
+    mark_dirty(store, index);
+
+    ++store->ground;
+    ++store->count;
+
+    return handle;
+}
+
+// Return the packed index of the block with the given handle, or -1 if
+// the block no longer exists.
+int block_store_index(const BlockStore * store, BlockHandle handle)
+{
+    unsigned int slot = handle & BLOCK_SLOT_MASK;
+    if (handle == BLOCK_HANDLE_NONE || slot >= store->slots ||
+        store->slot_generation[slot] != (handle >> BLOCK_SLOT_BITS)) {
+        return -1;
+    }
+    return store->slot_index[slot];
+}
+
+// Move a ground block into the attached range, and return its new packed
+// index. The last ground block takes its place, so callers walking the
+// ground range must look at the same index again.
+unsigned int block_store_attach(BlockStore * store, unsigned int index)
+{
+    assert(index < store->ground);
+
+    unsigned int last = store->ground - 1;
+    if (index != last) {
+        // Park the block being attached in the spare slot past the end.
+        if (store->count == store->capacity) {
+            block_store_reserve(store, store->capacity * 2);
+        }
+        move_block(store, index, store->count);
+        move_block(store, last, index);
+        move_block(store, store->count, last);
+        mark_dirty(store, index);
+    }
+    store->present[last] = 1;
+    --store->ground;
+    return last;
+}
+
+void block_store_remove(BlockStore * store, unsigned int index)
+{
+    assert(index < store->count);
+
+    free_slot(store, store->handle[index]);
+
+    if (index < store->ground) {
+        // Fill the hole with the last ground block, and fill its place
+        // with the last attached block.
+        --store->ground;
+        if (index != store->ground) {
+            move_block(store, store->ground, index);
+            mark_dirty(store, index);
+        }
+        index = store->ground;
+    }
+    --store->count;
+    move_block(store, store->count, index);
+}
+
+// Forget the record of which ground blocks have changed.
+void block_store_clean(BlockStore * store)
+{
+    store->dirty_count = 0;
+}
@@ -0,0 +1,82 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#ifndef BLOCKS_H
+#define BLOCKS_H
+
+#include "quaternion.h"
+
+#include <stddef.h>
+
+// Handle used to refer to a block from outside the store. A handle stays
+// valid while the block moves around inside the packed arrays, and goes
+// stale once the block is removed. The low bits index the slot table, and
+// the high bits hold a generation count so stale handles can be detected.
+typedef unsigned int BlockHandle;
+
+#define BLOCK_HANDLE_NONE 0xffffffffu
+#define BLOCK_SLOT_BITS 24
+#define BLOCK_SLOT_MASK ((1u << BLOCK_SLOT_BITS) - 1)
+
+// Number of changed ground blocks recorded individually before the store
+// gives up and marks them all as changed.
+#define BLOCK_DIRTY_MAX 64
+
+// Contiguous store of blocks, kept as a structure of arrays. Ground blocks
+// are packed into [0, ground) and blocks attached to the calamari are packed
+// into [ground, count), so the collision scan only ever walks the front of
+// the hot arrays.
+typedef struct block_store {
+    // Hot data, read by the collision scan every frame.
+    float * x;
+    float * y;
+    float * z;
+    float * scale;
+    unsigned char * present;
+
+    // Cold data, only touched when rendering or picking up a block.
+    float (* diffuse)[4];
+    Quaternion * orientation;
+
+    // Handle of the block stored at each packed index.
+    BlockHandle * handle;
+
+    unsigned int ground;
+    unsigned int count;
+    unsigned int capacity;
+
+    // Slot table mapping handles to packed indices. Free slots are chained
+    // together through slot_index.
+    unsigned int * slot_index;
+    unsigned char * slot_generation;
+    unsigned int slots;
+    unsigned int slot_capacity;
+    unsigned int free_slot;
+
+    // Packed indices of ground blocks which have changed since
+    // block_store_clean() was last called, so copies of the data kept
+    // elsewhere can be refreshed. If more than BLOCK_DIRTY_MAX change,
+    // dirty_count is set past the end to mark every block as changed.
+    unsigned int dirty[BLOCK_DIRTY_MAX];
+    unsigned int dirty_count;
+
+    // True if the arrays point into a snapshot mapped into memory, rather
+    // than being allocated by the store. They are copied into memory of
+    // the store's own before they are resized or freed.
+    int mapped;
+} BlockStore;
+
+void block_store_init(BlockStore * store);
+void block_store_clear(BlockStore * store);
+void block_store_reserve(BlockStore * store, unsigned int capacity);
+size_t block_store_shrink(BlockStore * store);
+size_t block_store_bytes(const BlockStore * store);
+BlockHandle block_store_add(BlockStore * store, float x, float y,
+                            float scale, const float diffuse[4]);
+int block_store_index(const BlockStore * store, BlockHandle handle);
+unsigned int block_store_attach(BlockStore * store, unsigned int index);
+void block_store_remove(BlockStore * store, unsigned int index);
+void block_store_clean(BlockStore * store);
+
+#endif // BLOCKS_H
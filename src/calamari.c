@@ -14,8 +14,22 @@
 #define _GNU_SOURCE
 #endif
 
-#include "vector.h"
-#include "quaternion.h"
+#include "world.h"
+#include "chunk.h"
+#include "jobs.h"
+#include "instancing.h"
+#include "geometry.h"
+#include "attached.h"
+#include "cull.h"
+#include "matrix.h"
+#include "pick.h"
+#include "text.h"
+#include "glstate.h"
+#include "logger.h"
+#include "profile.h"
+#include "replay.h"
+#include "snapshot.h"
+#include "extensions.h"
 
 #include <SDL.h>
 #include <SDL_opengl.h>
@@ -23,70 +37,49 @@
 #include <GL/gl.h>
 #include <GL/glu.h>
 
-#include "font.h"
-
 #include <math.h>
-#include <limits.h>
 #include <string.h>
 #include <stdlib.h>
+#include <stdio.h>
 
 #include <assert.h>
 
-typedef int bool;
-#define false 0
-#define true 1
-
 // Constants
 
 static const int screen_width = 600;
 static const int screen_height = 400;
 
-// Number of squares in the grid. The number of points is this number +1.
-#define grid_width 12
-#define grid_height 12
-
 // Number of milliseconds between steps in the game model.
 static const int step_time = 1000;
 
-// Types
-
-typedef struct block {
-    float x, y, z;
-    float scale;
-    float diffuse[4];
-    int present;
-    Quaternion orientation;
-    struct block * next;
-} Block;
-
-Block * blocks = 0;
-
-// Variables that store the game state
-
-static float scale = 0.1f;
-static int next_level = 1;
+// Default number of times per second update() is called, and of frames
+// drawn per second. A render rate of zero draws frames as fast as the
+// swap allows. Both can be set on the command line.
+static const int default_simulation_rate = 120;
+static const int default_render_rate = 0;
 
-static float pos_x = 0;
-static float pos_y = -2;
-static float pos_z = 0;
+// Most simulation steps run for one frame. If the simulation falls further
+// behind than this, the extra time is dropped rather than trying to catch
+// up, which would only make the next frame slower still.
+static const int max_frame_steps = 8;
 
-static float angle = 0;
+// Ambient light falling on the blocks, which is the default global ambient
+// of 0.2 plus the ambient colour of GL_LIGHT1.
+static const float scene_ambient = 0.6f;
 
-static Quaternion orientation = { {0, 0, 0}, 1 };
-GLUquadric * sphere_quadric;
+// True if ground blocks are drawn using instancing, and the batch holding
+// the ground blocks of each tier.
+static bool instancing = false;
+static InstanceBatch ground_batches[max_tiers];
 
-static float velocity[3] = { 0, 0, 0 };
-static float ang_vel = 0;
+// Blocks attached to the calamari from each tier, baked into a mesh as they
+// are picked up.
+static AttachedMesh attached_meshes[max_tiers];
 
-static bool key_lf = false;
-static bool key_lb = false;
-static bool key_rf = false;
-static bool key_rb = false;
-static bool key_flip = false;
-
-static const float max_velocity = 3.f;
-static const float max_accel = 1.f;
-static const float max_decel = 3.f;
+// Ground blocks found to be in view in the tier being drawn, and counts of
+// the blocks culled and drawn this frame.
+static VisibleBlocks visible_blocks;
+static CullStats cull_stats;
 
 // Structure to hold the properties of a single square on the grid.
 // If you want to add more information to the grid, add new members here.
@@ -102,41 +95,36 @@ BlockProperties properties[grid_width][grid_height];
 // Set this to true if its done.
 static bool program_finished = false;
 
-// Calculated frames per second to display. Very useful feedback when
-// debugging graphics performance problems.
-int average_frames_per_second;
-
-// Texture handles for the texture used to handle printing text on the
-// screen.
-GLuint textTexture;
-GLuint textBase;
-
-static inline float square(float f)
-{
-    return f * f;
-}
-
-static inline float cube(float f)
-{
-    return f * f * f;
-}
+// Simulation and frame rates in use.
+static int simulation_rate;
+static int render_rate;
 
-static inline float uniform(float min, float max)
-{
-    return ((float)rand() / RAND_MAX) * (max - min) + min;
-}
+// True if the steps and frames are being replayed from an input trace
+// rather than driven by the keyboard and clock, and if so whether to run
+// them as fast as possible rather than at the speed they were recorded.
+static bool replaying = false;
+static bool replay_fast = false;
 
-static float logarithmic(float min, float max)
-{
-    assert(min > 0.f);
-    assert(max > 0.f);
+// Position and orientation of the calamari to draw, between the last two
+// simulation steps.
+static ViewState view;
 
-    float res1 = uniform(log10(min), log10(max));
-    float res2 = exp10f(res1);
+// Calculated frames per second to display. Very useful feedback when
+// debugging graphics performance problems.
+int average_frames_per_second;
 
-    printf("%f %f %f %f %f %f\n", min, max, log10(min), log10(max), res1, res2);
-    return res2;
-}
+// Lines of text drawn over the scene, and the values each was last
+// formatted from, so a line is only formatted again when they change.
+enum overlay_line {
+    OVERLAY_FPS,
+    OVERLAY_BLOCKS,
+    OVERLAY_GLSTATE,
+    OVERLAY_PROFILE,
+    OVERLAY_SIZE = OVERLAY_PROFILE + PROFILE_PHASES,
+    OVERLAY_LINES
+};
+static TextLine overlay[OVERLAY_LINES];
+static float overlay_values[OVERLAY_LINES][2];
 
 // Initialise the graphics subsystem. This is pretty much boiler plate
 // code with very little to worry about.
@@ -179,8 +167,12 @@ SDL_Window * init_graphics()
     // Setup the viewport transform
     glViewport(0, 0, screen_width, screen_height);
 
+    // Everything below changes state through the state cache, so start it
+    // off knowing the state of a new context.
+    glstate_init();
+
     // Enable vertex arrays
-    glEnableClientState(GL_VERTEX_ARRAY);
+    glstate_enable_client(GL_VERTEX_ARRAY);
     // Texture coordinate arrays well need to be enabled _ONLY_ when using
     // texture coordinates from an array, and disabled afterwards.
     // glEnableClientState(GL_TEXTURE_COORD_ARRAY);
@@ -194,46 +186,24 @@ SDL_Window * init_graphics()
     glLightfv(GL_LIGHT1, GL_AMBIENT, ambient_colour);
     glLightfv(GL_LIGHT1, GL_DIFFUSE, diffuse_colour);
 
-    glEnable(GL_LIGHT1);
-    glEnable(GL_LIGHTING);
-    glEnable(GL_NORMALIZE);
-
-    // Initialise the texture used for rendering text
-    glGenTextures(1, &textTexture);
-    glBindTexture(GL_TEXTURE_2D, textTexture);
-    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-    glTexImage2D(GL_TEXTURE_2D, 0, texture_font_internalFormat,
-                 texture_font_width, texture_font_height, 0,
-                 texture_font_format, GL_UNSIGNED_BYTE, texture_font_pixels);
-    if (glGetError() != 0) {
-        return false;
-    }
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    textBase = glGenLists(256);
-    float vertices[] = { 0, 0, 16, 0, 16, 16, 0, 16 };
-    glVertexPointer(2, GL_FLOAT, 0, vertices);
-    int loop;
-    for(loop=0; loop<256; loop++) {
-        float cx=(float)(loop%16)/16.0f;      // X Position Of Current Character
-        float cy=(float)(loop/16)/16.0f;      // Y Position Of Current Character
-
-        float texcoords[] = { cx, 1-cy-0.0625f,
-                              cx+0.0625f, 1-cy-0.0625f,
-                              cx+0.0625f, 1-cy,
-                              cx, 1-cy };
-
-        glNewList(textBase+loop,GL_COMPILE);   // Start Building A List
-
-        glTexCoordPointer(2, GL_FLOAT, 0, texcoords);
-        glDrawArrays(GL_QUADS, 0, 4);
-
-        glTranslated(10,0,0);                  // Move To The Right Of The Character
-        glEndList();                           // Done Building The Display List
+    glstate_enable(GL_LIGHT1);
+    glstate_enable(GL_LIGHTING);
+    glstate_enable(GL_NORMALIZE);
+
+    // Build the static meshes, in buffer objects if we have them.
+    int extensions = extensions_init();
+    geometry_init(extensions, grid_width, grid_height);
+
+    // Draw ground blocks in batches if the hardware can, and one at a
+    // time if not.
+    instancing = extensions && instancing_init();
+    if (!instancing) {
+        log_warning(LOG_GRAPHICS, "Instanced rendering not available");
     }
-    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
 
-    sphere_quadric = gluNewQuadric();
+    // Stream text through a buffer if we can. The font is loaded the
+    // first time any text is drawn.
+    text_init(extensions);
 
     return screen;
 }
@@ -249,187 +219,24 @@ void clear()
     }
 }
 
-// Print a text string on the screen at the current position.
-void gl_print(const char * str)
-{
-    glPushMatrix();
-    glBlendFunc(GL_SRC_ALPHA,GL_ONE_MINUS_SRC_ALPHA);
-    glBindTexture(GL_TEXTURE_2D, textTexture);
-    glEnable(GL_TEXTURE_2D);
-    glEnable(GL_BLEND);
-    glListBase(textBase-32);
-    glCallLists(strlen(str),GL_BYTE,str);
-    glDisable(GL_BLEND);
-    glDisable(GL_TEXTURE_2D);
-    glBlendFunc(GL_SRC_ALPHA,GL_ONE_MINUS_SRC_ALPHA);
-    glPopMatrix();
-}
-
-void level(float factor)
-{
-    Block ** p = &blocks;
-    for (; *p != 0; p = &((*p)->next));
-
-    int i, j;
-    for (i = -grid_width; i < grid_width; ++i) {
-        for (j = -grid_height; j < grid_height; ++j) {
-            Block * b = calloc(1, sizeof(Block));
-            b->x = (i / 2.f + uniform(-0.5f, 0.5f)) * factor;
-            b->y = (j / 2.f + uniform(-0.5f, 0.5f)) * factor;
-            b->z = 0;
-            b->diffuse[0] = uniform(0.f, 1.f);
-            b->diffuse[1] = uniform(0.f, 1.f);
-            b->diffuse[2] = uniform(0.f, 1.f);
-            b->diffuse[3] = 1.f;
-            b->scale = logarithmic(0.05, 0.5) * factor;
-            b->present = 0;
-            b->next = NULL;
-            if ((b->x + b->scale) > -factor / 2 && b->x < factor / 2 &&
-                (b->y + b->scale) > -factor / 2 && b->y < factor / 2) {
-                free(b);
-                continue;
-            }
-            *p = b;
-            p = &b->next;
-        }
-    }
-}
-
-void trim()
-{
-    float min_size = scale / 100.f;
-    Block * b = blocks;
-    while (b->next != 0 && b->scale < min_size) {
-        Block * current = b;
-        printf("Deleting %f\n", b->scale);
-        b = b->next;
-        free(current);
-    }
-    blocks = b;
-}
-
-void setup()
-{
-    // Clear the block store
-    clear();
-
-    quaternion_init(&orientation);
-
-    level(1);
-    level(10);
-}
-
-void draw_unit_cube()
-{
-    static const float front_vertices[] = {
-        0.f, 0.f, 1.f,
-        1.f, 0.f, 1.f,
-        1.f, 1.f, 1.f,
-        0.f, 1.f, 1.f,
-    };
-    glVertexPointer(3, GL_FLOAT, 0, front_vertices);
-    glNormal3f(0,0,1);
-    glDrawArrays(GL_QUADS, 0, 4);
-
-    static const float back_vertices[] = {
-        0.f, 0.f, 0.f,
-        1.f, 0.f, 0.f,
-        1.f, 1.f, 0.f,
-        0.f, 1.f, 0.f,
-    };
-    glVertexPointer(3, GL_FLOAT, 0, back_vertices);
-    glNormal3f(0,0,-1);
-    glDrawArrays(GL_QUADS, 0, 4);
-
-    static const float left_vertices[] = {
-        0.f, 0.f, 0.f,
-        0.f, 0.f, 1.f,
-        0.f, 1.f, 1.f,
-        0.f, 1.f, 0.f,
-    };
-    glVertexPointer(3, GL_FLOAT, 0, left_vertices);
-    glNormal3f(-1,0,0);
-    glDrawArrays(GL_QUADS, 0, 4);
-
-    static const float right_vertices[] = {
-        1.f, 0.f, 1.f,
-        1.f, 0.f, 0.f,
-        1.f, 1.f, 0.f,
-        1.f, 1.f, 1.f,
-    };
-    glVertexPointer(3, GL_FLOAT, 0, right_vertices);
-    glNormal3f(1,0,0);
-    glDrawArrays(GL_QUADS, 0, 4);
-
-    static const float top_vertices[] = {
-        0.f, 1.f, 1.f,
-        1.f, 1.f, 1.f,
-        1.f, 1.f, 0.f,
-        0.f, 1.f, 0.f,
-    };
-    glVertexPointer(3, GL_FLOAT, 0, top_vertices);
-    glNormal3f(0,1,0);
-    glDrawArrays(GL_QUADS, 0, 4);
-
-    static const float bottom_vertices[] = {
-        0.f, 0.f, 0.f,
-        1.f, 0.f, 0.f,
-        1.f, 0.f, 1.f,
-        0.f, 0.f, 1.f,
-    };
-    glVertexPointer(3, GL_FLOAT, 0, bottom_vertices);
-    glNormal3f(0,-1,0);
-    glDrawArrays(GL_QUADS, 0, 4);
-}
-
 void draw_grid()
 {
-    int i, j;
-    float horizontal_line_vertices[] = {
-        0.f, 0.f, 0.f,
-        grid_width, 0.f, 0.f,
-    };
-    float vertical_line_vertices[] = {
-        0.f, 0.f, 0.f,
-        0.f, grid_height, 0.f,
-    };
-
     glColor3f(0.3f, 0.3f, 0.3f);
-    glNormal3f(0.f, 0.f, 1.f);
 
     // Move to the origin of the grid
     glTranslatef(-(float)grid_width/2.0f, -(float)grid_height/2.0f, 0.0f);
     // Store this position
     glPushMatrix();
 
-    // Draw vertical lines
-    glVertexPointer(3, GL_FLOAT, 0, vertical_line_vertices);
-    for (i = 0; i <= grid_width; ++i) {
-        glDrawArrays(GL_LINES, 0, 2);
-        glTranslatef(1.0f, 0.0f, 0.0f);
-    }
-
-    // Reset to the origin
-    glPopMatrix();
-    glPushMatrix();
-
-    // Draw horizontal lines
-    glVertexPointer(3, GL_FLOAT, 0, horizontal_line_vertices);
-    for (j = 0; j <= grid_height; ++j) {
-        glDrawArrays(GL_LINES, 0, 2);
-        glTranslatef(0.0f, 1.0f, 0.0f);
-    }
-
-    // Reset to the origin
-    glPopMatrix();
-    glPushMatrix();
+    geometry_draw_grid();
 
 #if 0
     // Draw blocks whereever one should be placed on the grid.
+    int i, j;
     for(i = 0; i < grid_width; ++i) {
         for(j = 0; j < grid_height; ++j) {
             if ((properties[i][j].block)) {
-                draw_unit_cube();
+                geometry_draw_cube();
             }
             glTranslatef(0.0f, 1.0f, 0.0f);
         }
@@ -450,13 +257,13 @@ void grid_origin()
     glScalef(1.f/scale, 1.f/scale, 1.f/scale);
     // Add a little camera movement
     // glRotatef(10, sin(camera_rotation), cos(camera_rotation), 0.0f);
-    glTranslatef(-pos_x, -pos_y, -pos_z);
+    glTranslatef(-view.x, -view.y, -view.z);
 }
 
 void camera_pos()
 {
     // Set up the modelview
-    glMatrixMode(GL_MODELVIEW);
+    glstate_matrix_mode(GL_MODELVIEW);
     // Reset the camera
     glLoadIdentity();
     // Move the camera 20 units from the objects
@@ -465,20 +272,86 @@ void camera_pos()
 
     // Set the angle so we just can't see the horizon
     glRotatef(-65, 1, 0, 0);
-    glRotatef(angle, 0, 0, 1);
+    glRotatef(view.angle, 0, 0, 1);
+
+}
 
+// Draw the ground blocks of every live tier which are in view of the
+// current camera. With instancing there is one draw call per tier,
+// refreshing the copy of the blocks held by each batch first. Batches
+// belonging to tiers which are no longer drawn are freed.
+void render_ground(const float light_direction[3])
+{
+    float modelview_projection[16];
+    matrix_modelview_projection(modelview_projection);
+    Frustum frustum;
+    frustum_init(&frustum, modelview_projection);
+
+    if (instancing) {
+        instancing_begin(modelview_projection, light_direction,
+                         scene_ambient);
+    }
+    int t;
+    unsigned int v;
+    for (t = 0; t < tier_count; ++t) {
+        InstanceBatch * batch = &ground_batches[t];
+        if (!tier_live(&tiers[t])) {
+            if (batch->buffer != 0) {
+                instancing_batch_clear(batch);
+            }
+            continue;
+        }
+        cull_tier(&frustum, &tiers[t], &visible_blocks, &cull_stats);
+        BlockStore * blocks = &tiers[t].blocks;
+        if (instancing) {
+            if (batch->buffer == 0) {
+                instancing_batch_init(batch);
+            }
+            instancing_batch_update(batch, blocks);
+            instancing_draw(batch, visible_blocks.indices,
+                            visible_blocks.count);
+            continue;
+        }
+        for (v = 0; v < visible_blocks.count; ++v) {
+            unsigned int i = visible_blocks.indices[v];
+            glPushMatrix();
+            glTranslatef(blocks->x[i], blocks->y[i], 0);
+            glScalef(blocks->scale[i], blocks->scale[i], blocks->scale[i]);
+            glstate_material(blocks->diffuse[i]);
+            geometry_draw_cube();
+            glPopMatrix();
+        }
+    }
+    if (instancing) {
+        instancing_end();
+    }
+}
+
+// Radius in pixels of a sphere around the ball's position, used to pick
+// how finely to tessellate it.
+static float sphere_pixels(float radius)
+{
+    // Distance from the camera to the ball, set by camera_pos().
+    static const float camera_distance = 10.05f;
+    // Half the height of the view at unit distance, for a 45 degree fov.
+    static const float view_half_height = 0.414f;
+    return radius / camera_distance / view_half_height * screen_height / 2.f;
 }
 
 void render_scene()
 {
+    cull_stats_reset(&cull_stats);
+
     // Clear the screen
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-    // Enable the depth test
-    glEnable(GL_DEPTH_TEST);
+    // Enable the depth test, and turn off the state left on by text_draw()
+    glstate_enable(GL_DEPTH_TEST);
+    glstate_disable(GL_TEXTURE_2D);
+    glstate_disable(GL_BLEND);
 
     // Set the projection transform
-    glMatrixMode(GL_PROJECTION);
+    glstate_matrix_mode(GL_PROJECTION);
     glLoadIdentity();
     gluPerspective(45, (float)screen_width/screen_height, 1.f, 100.f);
 
@@ -488,30 +361,30 @@ void render_scene()
     glPushMatrix();
 
     GLfloat matrix[16];
-    quaternion_rotmatrix(&orientation, matrix);
+    quaternion_rotmatrix(&view.orientation, matrix);
     glMultMatrixf(matrix);
 
 
     glPushMatrix();
     glScalef(.1f/scale, .1f/scale, .1f/scale);
-    gluSphere(sphere_quadric, 1, 8, 8);
+    geometry_draw_sphere(sphere_pixels(.1f/scale));
     glPopMatrix();
 
-    Block * b;
-    for (b = blocks; b != NULL; b = b->next) {
-        if (b->present != 1) {
+    // Blocks attached to the calamari are baked into one mesh per tier, in
+    // the calamari's coordinates. A frozen tier keeps the blocks attached
+    // from it until trim() takes them, so only an evicted tier has none.
+    glScalef(1/scale, 1/scale, 1/scale);
+    int t;
+    for (t = 0; t < tier_count; ++t) {
+        AttachedMesh * mesh = &attached_meshes[t];
+        if (tiers[t].state == TIER_EVICTED) {
+            if (mesh->vertices != 0) {
+                attached_mesh_clear(mesh);
+            }
             continue;
         }
-        glPushMatrix();
-        quaternion_rotmatrix(&b->orientation, matrix);
-        glMultMatrixf(matrix);
-        glScalef(1/scale, 1/scale, 1/scale);
-        glTranslatef(b->x, b->y, b->z);
-        glScalef(b->scale, b->scale, b->scale);
-        glMaterialfv(GL_FRONT, GL_AMBIENT_AND_DIFFUSE, b->diffuse);
-        draw_unit_cube();
-        glPopMatrix();
-        
+        attached_mesh_update(mesh, &tiers[t].blocks);
+        attached_mesh_draw(mesh);
     }
 
     glPopMatrix();
@@ -521,185 +394,154 @@ void render_scene()
     GLfloat lightPos[] = {0.f, 0.f, 1.f, 0.f};
     glLightfv(GL_LIGHT1, GL_POSITION, lightPos);
 
-    for (b = blocks; b != NULL; b = b->next) {
-        if (b->present != 0) {
-            continue;
-        }
-        glPushMatrix();
-        glTranslatef(b->x, b->y, 0);
-        glScalef(b->scale, b->scale, b->scale);
-        glMaterialfv(GL_FRONT, GL_AMBIENT_AND_DIFFUSE, b->diffuse);
-        draw_unit_cube();
-        glPopMatrix();
-        
-    }
+    render_ground(lightPos);
 
     static float white[] = { 1.f, 1.f, 1.f, 1.f };
-    glMaterialfv(GL_FRONT, GL_AMBIENT_AND_DIFFUSE, white);
+    glstate_material(white);
 
     // Draw the scene
     draw_grid();
 }
 
+// Return true if a line of the overlay has not been set yet, or the values
+// it shows have changed since it was, and remember the new values.
+static bool overlay_stale(int line, float a, float b)
+{
+    if (overlay[line].glyphs != 0 &&
+        overlay_values[line][0] == a && overlay_values[line][1] == b) {
+        return false;
+    }
+    overlay_values[line][0] = a;
+    overlay_values[line][1] = b;
+    return true;
+}
+
 // Draw any text output and other screen oriented user interface
 // If you want any kind of text or other information overlayed on top
 // of the 3d view, put it here.
 void render_interface()
 {
-    char buf[256];
+    char buf[text_line_length + 1];
 
     // Set the projection to a transform that allows us to use pixel
     // coordinates.
-    glMatrixMode(GL_PROJECTION);
+    glstate_matrix_mode(GL_PROJECTION);
     glLoadIdentity();
     glOrtho(0, screen_width, 0, screen_height, -800.0f, 800.0f);
 
     // Set up the modelview
-    glMatrixMode(GL_MODELVIEW);
+    glstate_matrix_mode(GL_MODELVIEW);
     // Reset the camera
     glLoadIdentity();
 
     // Disable the depth test, as its not useful when rendering text
-    glDisable(GL_DEPTH_TEST);
+    glstate_disable(GL_DEPTH_TEST);
 
     // Print the number of frames per second. This is essential performance
-    // information when developing 3D graphics.
-
-    glPushMatrix();
-    // Use glTranslatef to go to the screen coordinates where we want the
-    // text. The origin is the bottom left by default in OpenGL.
-    glTranslatef(5.f, 5.f, 0);
+    // information when developing 3D graphics. Lines are stacked up from
+    // the bottom left, where the origin is by default in OpenGL.
     glColor3f(1.f, 1.f, 1.f);
-    sprintf(buf, "FPS: %d", average_frames_per_second);
-    gl_print(buf);
-    glPopMatrix();
+    if (overlay_stale(OVERLAY_FPS, average_frames_per_second, 0)) {
+        snprintf(buf, sizeof(buf), "FPS: %d", average_frames_per_second);
+        text_line_set(&overlay[OVERLAY_FPS], 5.f, 5.f, buf);
+    }
+    if (overlay_stale(OVERLAY_BLOCKS, cull_stats.blocks_drawn,
+                      cull_stats.blocks_culled)) {
+        snprintf(buf, sizeof(buf), "Blocks: %u drawn %u culled",
+                 cull_stats.blocks_drawn, cull_stats.blocks_culled);
+        text_line_set(&overlay[OVERLAY_BLOCKS], 5.f, 21.f, buf);
+    }
+    if (overlay_stale(OVERLAY_GLSTATE, glstate_last_frame.issued,
+                      glstate_last_frame.elided)) {
+        snprintf(buf, sizeof(buf), "GL state: %u set %u elided",
+                 glstate_last_frame.issued, glstate_last_frame.elided);
+        text_line_set(&overlay[OVERLAY_GLSTATE], 5.f, 37.f, buf);
+    }
+    // Time spent in each phase of the frame, over recent frames.
+    int p;
+    for (p = 0; p < PROFILE_PHASES; ++p) {
+        int line = OVERLAY_PROFILE + p;
+        float p50, p99;
+        profile_percentiles(p, &p50, &p99);
+        if (overlay_stale(line, p50, p99)) {
+            snprintf(buf, sizeof(buf), "%-9s p50 %6.2f p99 %6.2f ms",
+                     profile_phase_name(p), p50, p99);
+            text_line_set(&overlay[line], 5.f,
+                          53.f + 16.f * (PROFILE_PHASES - 1 - p), buf);
+        }
+    }
 
-    glTranslatef(5.f, screen_height - 16 - 5, 0);
-    int metres = floor(scale);
-    int centimetres = floor(fmod(scale, 1) * 100.f);
-    int milimetres = floor(fmod(scale, .01) * 1000.f);
-    sprintf(buf, "%dm %dcm %dmm", metres, centimetres, milimetres);
-    gl_print(buf);
+    if (overlay_stale(OVERLAY_SIZE, scale, 0)) {
+        int metres = floor(scale);
+        int centimetres = floor(fmod(scale, 1) * 100.f);
+        int milimetres = floor(fmod(scale, .01) * 1000.f);
+        snprintf(buf, sizeof(buf), "%dm %dcm %dmm",
+                 metres, centimetres, milimetres);
+        text_line_set(&overlay[OVERLAY_SIZE], 5.f, screen_height - 16 - 5,
+                      buf);
+    }
+
+    text_draw(overlay, OVERLAY_LINES);
 }
 
 // Handle a mouse click. Call this function with the screen coordinates where
 // the mouse was clicked, in OpenGL format with the origin in the bottom left.
-// This function exactly mimics rendering a scene, and then detects which
-// grid location of the scene were under the mouse pointer when the click
-// occured.
+// The point clicked is unprojected through the same transforms used to render
+// the scene, and the ray from the near plane to the far plane through it is
+// cast into the world to find the nearest block or point on the ground under
+// the mouse pointer.
 void mouse_click(unsigned int x, unsigned int y)
 {
-    int i, j;
-    GLuint selectBuf[512];
-    GLfloat square_vertices[] = { 0.f, 0.f, 0.f, 1.f, 0.f, 0.f,
-                                  1.f, 1.f, 0.f, 0.f, 1.f, 0.f };
-
-    // Put OpenGL into Selection mode rather than Render mode. This disables
-    // rendering to the window.
-    glSelectBuffer(512,selectBuf);
-    glRenderMode(GL_SELECT);
-
-    
-    // This is just like setting up the projection for normal rendering
-    // except we use gluPickMatrix to specify the portion of the screen
-    // we are interested in - the 1 pixel square under the mouse pointer.
-    {
-        // Set the projection transform
-        glMatrixMode(GL_PROJECTION);
-        glLoadIdentity();
-        GLint viewport[4];
-        glGetIntegerv(GL_VIEWPORT,viewport);
-        gluPickMatrix(x, y, 1, 1, viewport);
-        gluPerspective(45, (float)screen_width/screen_height, 1.f, 100.f);
-
-        // Set the camera position
-        camera_pos();
-        grid_origin();
-    }
-
-    // Each thing we render will have a numerical name that we must later use
-    // to identify which thing we rendered was under the mouse pointer.
-    // The names are pushed onto a stack, so a thing can have more than
-    // one. We will just have one name per thing, so we start by pushing a
-    // token name onto the stack.
-    glInitNames();
-    glPushName(0);
-
-    // Here we will draw the grid exactly as it was drawn when rendering to
-    // the screen, except we draw a quad on each square rather than just
-    // drawing lines. If you want to detect clicking on other things, you
-    // will need to modify the code here.
-    glTranslatef(-(float)grid_width/2.0f, -(float)grid_height/2.0f, 0.0f);
+    float modelview_projection[16], inverse[16];
 
-    glVertexPointer(3, GL_FLOAT, 0, square_vertices);
+    // Set up the projection and camera exactly as for normal rendering.
+    glstate_matrix_mode(GL_PROJECTION);
+    glLoadIdentity();
+    gluPerspective(45, (float)screen_width/screen_height, 1.f, 100.f);
+    camera_pos();
+    grid_origin();
 
-    for(i = 0; i < grid_width; ++i) {
-        for(j = 0; j < grid_height; ++j) {
-            // Before we render each grid square, we specify the name by
-            // loading it into the top of the name stack. The name
-            // is derived from the coordinates of the square, so that later
-            // when we get a name back, we can tell which square it corresponds
-            // to.
-            glLoadName(i + j * grid_width);
-            glDrawArrays(GL_QUADS, 0, 4);
-            glTranslatef(0.0f, 1.0f, 0.0f);
-        }
-        glTranslatef(1.0f, -grid_height, 0.0f);
+    matrix_modelview_projection(modelview_projection);
+    if (!matrix_invert(modelview_projection, inverse)) {
+        return;
     }
 
-    // We have now finished with the name stack, so we empty it.
-    glPopName();
+    // Cast a ray through the middle of the pixel clicked.
+    float ndc_x = (x + 0.5f) / screen_width * 2.f - 1.f;
+    float ndc_y = (y + 0.5f) / screen_height * 2.f - 1.f;
+    float start[3], end[3];
+    matrix_unproject(inverse, ndc_x, ndc_y, -1.f, start);
+    matrix_unproject(inverse, ndc_x, ndc_y, 1.f, end);
 
-    // Put OpenGL back into rendering mode. This has the side effect of
-    // returning how many hits we got in the selection code above.
-    int hits = glRenderMode(GL_RENDER);
-
-    // std::cout << "Got " << hits << " hits" << std::endl << std::flush;
-
-    // If we got no hits, the user clicked on empty space.
-    if (hits == 0) {
+    PickResult hit;
+    if (!pick_ray(start, end, &hit)) {
         return;
     }
-
-    // This code searches through the results buffer to find what hits we
-    // got.
-
-    // ptr points to the beginning of the results
-    GLuint * ptr = &selectBuf[0];
-    GLuint minDepth = UINT_MAX, noNames = 0;
-    GLuint * namePtr = 0;
-    for (i = 0; i < hits; i++) {
-        int names = *(ptr++);
-        // std::cout << "{" << *ptr << "}";
-        // Check if this hit is closer to the viewer than the last one we
-        // processed. If this test passes, then this is the closest hit
-        // so far, so we record the necessary details.
-        if (*ptr < minDepth) {
-            noNames = names;
-            minDepth = *ptr;
-            namePtr = ptr + 2;
-        }
-        ptr += (names + 2);
+    if (hit.tier >= 0) {
+        log_debug(LOG_GRAPHICS, "Clicked block %u of tier %d at %f, %f, %f",
+                  hit.block, hit.tier,
+                  hit.point[0], hit.point[1], hit.point[2]);
+        return;
     }
-    // Once this loop is complete, we have the details of the nearest hit
-    // stored, which is the thing we rendered that was closest to the viewer
-    // under the mouse pointer. This should be the thing the player was aiming
-    // to click on when they clicked.
-
-    // noNames = Number of names our hit has
-    // namePtr = Pointer to list of names
 
-    // Extract the X and Y coords of the clicked square from the hit name
-    GLuint hitName = *namePtr;
-    int hit_x = hitName % grid_width;
-    int hit_y = hitName / grid_width;
+    // The grid is drawn with its middle at the origin, one unit per square.
+    int hit_x = (int)floorf(hit.point[0] + grid_width / 2.f);
+    int hit_y = (int)floorf(hit.point[1] + grid_height / 2.f);
 
     // Place or remove a block on the square the user clicked.
-    if (hit_x < grid_width && hit_y < grid_height) {
+    if (hit_x >= 0 && hit_x < grid_width &&
+        hit_y >= 0 && hit_y < grid_height) {
         properties[hit_x][hit_y].block = !properties[hit_x][hit_y].block;
     }
 }
 
+// Add a block the calamari has just picked up to the mesh for its tier.
+static void block_attached(int tier, const BlockStore * blocks,
+                           unsigned int index)
+{
+    attached_mesh_add(&attached_meshes[tier], blocks, index);
+}
+
 // This function is called every step_time milliseconds. In many games you
 // will want to use this function to update the game state. For example in
 // a Tetris game, this would be the place where the falling blocks were
@@ -708,305 +550,23 @@ void step()
 {
 }
 
-void update(float delta)
+// Run the steps of the next frame in the input trace being replayed,
+// keeping the state after the last two. Returns false at the end of the
+// trace.
+static bool replay_frame(ViewState * previous, ViewState * current,
+                         ReplayFrame * frame)
 {
-    static bool flipped = false;
-    bool vel_changed = false;
-    bool braking = false;
-    float ang_rad = (angle / 180) * M_PI;
-    // Direction camera is facing
-    float forwards[] = { sin(ang_rad),   cos(ang_rad) };
-    float sideways[] = { cos(ang_rad), - sin(ang_rad) };
-    // Speed in the camera direction
-    float speed = vector2_dot(velocity, forwards);
-    float drift = vector2_dot(velocity, sideways);
-    static float support = 0;
-
-    // printf("Velocity (%f,%f), Direction (%f,%f), Speed %f, Forward %f\n",
-           // velocity[0], velocity[1], forwards[0], forwards[1], speed,
-           // vector2_dot(velocity, forwards));
-
-    // Velociy should be a vector, so speed in facing direction can
-    // be determined by the dot product of velocity in the camera direction
-    // and this value used to determine what constraints should be placed on
-    // changes in speed, such as whether accelerating or braking, and maximums.
-    // Once vel is a vector, similar techniques can be used to handle sideways
-    // velocity, then finall deflection can be handled.
-
-    if (key_lf) {
-        if (key_rf) {
-            if (!(key_lb || key_rb)) {
-                // accelerate forwards
-                if (speed > 0) {
-                    speed += delta * max_accel;
-                } else {
-                    speed += delta * max_decel;
-                    braking = true;
-                }
-                vel_changed = true;
-            }
-        } else {
-            if (key_lb) {
-                printf("Roll left\n");
-                drift = -1;
-            } else {
-                if (key_rb) {
-                    // rotate right
-                    angle += delta * 50;
-                } else {
-                    // coast right
-                    angle += delta * 20;
-                    if (speed > 0) {
-                        speed += delta * max_accel / 2;
-                    } else {
-                        speed += delta * max_decel / 2;
-                    }
-                    vel_changed = true;
-                }
-            }
-        }
-    } else {
-        if (key_rf) {
-            if (key_rb) {
-                printf("Roll right\n");
-                drift = 1;
-            } else {
-                if (key_lb) {
-                    // rotate left
-                    angle -= delta * 50;
-                } else {
-                    // coast left
-                    angle -= delta * 20;
-                    if (speed > 0) {
-                        speed += delta * max_accel / 2;
-                    } else {
-                        speed += delta * max_decel / 2;
-                    }
-                    vel_changed = true;
-                }
-            }
-        } else {
-            if (key_lb) {
-                if (key_rb) {
-                    // reverse
-                    if (speed < 0) {
-                        speed -= delta * max_accel;
-                    } else {
-                        speed -= delta * max_decel;
-                        braking = true;
-                    }
-                    vel_changed = true;
-                } else {
-                    // reverse coast left
-                    angle -= delta * 20;
-                    if (speed < 0) {
-                        speed -= delta * max_accel / 2;
-                    } else {
-                        speed -= delta * max_decel / 2;
-                    }
-                    vel_changed = true;
-                }
-            } else if (key_rb) {
-                if (!key_lb) {
-                    // reverse coast right
-                    angle += delta * 20;
-                    if (speed < 0) {
-                        speed -= delta * max_accel / 2;
-                    } else {
-                        speed -= delta * max_decel / 2;
-                    }
-                    vel_changed = true;
-                }
-            }
-        }
-    }
-    if (key_flip) {
-        if (!flipped) {
-            angle += 180;
-            speed = -speed;
-            vel_changed = true;
-            flipped = true;
-        }
-    } else {
-        flipped = false;
-    }
-
-    if (vel_changed) {
-        // If the controls have had an effect on velocity, clamp it to
-        // the valid range
-        speed = fmaxf(speed, -max_velocity);
-        speed = fminf(speed, max_velocity);
-    } else {
-        // Otherwise coast gently to a stop
-        if (speed < 0.f) {
-            speed += delta;
-            speed = fminf(speed, 0.f);
-        } else {
-            speed -= delta;
-            speed = fmaxf(speed, 0.f);
-        }
-    }
-    if (drift < 0.f) {
-        drift += delta;
-        drift = fminf(drift, 0.f);
-    } else {
-        drift -= delta;
-        drift = fmaxf(drift, 0.f);
-    }
-
-    float new_ang_rad = (angle / 180) * M_PI;
-
-    velocity[0] = sin(new_ang_rad) * speed + cos(ang_rad) * drift;
-    velocity[1] = cos(new_ang_rad) * speed - sin(ang_rad) * drift;
-
-    // float axis[] = { -1, 0, 0 };
-
-    pos_x += velocity[0] * delta * scale;
-    pos_y += velocity[1] * delta * scale;
-    pos_z += velocity[2] * delta * scale;
-
-    // For a unit sphere, distance rolled is equal to angle rolled in
-    // radians
-    if (!braking) {
-        float mag = hypotf(velocity[0], velocity[1]);
-        if (mag > 0.f) {
-            float axis[3];
-
-            axis[0] =   velocity[1] / mag;
-            axis[1] = - velocity[0] / mag;
-            axis[2] = 0;
-            printf("(%f,%f) %f\n", axis[0], axis[1], mag);
-            orientation = quaternion_rotate(&orientation, axis, -mag * delta);
-        }
+    float delta;
+    ReplayEvent event;
+    while ((event = replay_next(&delta, frame)) == REPLAY_STEP) {
+        *previous = *current;
+        replay_record_step(delta);
+        profile_begin(PROFILE_UPDATE);
+        update(delta);
+        profile_end(PROFILE_UPDATE);
+        world_view(current);
     }
-
-    // scale *= (1 + (delta * 0.01f));
-    bool climbing = false;
-    support = 0;
-
-    Block * b;
-    for (b = blocks; b != NULL; b = b->next) {
-        bool collision = false;
-        if (b->present != 0) {
-            continue;
-        }
-        float bx = b->x + b->scale / 2.f;
-        float by = b->y + b->scale / 2.f;
-        if (pos_x < (b->x + b->scale + scale) &&
-            pos_x > (b->x - scale) &&
-            pos_y < (b->y + b->scale + scale) &&
-            pos_y > (b->y - scale)) {
-            support = fmaxf(support, b->scale);
-            if (pos_z < b->scale) {
-                printf("%f, %f\n", pos_z, b->scale);
-                if (pos_y < (b->y + b->scale) &&
-                    pos_y > (b->y)) {
-                    collision = true;
-                    printf("COLY\n");
-                }
-                if (pos_x < (b->x + b->scale) &&
-                    pos_x > (b->x)) {
-                    collision = true;
-                    printf("COLX\n");
-                }
-            }
-        }
-        if (sqrt(square(pos_x - (b->x + b->scale / 2)) +
-                 square(pos_y - (b->y + b->scale / 2)) +
-                 square(pos_z + scale - (b->scale / 2))) < (scale + b->scale / 2)) {
-            collision = true;
-            printf("COLS\n");
-        }
-        if (!collision) {
-            continue;
-        }
-        if (b->scale > scale) {
-            // printf("TOO BIG!\n");
-            // FIXME collide
-            if ((pos_z + scale / 8) >= b->scale) {
-                // on top
-            } else if (fabsf(pos_x - bx) < fabsf(pos_y - by)) {
-                // bouncing y
-                if (pos_y > by) {
-                    if (velocity[1] < 0) {
-                        printf("Bounce +x\n");
-                        velocity[1] = -velocity[1];
-                        if (velocity[1] < 0.2) {
-                            climbing = true;
-                        }
-                    }
-                } else {
-                    if (velocity[1] > 0) {
-                        printf("Bounce -x\n");
-                        velocity[1] = -velocity[1];
-                        if (velocity[1] > -0.2) {
-                            climbing = true;
-                        }
-                    }
-                }
-            } else {
-                // bouncing x
-                if (pos_x > bx) {
-                    if (velocity[0] < 0) {
-                        printf("Bounce +y\n");
-                        velocity[0] = -velocity[0];
-                        if (velocity[0] < 0.2) {
-                            climbing = true;
-                        }
-                    }
-                } else {
-                    if (velocity[0] > 0) {
-                        printf("Bounce -y\n");
-                        velocity[0] = -velocity[0];
-                        if (velocity[0] > -0.2) {
-                            climbing = true;
-                        }
-                    }
-                }
-            }
-            printf("Climbing %d\n", climbing);
-            continue;
-        }
-        b->orientation = orientation;
-        quaternion_invert(&b->orientation);
-        b->x = b->x-pos_x;
-        b->y = b->y-pos_y;
-        b->z = -(pos_z + scale);
-        b->present = 1;
-        // scale === ball_radius
-        printf("B %f\n", scale);
-        scale = powf(cube(scale) + cube(b->scale) / (M_PI * 4.f / 3.f), 1.f/3.f);
-        printf("A %f\n", scale);
-    }
-    printf("P %f %f\n", pos_z, support);
-    if (climbing) {
-        if (pos_z < support) {
-            velocity[2] = 1;
-        }
-    } else {
-        if (pos_z > support) {
-            // If we are above solid surface, fall towards it
-            velocity[2] -= 9.8 * delta;
-        } else if (velocity[2] < 0) {
-            // If we are not above, but still falling, bounce
-            velocity[2] = -0.7 * velocity[2];
-        } else {
-            // Otherwise we are below and rising, in which case we must
-            // behave under gravity, but velocity must not go negative
-            velocity[2] -= 9.8 * delta;
-            if (velocity[2] < 0.f) {
-                velocity[2] = 0;
-            }
-        }
-        printf("V %f %f\n", velocity[2], 9.8 * delta);
-    }
-
-    if (scale > next_level) {
-        level(next_level * 100);
-        trim();
-        next_level *= 10;
-    }
-    // printf("%f %f\n", scale, log10(scale));
+    return event == REPLAY_FRAME;
 }
 
 // The main program loop function. This does not return until the program
@@ -1014,14 +574,33 @@ void update(float delta)
 void loop(SDL_Window * screen)
 {
     SDL_Event event;
-    int elapsed_time = SDL_GetTicks();
-    int last_step = elapsed_time;
+    int last_step = SDL_GetTicks();
     int frame_count = 0;
 
+    // Time is measured in ticks of the high resolution counter, and kept
+    // as whole ticks so the simulation does not drift.
+    const Uint64 frequency = SDL_GetPerformanceFrequency();
+    const Uint64 step_ticks = frequency / simulation_rate;
+    const Uint64 frame_ticks = render_rate > 0 ? frequency / render_rate : 0;
+    const float step_delta = 1.f / simulation_rate;
+    Uint64 last_time = SDL_GetPerformanceCounter();
+    Uint64 accumulator = 0;
+
+    // Time the next frame of a trace being replayed in real time is due.
+    Uint64 replay_due = last_time;
+
+    // State after the last two simulation steps, which frames are drawn
+    // between.
+    ViewState previous, current;
+    world_view(&current);
+    previous = current;
+    view = current;
+
     // This is the main program loop. It will run until something sets
     // the flag to indicate we are done.
     while (!program_finished) {
         // Check for events
+        profile_begin(PROFILE_EVENTS);
         while (SDL_PollEvent(&event)) {
             switch (event.type) {
                 case SDL_QUIT:
@@ -1034,6 +613,10 @@ void loop(SDL_Window * screen)
                         // quit
                         program_finished = true;
                     }
+                    if (replaying) {
+                        // The controls come from the trace.
+                        break;
+                    }
                     if ( event.key.keysym.sym == SDLK_UP ) {
                     }
                     if ( event.key.keysym.sym == SDLK_DOWN ) {
@@ -1043,36 +626,39 @@ void loop(SDL_Window * screen)
                     if ( event.key.keysym.sym == SDLK_RIGHT ) {
                     }
                     if ( event.key.keysym.sym == SDLK_d ) {
-                        key_lf = true;
+                        controls.left_forward = true;
                     }
                     if ( event.key.keysym.sym == SDLK_c ) {
-                        key_lb = true;
+                        controls.left_back = true;
                     }
                     if ( event.key.keysym.sym == SDLK_k ) {
-                        key_rf = true;
+                        controls.right_forward = true;
                     }
                     if ( event.key.keysym.sym == SDLK_m ) {
-                        key_rb = true;
+                        controls.right_back = true;
                     }
                     if ( event.key.keysym.sym == SDLK_SPACE ) {
-                        key_flip = true;
+                        controls.flip = true;
                     }
                     break;
                 case SDL_KEYUP:
+                    if (replaying) {
+                        break;
+                    }
                     if ( event.key.keysym.sym == SDLK_d ) {
-                        key_lf = false;
+                        controls.left_forward = false;
                     }
                     if ( event.key.keysym.sym == SDLK_c ) {
-                        key_lb = false;
+                        controls.left_back = false;
                     }
                     if ( event.key.keysym.sym == SDLK_k ) {
-                        key_rf = false;
+                        controls.right_forward = false;
                     }
                     if ( event.key.keysym.sym == SDLK_m ) {
-                        key_rb = false;
+                        controls.right_back = false;
                     }
                     if ( event.key.keysym.sym == SDLK_SPACE ) {
-                        key_flip = false;
+                        controls.flip = false;
                     }
                     break;
                 case SDL_MOUSEBUTTONDOWN:
@@ -1086,6 +672,8 @@ void loop(SDL_Window * screen)
             }
         }
 
+        profile_end(PROFILE_EVENTS);
+
         ++frame_count;
 
         // Get the time and check if a complete time step has passed.
@@ -1099,31 +687,156 @@ void loop(SDL_Window * screen)
             step();
         }
 
-        // Calculate the time in seconds since the last frame
-        // For a real time program this would be used to update the game state
-        int frame_ticks = (ticks - elapsed_time);
-        if (frame_ticks > 0) {
-            float delta = frame_ticks / 1000.0f;
-            update(delta);
-            elapsed_time = ticks;
-
-            // Update the rotation on the camera
-            camera_rotation += delta;
-            if (camera_rotation > (2 * M_PI)) {
-                camera_rotation -= (2 * M_PI);
+        Uint64 frame_start = SDL_GetPerformanceCounter();
+        Uint64 elapsed = frame_start - last_time;
+        float fraction;
+        if (replaying) {
+            // Run the steps of the next recorded frame, once the time it
+            // took when it was recorded has passed, and draw it as it was
+            // drawn then.
+            ReplayFrame frame;
+            if (!replay_frame(&previous, &current, &frame)) {
+                break;
             }
+            elapsed = (Uint64)frame.microseconds * frequency / 1000000;
+            fraction = frame.fraction;
+            replay_due += elapsed;
+            if (!replay_fast && frame_start < replay_due) {
+                SDL_Delay((replay_due - frame_start) * 1000 / frequency);
+                frame_start = SDL_GetPerformanceCounter();
+            }
+        } else {
+            // Run as many fixed simulation steps as the time since the
+            // last frame covers, carrying the remainder over to the next
+            // frame.
+            accumulator += elapsed;
+            if (accumulator > step_ticks * max_frame_steps) {
+                accumulator = step_ticks * max_frame_steps;
+            }
+            while (accumulator >= step_ticks) {
+                previous = current;
+                replay_record_step(step_delta);
+                profile_begin(PROFILE_UPDATE);
+                update(step_delta);
+                profile_end(PROFILE_UPDATE);
+                world_view(&current);
+                accumulator -= step_ticks;
+            }
+            fraction = (float)accumulator / step_ticks;
+        }
+        last_time = frame_start;
+        replay_record_frame(elapsed * 1000000 / frequency, fraction);
+
+        // Draw the calamari as far between the last two steps as the
+        // time left over.
+        view_interpolate(&previous, &current, fraction, &view);
+
+        // Update the rotation on the camera
+        camera_rotation += (float)elapsed / frequency;
+        if (camera_rotation > (2 * M_PI)) {
+            camera_rotation -= (2 * M_PI);
         }
 
         // Render the screen
+        glstate_frame();
+        profile_begin(PROFILE_RENDER_SCENE);
         render_scene();
+        profile_end(PROFILE_RENDER_SCENE);
+        profile_begin(PROFILE_RENDER_INTERFACE);
         render_interface();
+        profile_end(PROFILE_RENDER_INTERFACE);
 
+        profile_begin(PROFILE_SWAP);
         SDL_GL_SwapWindow(screen);
+        profile_end(PROFILE_SWAP);
+        profile_frame();
+
+        // Wait out the rest of the frame if the frame rate is limited.
+        if (frame_ticks != 0 && !replaying) {
+            const Uint64 spent = SDL_GetPerformanceCounter() - frame_start;
+            if (spent < frame_ticks) {
+                SDL_Delay((frame_ticks - spent) * 1000 / frequency);
+            }
+        }
     }
 }
 
-int main()
+static void usage(const char * prog)
 {
+    fprintf(stderr, "usage: %s [-r simulation_rate] [-f frame_rate] "
+                    "[-t trace_file] [--seed seed]\n"
+                    "       [--record input_trace] "
+                    "[--replay input_trace [--fast]]\n"
+                    "       [--load snapshot] [--save snapshot]\n", prog);
+    fprintf(stderr, "A replayed trace runs in the world it was recorded "
+                    "in, at the speed it was\n"
+                    "recorded at, or as fast as possible with --fast.\n"
+                    "A loaded snapshot replaces setting up the world, and "
+                    "one is saved on exit\nif asked for.\n");
+}
+
+int main(int argc, char ** argv)
+{
+    simulation_rate = default_simulation_rate;
+    render_rate = default_render_rate;
+    const char * trace_filename = NULL;
+    const char * record_filename = NULL;
+    const char * replay_filename = NULL;
+    const char * load_filename = NULL;
+    const char * save_filename = NULL;
+
+    int i;
+    for (i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+            simulation_rate = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+            render_rate = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            trace_filename = argv[++i];
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            world_seed = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            record_filename = argv[++i];
+        } else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            replay_filename = argv[++i];
+        } else if (strcmp(argv[i], "--fast") == 0) {
+            replay_fast = true;
+        } else if (strcmp(argv[i], "--load") == 0 && i + 1 < argc) {
+            load_filename = argv[++i];
+        } else if (strcmp(argv[i], "--save") == 0 && i + 1 < argc) {
+            save_filename = argv[++i];
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (simulation_rate <= 0 || render_rate < 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    // Replaying a trace sets the seed to the one it was recorded with, so
+    // this must come before the world is set up, or a new trace started.
+    if (replay_filename != NULL) {
+        if (!replay_open(replay_filename)) {
+            return 1;
+        }
+        replaying = true;
+    }
+    if (record_filename != NULL &&
+        !replay_record_open(record_filename, 1.f / simulation_rate)) {
+        return 1;
+    }
+
+    // Write log messages from a background thread, making sure any still
+    // waiting are written out however the program exits.
+    logger_init();
+    atexit(logger_shutdown);
+    chunk_stream_init();
+    atexit(chunk_stream_shutdown);
+    jobs_init(0);
+    atexit(jobs_shutdown);
+
     // Initialise the graphics
     SDL_Window * screen = init_graphics();
     if (screen == NULL) {
@@ -1131,10 +844,30 @@ int main()
     }
 
     // Intialise the game state
-    setup();
+    clear();
+    attach_hook = block_attached;
+    if (load_filename != NULL) {
+        if (!snapshot_load(load_filename)) {
+            return 1;
+        }
+    } else {
+        setup();
+    }
+
+    // Time each phase of every frame, writing them out if asked to.
+    if (!profile_init(trace_filename)) {
+        return 1;
+    }
 
     // Run the game
     loop(screen);
+
+    replay_record_close();
+    replay_close();
+    profile_shutdown();
+    if (save_filename != NULL && !snapshot_save(save_filename)) {
+        return 1;
+    }
     return 0;
 }
 
@@ -1147,7 +880,7 @@ int WinMain(
     int nCmdShow
 )
 {
-    main();
+    return main(__argc, __argv);
 }
 
 #endif
@@ -0,0 +1,691 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+// Streaming of the ground in chunks around the calamari. The ground of
+// each tier is divided into chunks of grid_width by grid_height times the
+// factor of the tier, the one at the origin covering the area a tier used
+// to be. Chunks within load_radius of the chunk the calamari is in are
+// generated on a background thread before it gets there, and chunks more
+// than unload_radius away are removed, so each tier holds the same number
+// of blocks however far the calamari rolls.
+//
+// Chunks are passed between the threads through a ring of jobs. The
+// simulation fills in a job and advances requested, the background thread
+// generates the blocks and advances generated, and the simulation adds
+// them to the tier a few steps later and advances consumed, so neither
+// thread holds a lock. If the calamari reaches a chunk in an active tier
+// before it has been added, the simulation adds it there and then, rather
+// than let the calamari roll through blocks that are not there yet.
+
+#include "chunk.h"
+
+#include "world.h"
+#include "generate.h"
+#include "logger.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <assert.h>
+
+// Distance in chunks, along either axis, from the calamari's chunk within
+// which chunks are loaded, and beyond which they are unloaded. The gap
+// between the two stops chunks being loaded and unloaded over and over as
+// the calamari rolls back and forth across the edge of a chunk.
+#define load_radius 1
+#define unload_radius 2
+#define max_chunks ((2 * unload_radius + 1) * (2 * unload_radius + 1))
+
+// Number of jobs in the ring, which must be a power of two, and the most
+// blocks one chunk can hold.
+#define ring_size 16
+#define chunk_capacity ((2 * grid_width + 3) * (2 * grid_height + 3))
+
+// Most generated chunks added to the tiers each step.
+static const unsigned int integrate_budget = 2;
+
+// Number of steps between asking for a chunk and adding it to its tier.
+// Chunks are added at the step they are due, waiting for the background
+// thread if need be, never as soon as they happen to be ready, so the
+// same inputs always give the same world however the threads are timed.
+static const unsigned int integrate_delay = 4;
+
+typedef enum chunk_state {
+    CHUNK_LOADING,
+    CHUNK_LOADED
+} ChunkState;
+
+typedef struct chunk {
+    int x;
+    int y;
+    ChunkState state;
+} Chunk;
+
+// Where a block was when it was picked up, so it is left out when the
+// chunk it came from is generated again.
+typedef struct eaten_block {
+    int chunk_x;
+    int chunk_y;
+    float x;
+    float y;
+} EatenBlock;
+
+// The chunks of one tier which are loaded or on their way.
+typedef struct chunk_tier {
+    Chunk chunks[max_chunks];
+    unsigned int count;
+    EatenBlock * eaten;
+    unsigned int eaten_count;
+    unsigned int eaten_capacity;
+} ChunkTier;
+
+typedef struct chunk_job {
+    // Jobs requested before the world was last cleared are thrown away.
+    unsigned int epoch;
+    // Step at which the chunk is added to its tier.
+    unsigned long due;
+    int tier;
+    float factor;
+    float min_size;
+    float max_size;
+    unsigned long long seed;
+    int x;
+    int y;
+    unsigned int count;
+    GeneratedBlock blocks[chunk_capacity];
+} ChunkJob;
+
+// A chunk which had been asked for, but not added to its tier, when a
+// snapshot was taken.
+typedef struct chunk_request {
+    int tier;
+    int x;
+    int y;
+    unsigned long long due;
+} ChunkRequest;
+
+// The chunks of one tier as kept in a snapshot, with the offset of the
+// blocks picked up from them.
+typedef struct chunk_snapshot_tier {
+    Chunk chunks[max_chunks];
+    unsigned int count;
+    unsigned int eaten_count;
+    unsigned long long eaten;
+} ChunkSnapshotTier;
+
+// Everything about streaming the chunks kept in a snapshot.
+typedef struct chunk_snapshot {
+    unsigned long long step;
+    unsigned int request_count;
+    ChunkRequest requests[ring_size];
+    ChunkSnapshotTier tiers[max_tiers];
+} ChunkSnapshot;
+
+static ChunkTier chunk_tiers[max_tiers];
+
+static ChunkJob ring[ring_size];
+static atomic_uint requested;
+static atomic_uint generated;
+static unsigned int consumed;
+static unsigned int epoch;
+static unsigned long step;
+
+// Job used when the simulation has to generate a chunk itself.
+static ChunkJob urgent;
+
+static pthread_t worker;
+static atomic_int running = 0;
+static atomic_int stopping = 0;
+
+// The background thread sleeps when it has nothing to do. The lock is
+// only taken to put it to sleep and wake it, never to pass jobs.
+static pthread_mutex_t sleep_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t wake = PTHREAD_COND_INITIALIZER;
+static atomic_int sleeping = 0;
+
+unsigned long chunks_loaded = 0;
+unsigned long chunks_unloaded = 0;
+unsigned long chunks_waited = 0;
+
+static inline int distance(int a, int b)
+{
+    return a > b ? a - b : b - a;
+}
+
+static void generate(ChunkJob * job)
+{
+    job->count = generate_chunk(job->blocks, job->factor, job->min_size,
+                                job->max_size, grid_width, grid_height,
+                                job->x, job->y, job->seed, job->tier);
+}
+
+static void * worker_main(void * arg)
+{
+    unsigned int position = atomic_load_explicit(&generated,
+                                                 memory_order_relaxed);
+    for (;;) {
+        if (atomic_load(&stopping)) {
+            break;
+        }
+        if (position != atomic_load_explicit(&requested,
+                                             memory_order_acquire)) {
+            generate(&ring[position & (ring_size - 1)]);
+            atomic_store_explicit(&generated, ++position,
+                                  memory_order_release);
+            continue;
+        }
+        // Say we are going to sleep before looking for work one last time,
+        // so a job asked for in between is either seen here, or wakes us.
+        pthread_mutex_lock(&sleep_lock);
+        atomic_store(&sleeping, 1);
+        if (position == atomic_load(&requested) && !atomic_load(&stopping)) {
+            pthread_cond_wait(&wake, &sleep_lock);
+        }
+        atomic_store(&sleeping, 0);
+        pthread_mutex_unlock(&sleep_lock);
+    }
+    return NULL;
+}
+
+static void wake_worker()
+{
+    if (atomic_load(&sleeping)) {
+        pthread_mutex_lock(&sleep_lock);
+        pthread_cond_signal(&wake);
+        pthread_mutex_unlock(&sleep_lock);
+    }
+}
+
+// Start the background thread which generates chunks. Until this is
+// called, and after chunk_stream_shutdown(), chunks are generated as soon
+// as they are asked for.
+int chunk_stream_init()
+{
+    assert(chunk_capacity == generate_chunk_capacity(grid_width,
+                                                     grid_height));
+    atomic_store(&stopping, 0);
+    if (pthread_create(&worker, NULL, worker_main, NULL) != 0) {
+        return 0;
+    }
+    atomic_store(&running, 1);
+    return 1;
+}
+
+// Stop the thread, and generate any chunks it had not got to.
+void chunk_stream_shutdown()
+{
+    if (!atomic_load(&running)) {
+        return;
+    }
+    atomic_store(&stopping, 1);
+    wake_worker();
+    pthread_join(worker, NULL);
+    atomic_store(&running, 0);
+
+    unsigned int position = atomic_load(&generated);
+    unsigned int end = atomic_load(&requested);
+    for (; position != end; ++position) {
+        generate(&ring[position & (ring_size - 1)]);
+    }
+    atomic_store(&generated, end);
+}
+
+static Chunk * find_chunk(ChunkTier * chunks, int x, int y)
+{
+    unsigned int c;
+    for (c = 0; c < chunks->count; ++c) {
+        if (chunks->chunks[c].x == x && chunks->chunks[c].y == y) {
+            return &chunks->chunks[c];
+        }
+    }
+    return 0;
+}
+
+static Chunk * add_chunk(ChunkTier * chunks, int x, int y)
+{
+    if (chunks->count == max_chunks) {
+        return 0;
+    }
+    Chunk * chunk = &chunks->chunks[chunks->count++];
+    chunk->x = x;
+    chunk->y = y;
+    chunk->state = CHUNK_LOADING;
+    return chunk;
+}
+
+// Forget everything about the chunks of a tier, once the tier will never
+// be streamed again.
+void chunk_stream_forget(int tier)
+{
+    ChunkTier * chunks = &chunk_tiers[tier];
+    free(chunks->eaten);
+    chunks->eaten = 0;
+    chunks->eaten_count = 0;
+    chunks->eaten_capacity = 0;
+    chunks->count = 0;
+}
+
+// Forget every chunk, and throw away any still being generated, so a new
+// world can be set up.
+void chunk_stream_reset()
+{
+    int t;
+    for (t = 0; t < max_tiers; ++t) {
+        chunk_stream_forget(t);
+    }
+    ++epoch;
+    chunks_loaded = 0;
+    chunks_unloaded = 0;
+    chunks_waited = 0;
+}
+
+// Record that a ground block at x, y in a tier has been picked up.
+void chunk_stream_picked_up(int tier, float x, float y)
+{
+    ChunkTier * chunks = &chunk_tiers[tier];
+    if (chunks->eaten_count == chunks->eaten_capacity) {
+        chunks->eaten_capacity = chunks->eaten_capacity ?
+                                 chunks->eaten_capacity * 2 : 64;
+        chunks->eaten = realloc(chunks->eaten,
+                                chunks->eaten_capacity * sizeof(EatenBlock));
+        assert(chunks->eaten != 0);
+    }
+    EatenBlock * eaten = &chunks->eaten[chunks->eaten_count++];
+    eaten->chunk_x = generate_chunk_coord(x, grid_width * tiers[tier].factor);
+    eaten->chunk_y = generate_chunk_coord(y, grid_height * tiers[tier].factor);
+    eaten->x = x;
+    eaten->y = y;
+}
+
+static void fill_job(ChunkJob * job, int tier, int x, int y)
+{
+    job->epoch = epoch;
+    job->due = step + integrate_delay;
+    job->tier = tier;
+    job->factor = tiers[tier].factor;
+    job->min_size = tiers[tier].min_size;
+    job->max_size = tiers[tier].max_size;
+    job->seed = world_seed;
+    job->x = x;
+    job->y = y;
+}
+
+static int ring_full()
+{
+    unsigned int position = atomic_load_explicit(&requested,
+                                                 memory_order_relaxed);
+    return position - consumed == ring_size;
+}
+
+// Ask for a chunk to be generated, to be added to its tier at the step
+// it is due. The ring must not be full. Without the background thread the
+// chunk is generated straight away.
+static void request(int tier, int x, int y, unsigned long due)
+{
+    unsigned int position = atomic_load_explicit(&requested,
+                                                 memory_order_relaxed);
+    assert(position - consumed < ring_size);
+    ChunkJob * job = &ring[position & (ring_size - 1)];
+    fill_job(job, tier, x, y);
+    job->due = due;
+    if (!atomic_load_explicit(&running, memory_order_relaxed)) {
+        generate(job);
+        atomic_store_explicit(&generated, position + 1,
+                              memory_order_release);
+    }
+    atomic_store(&requested, position + 1);
+    wake_worker();
+}
+
+// Add the blocks of a generated chunk to its tier, leaving out any which
+// have been picked up or trimmed since the chunk was last loaded.
+static void integrate(Chunk * chunk, const ChunkJob * job)
+{
+    Tier * tier = &tiers[job->tier];
+    ChunkTier * chunks = &chunk_tiers[job->tier];
+    BlockStore * blocks = &tier->blocks;
+
+    // Gather up the blocks picked up from this chunk, which is usually
+    // none at all.
+    EatenBlock * eaten = 0;
+    unsigned int eaten_count = 0;
+    unsigned int e;
+    for (e = 0; e < chunks->eaten_count; ++e) {
+        if (chunks->eaten[e].chunk_x == job->x &&
+            chunks->eaten[e].chunk_y == job->y) {
+            if (eaten == 0) {
+                eaten = malloc((chunks->eaten_count - e) *
+                               sizeof(EatenBlock));
+                assert(eaten != 0);
+            }
+            eaten[eaten_count++] = chunks->eaten[e];
+        }
+    }
+
+    block_store_reserve(blocks, blocks->count + job->count);
+    unsigned int added = 0;
+    unsigned int b;
+    for (b = 0; b < job->count; ++b) {
+        const GeneratedBlock * block = &job->blocks[b];
+        if (block->size < tier->trim_size) {
+            continue;
+        }
+        for (e = 0; e < eaten_count; ++e) {
+            if (eaten[e].x == block->x && eaten[e].y == block->y) {
+                break;
+            }
+        }
+        if (e < eaten_count) {
+            continue;
+        }
+        BlockHandle handle = block_store_add(blocks, block->x, block->y,
+                                             block->size, block->diffuse);
+        spatial_hash_insert(&tier->index, handle, block->x, block->y,
+                            block->size);
+        ++added;
+    }
+    free(eaten);
+
+    chunk->state = CHUNK_LOADED;
+    ++chunks_loaded;
+    log_debug(LOG_GENERATE, "Loaded chunk %d, %d of tier %f with %u blocks",
+              job->x, job->y, tier->factor, added);
+}
+
+// Remove a chunk from its tier, along with all its blocks still on the
+// ground.
+static void unload(int t, Chunk * chunk)
+{
+    Tier * tier = &tiers[t];
+    ChunkTier * chunks = &chunk_tiers[t];
+    BlockStore * blocks = &tier->blocks;
+
+    if (chunk->state == CHUNK_LOADED) {
+        const float side_x = grid_width * tier->factor;
+        const float side_y = grid_height * tier->factor;
+        unsigned int removed = 0;
+        unsigned int i = 0;
+        while (i < blocks->ground) {
+            if (generate_chunk_coord(blocks->x[i], side_x) == chunk->x &&
+                generate_chunk_coord(blocks->y[i], side_y) == chunk->y) {
+                // The last ground block is moved into this index, so look
+                // again.
+                tier_remove_block(tier, i);
+                ++removed;
+            } else {
+                ++i;
+            }
+        }
+        ++chunks_unloaded;
+        log_debug(LOG_GENERATE, "Unloaded chunk %d, %d of tier %f with %u "
+                  "blocks", chunk->x, chunk->y, tier->factor, removed);
+    }
+    *chunk = chunks->chunks[--chunks->count];
+}
+
+// Add the chunks which are due to their tiers, in the order they were
+// asked for, throwing away any which are no longer wanted. Only a few are
+// added each step, so a burst of chunks does not cause a hitch. If the
+// background thread has not finished a chunk which is due, wait for it.
+static void collect()
+{
+    unsigned int budget = integrate_budget;
+    unsigned int end = atomic_load_explicit(&requested,
+                                            memory_order_relaxed);
+    while (budget > 0 && consumed != end) {
+        ChunkJob * job = &ring[consumed & (ring_size - 1)];
+        if (job->due > step) {
+            break;
+        }
+        if (atomic_load_explicit(&generated, memory_order_acquire) ==
+            consumed) {
+            ++chunks_waited;
+            while (atomic_load_explicit(&generated, memory_order_acquire) ==
+                   consumed) {
+                sched_yield();
+            }
+        }
+        ++consumed;
+        if (job->epoch != epoch) {
+            continue;
+        }
+        Chunk * chunk = find_chunk(&chunk_tiers[job->tier], job->x, job->y);
+        if (chunk == 0 || chunk->state == CHUNK_LOADED) {
+            continue;
+        }
+        integrate(chunk, job);
+        --budget;
+    }
+}
+
+// Load a chunk which is needed now. If it has already been generated it is
+// taken from the ring, and otherwise it is generated here, split between
+// the threads of the job pool so the step is held up as little as possible.
+static void load_now(int tier, Chunk * chunk)
+{
+    unsigned int ready = atomic_load_explicit(&generated,
+                                              memory_order_acquire);
+    unsigned int position;
+    for (position = consumed; position != ready; ++position) {
+        const ChunkJob * job = &ring[position & (ring_size - 1)];
+        if (job->epoch == epoch && job->tier == tier &&
+            job->x == chunk->x && job->y == chunk->y) {
+            integrate(chunk, job);
+            return;
+        }
+    }
+    fill_job(&urgent, tier, chunk->x, chunk->y);
+    urgent.count = generate_chunk_parallel(urgent.blocks, urgent.factor,
+                                           urgent.min_size, urgent.max_size,
+                                           grid_width, grid_height,
+                                           urgent.x, urgent.y, urgent.seed,
+                                           urgent.tier);
+    integrate(chunk, &urgent);
+}
+
+static void stream_tier(int t, bool wait)
+{
+    Tier * tier = &tiers[t];
+    ChunkTier * chunks = &chunk_tiers[t];
+    const float side_x = grid_width * tier->factor;
+    const float side_y = grid_height * tier->factor;
+    const int cx = generate_chunk_coord(pos_x, side_x);
+    const int cy = generate_chunk_coord(pos_y, side_y);
+    unsigned int c;
+    int x, y;
+
+    // Remove one chunk which has been left behind.
+    for (c = 0; c < chunks->count; ++c) {
+        Chunk * chunk = &chunks->chunks[c];
+        if (distance(chunk->x, cx) > unload_radius ||
+            distance(chunk->y, cy) > unload_radius) {
+            unload(t, chunk);
+            break;
+        }
+    }
+
+    // Ask for the chunks around the calamari.
+    for (x = cx - load_radius; x <= cx + load_radius; ++x) {
+        for (y = cy - load_radius; y <= cy + load_radius; ++y) {
+            if (find_chunk(chunks, x, y) != 0) {
+                continue;
+            }
+            if (wait) {
+                Chunk * chunk = add_chunk(chunks, x, y);
+                if (chunk != 0) {
+                    load_now(t, chunk);
+                }
+            } else if (!ring_full() && add_chunk(chunks, x, y) != 0) {
+                request(t, x, y, step + integrate_delay);
+            }
+        }
+    }
+    if (wait || tier->state != TIER_ACTIVE) {
+        return;
+    }
+
+    // Blocks in an active tier can be picked up, so the chunks holding
+    // any block the calamari could touch must be there before it is
+    // tested for collision. A block can reach into the chunk after its
+    // own.
+    int x0 = generate_chunk_coord(pos_x - scale - tier->max_size, side_x);
+    int y0 = generate_chunk_coord(pos_y - scale - tier->max_size, side_y);
+    int x1 = generate_chunk_coord(pos_x + scale, side_x);
+    int y1 = generate_chunk_coord(pos_y + scale, side_y);
+    for (x = x0; x <= x1; ++x) {
+        for (y = y0; y <= y1; ++y) {
+            Chunk * chunk = find_chunk(chunks, x, y);
+            if (chunk == 0 || chunk->state == CHUNK_LOADED) {
+                continue;
+            }
+            log_debug(LOG_GENERATE, "Chunk %d, %d of tier %f not ready",
+                      x, y, tier->factor);
+            ++chunks_waited;
+            load_now(t, chunk);
+        }
+    }
+}
+
+// Load every chunk around the calamari straight away, so the world is
+// complete as soon as it is set up.
+void chunk_stream_fill()
+{
+    int t;
+    for (t = 0; t < tier_count; ++t) {
+        if (tier_live(&tiers[t])) {
+            stream_tier(t, true);
+        }
+    }
+}
+
+// Bring the chunks of every live tier up to date with the position of the
+// calamari. Called every step, before collision.
+void chunk_stream_update()
+{
+    ++step;
+    collect();
+    int t;
+    for (t = 0; t < tier_count; ++t) {
+        if (tier_live(&tiers[t])) {
+            stream_tier(t, false);
+        }
+    }
+}
+
+// Wait for the background thread to finish every chunk asked for, and
+// throw them all away.
+static void drain()
+{
+    unsigned int end = atomic_load(&requested);
+    while (atomic_load_explicit(&generated, memory_order_acquire) != end) {
+        sched_yield();
+    }
+    consumed = end;
+}
+
+// Write the chunks of every tier to a snapshot, along with the chunks
+// asked for but not yet added, and return the offset they were written
+// at. Chunks on their way are only kept as the request, and are generated
+// again when the snapshot is loaded.
+unsigned long long chunk_stream_save(SnapshotWriter * out)
+{
+    ChunkSnapshot * snapshot = calloc(1, sizeof(ChunkSnapshot));
+    assert(snapshot != 0);
+    snapshot->step = step;
+
+    unsigned int end = atomic_load(&requested);
+    unsigned int position;
+    for (position = consumed; position != end; ++position) {
+        const ChunkJob * job = &ring[position & (ring_size - 1)];
+        if (job->epoch != epoch) {
+            continue;
+        }
+        ChunkRequest * r = &snapshot->requests[snapshot->request_count++];
+        r->tier = job->tier;
+        r->x = job->x;
+        r->y = job->y;
+        r->due = job->due;
+    }
+
+    int t;
+    for (t = 0; t < max_tiers; ++t) {
+        const ChunkTier * chunks = &chunk_tiers[t];
+        ChunkSnapshotTier * saved = &snapshot->tiers[t];
+        memcpy(saved->chunks, chunks->chunks, sizeof(saved->chunks));
+        saved->count = chunks->count;
+        saved->eaten_count = chunks->eaten_count;
+        saved->eaten = snapshot_write(out, chunks->eaten,
+                                      chunks->eaten_count *
+                                      sizeof(EatenBlock));
+    }
+
+    unsigned long long offset = snapshot_write(out, snapshot,
+                                               sizeof(ChunkSnapshot));
+    free(snapshot);
+    return offset;
+}
+
+// Restore the chunks written by chunk_stream_save(), and ask again for
+// the ones which were on their way, due at the same step as before. The
+// world must have been cleared first. Returns false, having changed
+// nothing, if the snapshot does not hold a valid set of chunks.
+int chunk_stream_load(const SnapshotReader * in, unsigned long long offset)
+{
+    const ChunkSnapshot * snapshot = snapshot_read(in, offset,
+                                                   sizeof(ChunkSnapshot));
+    if (snapshot == 0 || snapshot->request_count > ring_size) {
+        return 0;
+    }
+    const void * eaten[max_tiers];
+    int t;
+    for (t = 0; t < max_tiers; ++t) {
+        const ChunkSnapshotTier * saved = &snapshot->tiers[t];
+        eaten[t] = snapshot_read(in, saved->eaten,
+                                 saved->eaten_count * sizeof(EatenBlock));
+        if (saved->count > max_chunks || eaten[t] == 0) {
+            return 0;
+        }
+        unsigned int c;
+        for (c = 0; c < saved->count; ++c) {
+            if (saved->chunks[c].state != CHUNK_LOADING &&
+                saved->chunks[c].state != CHUNK_LOADED) {
+                return 0;
+            }
+        }
+    }
+    unsigned int r;
+    for (r = 0; r < snapshot->request_count; ++r) {
+        const ChunkRequest * saved = &snapshot->requests[r];
+        if (saved->tier < 0 || saved->tier >= tier_count) {
+            return 0;
+        }
+    }
+
+    drain();
+    step = snapshot->step;
+    for (t = 0; t < max_tiers; ++t) {
+        const ChunkSnapshotTier * saved = &snapshot->tiers[t];
+        ChunkTier * chunks = &chunk_tiers[t];
+        chunk_stream_forget(t);
+        memcpy(chunks->chunks, saved->chunks, sizeof(chunks->chunks));
+        chunks->count = saved->count;
+        if (saved->eaten_count > 0) {
+            const size_t eaten_bytes = saved->eaten_count *
+                                       sizeof(EatenBlock);
+            chunks->eaten = malloc(eaten_bytes);
+            assert(chunks->eaten != 0);
+            memcpy(chunks->eaten, eaten[t], eaten_bytes);
+            chunks->eaten_count = saved->eaten_count;
+            chunks->eaten_capacity = saved->eaten_count;
+        }
+    }
+    for (r = 0; r < snapshot->request_count; ++r) {
+        const ChunkRequest * saved = &snapshot->requests[r];
+        request(saved->tier, saved->x, saved->y, saved->due);
+    }
+    return 1;
+}
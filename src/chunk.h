@@ -0,0 +1,27 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#ifndef CHUNK_H
+#define CHUNK_H
+
+#include "snapshot.h"
+
+// Number of chunks added to and removed from tiers since the world was set
+// up, and the number the simulation had to generate itself because the
+// calamari got there first.
+extern unsigned long chunks_loaded;
+extern unsigned long chunks_unloaded;
+extern unsigned long chunks_waited;
+
+int chunk_stream_init();
+void chunk_stream_shutdown();
+void chunk_stream_reset();
+void chunk_stream_forget(int tier);
+void chunk_stream_fill();
+void chunk_stream_update();
+void chunk_stream_picked_up(int tier, float x, float y);
+unsigned long long chunk_stream_save(SnapshotWriter * out);
+int chunk_stream_load(const SnapshotReader * in, unsigned long long offset);
+
+#endif // CHUNK_H
@@ -0,0 +1,358 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+// Narrow phase tests of the calamari against the blocks near it. The blocks
+// are gathered into packed arrays, and tested by a kernel which, where the
+// processor allows, tests four or eight blocks at a time using SSE2 or
+// AVX. The best kernel the processor supports is picked the first time one
+// is needed. The scalar kernel is the reference, and the others give
+// exactly the same hits, as they do the same float arithmetic in the same
+// order. The only place they could differ is a sphere test which comes
+// out exactly equal, which is settled by the scalar test.
+
+#include "collide.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <assert.h>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define COLLIDE_X86
+#include <immintrin.h>
+#endif
+
+typedef void (*CollideKernel)(CollideBatch * batch,
+                              const CollideQuery * query);
+
+typedef struct collide_kernel_entry {
+    const char * name;
+    CollideKernel kernel;
+    // Returns true if the processor can run the kernel.
+    int (*supported)();
+} CollideKernelEntry;
+
+static const CollideKernelEntry * current = 0;
+
+static inline float square(float f)
+{
+    return f * f;
+}
+
+void collide_batch_init(CollideBatch * batch)
+{
+    memset(batch, 0, sizeof(CollideBatch));
+}
+
+void collide_batch_clear(CollideBatch * batch)
+{
+    free(batch->index);
+    free(batch->x);
+    free(batch->y);
+    free(batch->size);
+    free(batch->hits);
+    free(batch->flags);
+    collide_batch_init(batch);
+}
+
+// Copy the position and size of the ground blocks with the given handles
+// into the batch, replacing whatever it held before.
+void collide_batch_gather(CollideBatch * batch, const BlockStore * blocks,
+                          const BlockHandle * handles, unsigned int count)
+{
+    if (count > batch->capacity) {
+        unsigned int capacity = batch->capacity ? batch->capacity : 64;
+        while (capacity < count) {
+            capacity *= 2;
+        }
+        batch->index = realloc(batch->index, capacity * sizeof(unsigned int));
+        batch->x = realloc(batch->x, capacity * sizeof(float));
+        batch->y = realloc(batch->y, capacity * sizeof(float));
+        batch->size = realloc(batch->size, capacity * sizeof(float));
+        batch->hits = realloc(batch->hits, capacity * sizeof(unsigned int));
+        batch->flags = realloc(batch->flags, capacity);
+        assert(batch->index != 0 && batch->x != 0 && batch->y != 0 &&
+               batch->size != 0 && batch->hits != 0 && batch->flags != 0);
+        batch->capacity = capacity;
+    }
+
+    unsigned int c;
+    for (c = 0; c < count; ++c) {
+        int i = block_store_index(blocks, handles[c]);
+        assert(i >= 0 && (unsigned int)i < blocks->ground);
+        batch->index[c] = i;
+        batch->x[c] = blocks->x[i];
+        batch->y[c] = blocks->y[i];
+        batch->size[c] = blocks->scale[i];
+    }
+    batch->count = count;
+    batch->hit_count = 0;
+}
+
+static inline void add_hit(CollideBatch * batch, unsigned int c,
+                           unsigned char flags)
+{
+    batch->hits[batch->hit_count] = c;
+    batch->flags[batch->hit_count++] = flags;
+}
+
+// Test one block, returning the ways it is touching the calamari.
+static inline unsigned char test_block(const CollideQuery * query,
+                                       float x, float y, float size)
+{
+    unsigned char flags = 0;
+    if (query->x < (x + size + query->radius) &&
+        query->x > (x - query->radius) &&
+        query->y < (y + size + query->radius) &&
+        query->y > (y - query->radius)) {
+        flags |= COLLIDE_FOOTPRINT;
+        if (query->z < size) {
+            if (query->y < (y + size) && query->y > (y)) {
+                flags |= COLLIDE_Y;
+            }
+            if (query->x < (x + size) && query->x > (x)) {
+                flags |= COLLIDE_X;
+            }
+        }
+    }
+    if (sqrt(square(query->x - (x + size / 2)) +
+             square(query->y - (y + size / 2)) +
+             square(query->z + query->radius - (size / 2))) <
+        (query->radius + size / 2)) {
+        flags |= COLLIDE_SPHERE;
+    }
+    return flags;
+}
+
+static void test_range(CollideBatch * batch, const CollideQuery * query,
+                       unsigned int begin)
+{
+    unsigned int c;
+    for (c = begin; c < batch->count; ++c) {
+        unsigned char flags = test_block(query, batch->x[c], batch->y[c],
+                                         batch->size[c]);
+        if (flags != 0) {
+            add_hit(batch, c, flags);
+        }
+    }
+}
+
+static void test_scalar(CollideBatch * batch, const CollideQuery * query)
+{
+    test_range(batch, query, 0);
+}
+
+#ifdef COLLIDE_X86
+
+// Record the hits among a group of lanes, given the mask of lanes passing
+// each test.
+static inline void add_lanes(CollideBatch * batch,
+                             const CollideQuery * query, unsigned int c,
+                             int footprint, int col_x, int col_y,
+                             int sphere, int tie)
+{
+    int lanes = footprint | sphere | tie;
+    while (lanes != 0) {
+        int l = __builtin_ctz(lanes);
+        lanes &= lanes - 1;
+        unsigned char flags = 0;
+        if (footprint & (1 << l)) {
+            flags |= COLLIDE_FOOTPRINT;
+        }
+        if (col_x & (1 << l)) {
+            flags |= COLLIDE_X;
+        }
+        if (col_y & (1 << l)) {
+            flags |= COLLIDE_Y;
+        }
+        if (sphere & (1 << l)) {
+            flags |= COLLIDE_SPHERE;
+        } else if (tie & (1 << l)) {
+            flags |= test_block(query, batch->x[c + l], batch->y[c + l],
+                                batch->size[c + l]) & COLLIDE_SPHERE;
+        }
+        if (flags != 0) {
+            add_hit(batch, c + l, flags);
+        }
+    }
+}
+
+static int has_sse2()
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse2");
+}
+
+__attribute__((target("sse2")))
+static void test_sse2(CollideBatch * batch, const CollideQuery * query)
+{
+    const __m128 px = _mm_set1_ps(query->x);
+    const __m128 py = _mm_set1_ps(query->y);
+    const __m128 pz = _mm_set1_ps(query->z);
+    const __m128 radius = _mm_set1_ps(query->radius);
+    const __m128 lift = _mm_set1_ps(query->z + query->radius);
+    const __m128 half = _mm_set1_ps(0.5f);
+    unsigned int c;
+
+    for (c = 0; c + 4 <= batch->count; c += 4) {
+        __m128 x = _mm_loadu_ps(batch->x + c);
+        __m128 y = _mm_loadu_ps(batch->y + c);
+        __m128 size = _mm_loadu_ps(batch->size + c);
+        __m128 right = _mm_add_ps(x, size);
+        __m128 top = _mm_add_ps(y, size);
+
+        __m128 footprint = _mm_and_ps(
+            _mm_and_ps(_mm_cmplt_ps(px, _mm_add_ps(right, radius)),
+                       _mm_cmpgt_ps(px, _mm_sub_ps(x, radius))),
+            _mm_and_ps(_mm_cmplt_ps(py, _mm_add_ps(top, radius)),
+                       _mm_cmpgt_ps(py, _mm_sub_ps(y, radius))));
+        __m128 below = _mm_and_ps(footprint, _mm_cmplt_ps(pz, size));
+        __m128 col_x = _mm_and_ps(below,
+                                  _mm_and_ps(_mm_cmplt_ps(px, right),
+                                             _mm_cmpgt_ps(px, x)));
+        __m128 col_y = _mm_and_ps(below,
+                                  _mm_and_ps(_mm_cmplt_ps(py, top),
+                                             _mm_cmpgt_ps(py, y)));
+
+        __m128 half_size = _mm_mul_ps(size, half);
+        __m128 dx = _mm_sub_ps(px, _mm_add_ps(x, half_size));
+        __m128 dy = _mm_sub_ps(py, _mm_add_ps(y, half_size));
+        __m128 dz = _mm_sub_ps(lift, half_size);
+        __m128 distance = _mm_sqrt_ps(
+            _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)),
+                       _mm_mul_ps(dz, dz)));
+        __m128 reach = _mm_add_ps(radius, half_size);
+
+        add_lanes(batch, query, c,
+                  _mm_movemask_ps(footprint),
+                  _mm_movemask_ps(col_x),
+                  _mm_movemask_ps(col_y),
+                  _mm_movemask_ps(_mm_cmplt_ps(distance, reach)),
+                  _mm_movemask_ps(_mm_cmpeq_ps(distance, reach)));
+    }
+    test_range(batch, query, c);
+}
+
+static int has_avx()
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx");
+}
+
+__attribute__((target("avx")))
+static void test_avx(CollideBatch * batch, const CollideQuery * query)
+{
+    const __m256 px = _mm256_set1_ps(query->x);
+    const __m256 py = _mm256_set1_ps(query->y);
+    const __m256 pz = _mm256_set1_ps(query->z);
+    const __m256 radius = _mm256_set1_ps(query->radius);
+    const __m256 lift = _mm256_set1_ps(query->z + query->radius);
+    const __m256 half = _mm256_set1_ps(0.5f);
+    unsigned int c;
+
+    for (c = 0; c + 8 <= batch->count; c += 8) {
+        __m256 x = _mm256_loadu_ps(batch->x + c);
+        __m256 y = _mm256_loadu_ps(batch->y + c);
+        __m256 size = _mm256_loadu_ps(batch->size + c);
+        __m256 right = _mm256_add_ps(x, size);
+        __m256 top = _mm256_add_ps(y, size);
+
+        __m256 footprint = _mm256_and_ps(
+            _mm256_and_ps(
+                _mm256_cmp_ps(px, _mm256_add_ps(right, radius), _CMP_LT_OQ),
+                _mm256_cmp_ps(px, _mm256_sub_ps(x, radius), _CMP_GT_OQ)),
+            _mm256_and_ps(
+                _mm256_cmp_ps(py, _mm256_add_ps(top, radius), _CMP_LT_OQ),
+                _mm256_cmp_ps(py, _mm256_sub_ps(y, radius), _CMP_GT_OQ)));
+        __m256 below = _mm256_and_ps(footprint,
+                                     _mm256_cmp_ps(pz, size, _CMP_LT_OQ));
+        __m256 col_x = _mm256_and_ps(below, _mm256_and_ps(
+            _mm256_cmp_ps(px, right, _CMP_LT_OQ),
+            _mm256_cmp_ps(px, x, _CMP_GT_OQ)));
+        __m256 col_y = _mm256_and_ps(below, _mm256_and_ps(
+            _mm256_cmp_ps(py, top, _CMP_LT_OQ),
+            _mm256_cmp_ps(py, y, _CMP_GT_OQ)));
+
+        __m256 half_size = _mm256_mul_ps(size, half);
+        __m256 dx = _mm256_sub_ps(px, _mm256_add_ps(x, half_size));
+        __m256 dy = _mm256_sub_ps(py, _mm256_add_ps(y, half_size));
+        __m256 dz = _mm256_sub_ps(lift, half_size);
+        __m256 distance = _mm256_sqrt_ps(_mm256_add_ps(
+            _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)),
+            _mm256_mul_ps(dz, dz)));
+        __m256 reach = _mm256_add_ps(radius, half_size);
+
+        add_lanes(batch, query, c,
+                  _mm256_movemask_ps(footprint),
+                  _mm256_movemask_ps(col_x),
+                  _mm256_movemask_ps(col_y),
+                  _mm256_movemask_ps(_mm256_cmp_ps(distance, reach,
+                                                   _CMP_LT_OQ)),
+                  _mm256_movemask_ps(_mm256_cmp_ps(distance, reach,
+                                                   _CMP_EQ_OQ)));
+    }
+    test_range(batch, query, c);
+}
+
+#endif // COLLIDE_X86
+
+// Every kernel, best first. The last is always supported.
+static const CollideKernelEntry kernels[] = {
+#ifdef COLLIDE_X86
+    { "avx", test_avx, has_avx },
+    { "sse2", test_sse2, has_sse2 },
+#endif
+    { "scalar", test_scalar, 0 }
+};
+#define kernel_count (sizeof(kernels) / sizeof(kernels[0]))
+
+static const CollideKernelEntry * best_kernel()
+{
+    unsigned int k;
+    for (k = 0; k < kernel_count - 1; ++k) {
+        if (kernels[k].supported()) {
+            break;
+        }
+    }
+    return &kernels[k];
+}
+
+// Test every block in the batch against the calamari, and return the
+// number found touching it. The hits are listed in batch order.
+unsigned int collide_batch_test(CollideBatch * batch,
+                                const CollideQuery * query)
+{
+    if (current == 0) {
+        current = best_kernel();
+    }
+    batch->hit_count = 0;
+    current->kernel(batch, query);
+    return batch->hit_count;
+}
+
+const char * collide_kernel_name()
+{
+    if (current == 0) {
+        current = best_kernel();
+    }
+    return current->name;
+}
+
+// Use the named kernel from now on, returning false if there is no such
+// kernel or the processor cannot run it.
+int collide_kernel_select(const char * name)
+{
+    unsigned int k;
+    for (k = 0; k < kernel_count; ++k) {
+        if (strcmp(kernels[k].name, name) == 0) {
+            if (kernels[k].supported != 0 && !kernels[k].supported()) {
+                return 0;
+            }
+            current = &kernels[k];
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,52 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#ifndef COLLIDE_H
+#define COLLIDE_H
+
+#include "blocks.h"
+
+// Ways a block can be touching the calamari, as a set of flags. The
+// calamari is over the footprint of the block, grown by its radius, and
+// below the top of the block within the footprint along x or y, or its
+// sphere overlaps the sphere round the block.
+#define COLLIDE_FOOTPRINT (1 << 0)
+#define COLLIDE_X         (1 << 1)
+#define COLLIDE_Y         (1 << 2)
+#define COLLIDE_SPHERE    (1 << 3)
+
+// Position and radius of the calamari.
+typedef struct collide_query {
+    float x;
+    float y;
+    float z;
+    float radius;
+} CollideQuery;
+
+// Blocks gathered from a store to be tested together, packed so a kernel
+// can test several at once, and the blocks found touching by the last
+// test.
+typedef struct collide_batch {
+    unsigned int * index;
+    float * x;
+    float * y;
+    float * size;
+    unsigned int count;
+    unsigned int capacity;
+
+    unsigned int * hits;
+    unsigned char * flags;
+    unsigned int hit_count;
+} CollideBatch;
+
+void collide_batch_init(CollideBatch * batch);
+void collide_batch_clear(CollideBatch * batch);
+void collide_batch_gather(CollideBatch * batch, const BlockStore * blocks,
+                          const BlockHandle * handles, unsigned int count);
+unsigned int collide_batch_test(CollideBatch * batch,
+                                const CollideQuery * query);
+const char * collide_kernel_name();
+int collide_kernel_select(const char * name);
+
+#endif // COLLIDE_H
@@ -0,0 +1,175 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#include "cull.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+// Extract the planes of the view volume from the combined modelview and
+// projection, so they are in the same coordinates as the objects drawn
+// with that transform.
+void frustum_init(Frustum * frustum, const float modelview_projection[16])
+{
+    const float * m = modelview_projection;
+    int p, i;
+
+    for (p = 0; p < 6; ++p) {
+        // Planes are the sum or difference of the last row and each of the
+        // other three rows in turn.
+        int row = p / 2;
+        float sign = (p % 2) ? -1.f : 1.f;
+        float length = 0.f;
+        for (i = 0; i < 4; ++i) {
+            frustum->planes[p][i] = m[i * 4 + 3] + sign * m[i * 4 + row];
+        }
+        for (i = 0; i < 3; ++i) {
+            length += frustum->planes[p][i] * frustum->planes[p][i];
+        }
+        length = sqrtf(length);
+        for (i = 0; i < 4; ++i) {
+            frustum->planes[p][i] /= length;
+        }
+    }
+}
+
+// Classify an axis aligned box against the view volume.
+FrustumResult frustum_test_box(const Frustum * frustum,
+                               const float min[3], const float max[3])
+{
+    FrustumResult result = FRUSTUM_INSIDE;
+    int p;
+
+    for (p = 0; p < 6; ++p) {
+        const float * plane = frustum->planes[p];
+        // The corners of the box furthest along and furthest against the
+        // plane normal.
+        float least = plane[3], most = plane[3];
+        int i;
+        for (i = 0; i < 3; ++i) {
+            if (plane[i] > 0.f) {
+                most += plane[i] * max[i];
+                least += plane[i] * min[i];
+            } else {
+                most += plane[i] * min[i];
+                least += plane[i] * max[i];
+            }
+        }
+        if (most < 0.f) {
+            return FRUSTUM_OUTSIDE;
+        }
+        if (least < 0.f) {
+            result = FRUSTUM_INTERSECT;
+        }
+    }
+    return result;
+}
+
+void visible_blocks_clear(VisibleBlocks * visible)
+{
+    free(visible->indices);
+    memset(visible, 0, sizeof(VisibleBlocks));
+}
+
+static inline void add_visible(VisibleBlocks * visible, unsigned int index)
+{
+    if (visible->count == visible->capacity) {
+        visible->capacity = visible->capacity ? visible->capacity * 2 : 256;
+        visible->indices = realloc(visible->indices,
+                                   visible->capacity * sizeof(unsigned int));
+        assert(visible->indices != 0);
+    }
+    visible->indices[visible->count++] = index;
+}
+
+void cull_stats_reset(CullStats * stats)
+{
+    memset(stats, 0, sizeof(CullStats));
+}
+
+// Add the blocks starting in one cell of the index to the visible set. If
+// test is true the cell is only partly in view, so each block is checked.
+static void cull_cell(const Frustum * frustum, Tier * tier, int cx, int cy,
+                      int test, VisibleBlocks * visible)
+{
+    BlockStore * blocks = &tier->blocks;
+    unsigned int found = spatial_hash_query_cell(&tier->index, cx, cy);
+    unsigned int c;
+
+    for (c = 0; c < found; ++c) {
+        int i = block_store_index(blocks, tier->index.results[c]);
+        assert(i >= 0 && (unsigned int)i < blocks->ground);
+        if (test) {
+            float size = blocks->scale[i];
+            float min[3] = { blocks->x[i], blocks->y[i], 0.f };
+            float max[3] = { min[0] + size, min[1] + size, size };
+            if (frustum_test_box(frustum, min, max) == FRUSTUM_OUTSIDE) {
+                continue;
+            }
+        }
+        add_visible(visible, i);
+    }
+}
+
+// Cull a rectangle of cells from x0, y0 to x1, y1 inclusive. A block is
+// only found through the cell where its footprint starts, so the box
+// tested is extended by the size of the largest block in the tier to
+// cover everything that could start in the rectangle. Rectangles which
+// are partly in view are split in half until single cells are reached.
+static void cull_cells(const Frustum * frustum, Tier * tier,
+                       int x0, int y0, int x1, int y1,
+                       VisibleBlocks * visible, CullStats * stats)
+{
+    const float cell_size = tier->index.cell_size;
+    const float min[3] = { x0 * cell_size, y0 * cell_size, 0.f };
+    const float max[3] = { (x1 + 1) * cell_size + tier->max_size,
+                           (y1 + 1) * cell_size + tier->max_size,
+                           tier->max_size };
+    int cx, cy;
+
+    switch (frustum_test_box(frustum, min, max)) {
+        case FRUSTUM_OUTSIDE:
+            stats->cells_culled += (x1 - x0 + 1) * (y1 - y0 + 1);
+            return;
+        case FRUSTUM_INSIDE:
+            for (cx = x0; cx <= x1; ++cx) {
+                for (cy = y0; cy <= y1; ++cy) {
+                    cull_cell(frustum, tier, cx, cy, 0, visible);
+                }
+            }
+            return;
+        case FRUSTUM_INTERSECT:
+            break;
+    }
+
+    if (x0 == x1 && y0 == y1) {
+        cull_cell(frustum, tier, x0, y0, 1, visible);
+    } else if (x1 - x0 >= y1 - y0) {
+        int mid = x0 + (x1 - x0) / 2;
+        cull_cells(frustum, tier, x0, y0, mid, y1, visible, stats);
+        cull_cells(frustum, tier, mid + 1, y0, x1, y1, visible, stats);
+    } else {
+        int mid = y0 + (y1 - y0) / 2;
+        cull_cells(frustum, tier, x0, y0, x1, mid, visible, stats);
+        cull_cells(frustum, tier, x0, mid + 1, x1, y1, visible, stats);
+    }
+}
+
+// Find the ground blocks of a tier which may be in view, using the index
+// of the tier to reject whole regions at once.
+void cull_tier(const Frustum * frustum, Tier * tier,
+               VisibleBlocks * visible, CullStats * stats)
+{
+    const SpatialHash * index = &tier->index;
+
+    visible->count = 0;
+    if (index->min_x <= index->max_x && index->min_y <= index->max_y) {
+        cull_cells(frustum, tier, index->min_x, index->min_y,
+                   index->max_x, index->max_y, visible, stats);
+    }
+    stats->blocks_drawn += visible->count;
+    stats->blocks_culled += tier->blocks.ground - visible->count;
+}
@@ -0,0 +1,47 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#ifndef CULL_H
+#define CULL_H
+
+#include "tier.h"
+
+// The six planes bounding the view volume, each stored as a, b, c, d with
+// the normal pointing inwards, so a point is inside a plane if
+// ax + by + cz + d >= 0.
+typedef struct frustum {
+    float planes[6][4];
+} Frustum;
+
+typedef enum frustum_result {
+    FRUSTUM_OUTSIDE,
+    FRUSTUM_INTERSECT,
+    FRUSTUM_INSIDE
+} FrustumResult;
+
+// Packed indices of the ground blocks in a store found to be in view.
+typedef struct visible_blocks {
+    unsigned int * indices;
+    unsigned int count;
+    unsigned int capacity;
+} VisibleBlocks;
+
+// Counts of the work done by culling in one frame.
+typedef struct cull_stats {
+    unsigned int cells_culled;
+    unsigned int blocks_culled;
+    unsigned int blocks_drawn;
+} CullStats;
+
+void frustum_init(Frustum * frustum, const float modelview_projection[16]);
+FrustumResult frustum_test_box(const Frustum * frustum,
+                               const float min[3], const float max[3]);
+
+void visible_blocks_clear(VisibleBlocks * visible);
+
+void cull_stats_reset(CullStats * stats);
+void cull_tier(const Frustum * frustum, Tier * tier,
+               VisibleBlocks * visible, CullStats * stats);
+
+#endif // CULL_H
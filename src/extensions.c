@@ -0,0 +1,103 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#include "extensions.h"
+
+#include "logger.h"
+
+#include <SDL.h>
+
+#include <stdio.h>
+
+PFNGLGENBUFFERSPROC ext_glGenBuffers;
+PFNGLDELETEBUFFERSPROC ext_glDeleteBuffers;
+PFNGLBINDBUFFERPROC ext_glBindBuffer;
+PFNGLBUFFERDATAPROC ext_glBufferData;
+PFNGLBUFFERSUBDATAPROC ext_glBufferSubData;
+PFNGLCREATESHADERPROC ext_glCreateShader;
+PFNGLDELETESHADERPROC ext_glDeleteShader;
+PFNGLSHADERSOURCEPROC ext_glShaderSource;
+PFNGLCOMPILESHADERPROC ext_glCompileShader;
+PFNGLGETSHADERIVPROC ext_glGetShaderiv;
+PFNGLGETSHADERINFOLOGPROC ext_glGetShaderInfoLog;
+PFNGLCREATEPROGRAMPROC ext_glCreateProgram;
+PFNGLATTACHSHADERPROC ext_glAttachShader;
+PFNGLBINDATTRIBLOCATIONPROC ext_glBindAttribLocation;
+PFNGLLINKPROGRAMPROC ext_glLinkProgram;
+PFNGLGETPROGRAMIVPROC ext_glGetProgramiv;
+PFNGLGETPROGRAMINFOLOGPROC ext_glGetProgramInfoLog;
+PFNGLUSEPROGRAMPROC ext_glUseProgram;
+PFNGLGETUNIFORMLOCATIONPROC ext_glGetUniformLocation;
+PFNGLUNIFORM1IPROC ext_glUniform1i;
+PFNGLUNIFORM1FPROC ext_glUniform1f;
+PFNGLUNIFORM3FVPROC ext_glUniform3fv;
+PFNGLUNIFORMMATRIX4FVPROC ext_glUniformMatrix4fv;
+PFNGLENABLEVERTEXATTRIBARRAYPROC ext_glEnableVertexAttribArray;
+PFNGLDISABLEVERTEXATTRIBARRAYPROC ext_glDisableVertexAttribArray;
+PFNGLVERTEXATTRIBPOINTERPROC ext_glVertexAttribPointer;
+PFNGLACTIVETEXTUREPROC ext_glActiveTexture;
+PFNGLTEXBUFFERPROC ext_glTexBuffer;
+PFNGLDRAWARRAYSINSTANCEDPROC ext_glDrawArraysInstanced;
+
+static int loaded;
+
+static void * lookup(const char * name)
+{
+    void * proc = SDL_GL_GetProcAddress(name);
+    if (proc == NULL) {
+        log_error(LOG_GRAPHICS, "Missing OpenGL function %s", name);
+        loaded = 0;
+    }
+    return proc;
+}
+
+#define LOOKUP(name) ext_##name = lookup(#name)
+
+// Look up all the entry points. This must be called once a context has
+// been created, and returns true if the context is OpenGL 3.1 or later,
+// and every function was found.
+int extensions_init()
+{
+    int major = 0, minor = 0;
+    const char * version = (const char *)glGetString(GL_VERSION);
+    if (version == NULL || sscanf(version, "%d.%d", &major, &minor) != 2 ||
+        major < 3 || (major == 3 && minor < 1)) {
+        log_warning(LOG_GRAPHICS, "OpenGL 3.1 is not available");
+        return 0;
+    }
+
+    loaded = 1;
+
+    LOOKUP(glGenBuffers);
+    LOOKUP(glDeleteBuffers);
+    LOOKUP(glBindBuffer);
+    LOOKUP(glBufferData);
+    LOOKUP(glBufferSubData);
+    LOOKUP(glCreateShader);
+    LOOKUP(glDeleteShader);
+    LOOKUP(glShaderSource);
+    LOOKUP(glCompileShader);
+    LOOKUP(glGetShaderiv);
+    LOOKUP(glGetShaderInfoLog);
+    LOOKUP(glCreateProgram);
+    LOOKUP(glAttachShader);
+    LOOKUP(glBindAttribLocation);
+    LOOKUP(glLinkProgram);
+    LOOKUP(glGetProgramiv);
+    LOOKUP(glGetProgramInfoLog);
+    LOOKUP(glUseProgram);
+    LOOKUP(glGetUniformLocation);
+    LOOKUP(glUniform1i);
+    LOOKUP(glUniform1f);
+    LOOKUP(glUniform3fv);
+    LOOKUP(glUniformMatrix4fv);
+    LOOKUP(glEnableVertexAttribArray);
+    LOOKUP(glDisableVertexAttribArray);
+    LOOKUP(glVertexAttribPointer);
+    LOOKUP(glActiveTexture);
+    LOOKUP(glTexBuffer);
+    LOOKUP(glDrawArraysInstanced);
+
+    return loaded;
+}
@@ -0,0 +1,76 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#ifndef EXTENSIONS_H
+#define EXTENSIONS_H
+
+#include <SDL_opengl.h>
+
+// Entry points for OpenGL functions beyond 1.1, which must be looked up
+// at runtime. The GL names are defined to the pointers, so code can call
+// them as normal once extensions_init() has succeeded.
+
+extern PFNGLGENBUFFERSPROC ext_glGenBuffers;
+extern PFNGLDELETEBUFFERSPROC ext_glDeleteBuffers;
+extern PFNGLBINDBUFFERPROC ext_glBindBuffer;
+extern PFNGLBUFFERDATAPROC ext_glBufferData;
+extern PFNGLBUFFERSUBDATAPROC ext_glBufferSubData;
+extern PFNGLCREATESHADERPROC ext_glCreateShader;
+extern PFNGLDELETESHADERPROC ext_glDeleteShader;
+extern PFNGLSHADERSOURCEPROC ext_glShaderSource;
+extern PFNGLCOMPILESHADERPROC ext_glCompileShader;
+extern PFNGLGETSHADERIVPROC ext_glGetShaderiv;
+extern PFNGLGETSHADERINFOLOGPROC ext_glGetShaderInfoLog;
+extern PFNGLCREATEPROGRAMPROC ext_glCreateProgram;
+extern PFNGLATTACHSHADERPROC ext_glAttachShader;
+extern PFNGLBINDATTRIBLOCATIONPROC ext_glBindAttribLocation;
+extern PFNGLLINKPROGRAMPROC ext_glLinkProgram;
+extern PFNGLGETPROGRAMIVPROC ext_glGetProgramiv;
+extern PFNGLGETPROGRAMINFOLOGPROC ext_glGetProgramInfoLog;
+extern PFNGLUSEPROGRAMPROC ext_glUseProgram;
+extern PFNGLGETUNIFORMLOCATIONPROC ext_glGetUniformLocation;
+extern PFNGLUNIFORM1IPROC ext_glUniform1i;
+extern PFNGLUNIFORM1FPROC ext_glUniform1f;
+extern PFNGLUNIFORM3FVPROC ext_glUniform3fv;
+extern PFNGLUNIFORMMATRIX4FVPROC ext_glUniformMatrix4fv;
+extern PFNGLENABLEVERTEXATTRIBARRAYPROC ext_glEnableVertexAttribArray;
+extern PFNGLDISABLEVERTEXATTRIBARRAYPROC ext_glDisableVertexAttribArray;
+extern PFNGLVERTEXATTRIBPOINTERPROC ext_glVertexAttribPointer;
+extern PFNGLACTIVETEXTUREPROC ext_glActiveTexture;
+extern PFNGLTEXBUFFERPROC ext_glTexBuffer;
+extern PFNGLDRAWARRAYSINSTANCEDPROC ext_glDrawArraysInstanced;
+
+#define glGenBuffers ext_glGenBuffers
+#define glDeleteBuffers ext_glDeleteBuffers
+#define glBindBuffer ext_glBindBuffer
+#define glBufferData ext_glBufferData
+#define glBufferSubData ext_glBufferSubData
+#define glCreateShader ext_glCreateShader
+#define glDeleteShader ext_glDeleteShader
+#define glShaderSource ext_glShaderSource
+#define glCompileShader ext_glCompileShader
+#define glGetShaderiv ext_glGetShaderiv
+#define glGetShaderInfoLog ext_glGetShaderInfoLog
+#define glCreateProgram ext_glCreateProgram
+#define glAttachShader ext_glAttachShader
+#define glBindAttribLocation ext_glBindAttribLocation
+#define glLinkProgram ext_glLinkProgram
+#define glGetProgramiv ext_glGetProgramiv
+#define glGetProgramInfoLog ext_glGetProgramInfoLog
+#define glUseProgram ext_glUseProgram
+#define glGetUniformLocation ext_glGetUniformLocation
+#define glUniform1i ext_glUniform1i
+#define glUniform1f ext_glUniform1f
+#define glUniform3fv ext_glUniform3fv
+#define glUniformMatrix4fv ext_glUniformMatrix4fv
+#define glEnableVertexAttribArray ext_glEnableVertexAttribArray
+#define glDisableVertexAttribArray ext_glDisableVertexAttribArray
+#define glVertexAttribPointer ext_glVertexAttribPointer
+#define glActiveTexture ext_glActiveTexture
+#define glTexBuffer ext_glTexBuffer
+#define glDrawArraysInstanced ext_glDrawArraysInstanced
+
+int extensions_init();
+
+#endif // EXTENSIONS_H
@@ -0,0 +1,1200 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+// The font texture, packed as runs of 4 bit alpha values. Each byte holds
+// a value in its high 4 bits, and one less than the length of the run in
+// its low 4 bits. If the low 4 bits are all set, the next byte is added
+// to the length, so one run can cover most of a row.
+
+#include "font.h"
+
+#include <string.h>
+
+const unsigned int font_packed_size = 13892;
+
+const unsigned char font_packed[] = {
+    0x0f, 0xff, 0x0f, 0x62, 0x10, 0xf5, 0x30, 0x0f, 0x58, 0x20, 0xe0, 0xf0,
+    0xc0, 0x60, 0x0f, 0x7c, 0x71, 0x80, 0xf1, 0x80, 0x20, 0x0f, 0x2b, 0x10,
+    0x0f, 0x1d, 0x60, 0x70, 0xa0, 0xf0, 0x60, 0x0a, 0x10, 0xf7, 0x10, 0x05,
+    0x30, 0xd0, 0xf0, 0xc0, 0x70, 0x40, 0xc0, 0xf0, 0xe0, 0xa0, 0x10, 0x04,
+    0xc0, 0xf1, 0x20, 0x70, 0xf4, 0x10, 0x06, 0x30, 0xa0, 0xf1, 0xb0, 0x60,
+    0x09, 0x30, 0xa0, 0xf1, 0xb0, 0x60, 0x09, 0x30, 0xa0, 0xf1, 0xb0, 0x60,
+    0x09, 0x20, 0xb0, 0xf0, 0xd0, 0xb0, 0xf1, 0x40, 0x07, 0x20, 0xb0, 0xf0,
+    0xd0, 0xb0, 0xf1, 0x40, 0x08, 0xa0, 0xf0, 0xc0, 0x0b, 0x10, 0x90, 0xf1,
+    0xa0, 0x40, 0x09, 0x70, 0xd0, 0xf0, 0xe0, 0x90, 0x10, 0x07, 0x50, 0xc0,
+    0xa0, 0xe0, 0xf0, 0xe0, 0xa0, 0x50, 0x08, 0x10, 0xb0, 0xf3, 0xd0, 0x60,
+    0x06, 0x40, 0x91, 0xe0, 0xf0, 0xe0, 0x90, 0x20, 0x08, 0x30, 0x90, 0x10,
+    0x00, 0x10, 0xa0, 0x30, 0x0a, 0xc0, 0xd0, 0x0b, 0x70, 0xb0, 0xe0, 0x72,
+    0x90, 0xf0, 0x40, 0x05, 0x70, 0xf0, 0x80, 0x90, 0xe0, 0xf1, 0x80, 0x70,
+    0xa0, 0x05, 0x60, 0xe0, 0xc0, 0x20, 0x40, 0xf0, 0x90, 0x70, 0x80, 0xf0,
+    0x50, 0x05, 0x10, 0xe0, 0xf0, 0x80, 0x70, 0xb0, 0xf0, 0x90, 0x07, 0x10,
+    0xe0, 0xf0, 0x80, 0x70, 0xb0, 0xf0, 0x90, 0x07, 0x10, 0xe0, 0xf0, 0x80,
+    0x70, 0xb0, 0xf0, 0x90, 0x08, 0x70, 0xf0, 0xa0, 0x90, 0xf1, 0x90, 0x40,
+    0x07, 0x70, 0xf0, 0xa0, 0x90, 0xf1, 0x90, 0x40, 0x08, 0x80, 0xf1, 0x90,
+    0x0a, 0xb0, 0xf0, 0x90, 0x70, 0xc0, 0xf0, 0x60, 0x07, 0x30, 0xf0, 0xd0,
+    0x70, 0x80, 0xe0, 0xc0, 0x07, 0x20, 0xf1, 0xe0, 0x71, 0xc0, 0xf0, 0x90,
+    0x08, 0x10, 0xe0, 0xd0, 0x70, 0x80, 0x90, 0x60, 0x07, 0xd0, 0xf0, 0xd0,
+    0x70, 0x80, 0xd0, 0xe0, 0x60, 0x07, 0x50, 0xe0, 0xc0, 0x20, 0xa0, 0xf0,
+    0x70, 0x0a, 0x60, 0xf0, 0x50, 0x0b, 0x70, 0xf0, 0x10, 0x02, 0xf0, 0x70,
+    0x05, 0x60, 0xf0, 0x60, 0x00, 0x10, 0xe0, 0x90, 0x09, 0x70, 0xf3, 0x70,
+    0x01, 0xe0, 0x70, 0x05, 0x40, 0xf0, 0x60, 0x02, 0x60, 0xf0, 0x60, 0x06,
+    0x40, 0xf0, 0x60, 0x02, 0x60, 0xf0, 0x60, 0x06, 0x40, 0xf0, 0x60, 0x02,
+    0x60, 0xf0, 0x60, 0x07, 0x70, 0xf0, 0x10, 0x00, 0x30, 0xf0, 0x70, 0x08,
+    0x70, 0xf0, 0x10, 0x00, 0x30, 0xf0, 0x70, 0x09, 0xc0, 0xf0, 0xd0, 0xf0,
+    0x70, 0x09, 0xf0, 0x90, 0x02, 0x90, 0xe0, 0x20, 0x06, 0x40, 0xf0, 0x40,
+    0x01, 0x30, 0xf0, 0x60, 0x06, 0x40, 0xf0, 0xa0, 0xf0, 0xc0, 0x30, 0x00,
+    0x60, 0xf0, 0x50, 0x08, 0x70, 0xf0, 0x10, 0x0a, 0xf0, 0xe1, 0x30, 0x00,
+    0x10, 0x90, 0xe0, 0x20, 0x07, 0x30, 0xd0, 0xf1, 0xa0, 0x0b, 0x10, 0xe0,
+    0x90, 0x0b, 0x30, 0xf0, 0x90, 0x70, 0xe0, 0xa0, 0x60, 0x50, 0x06, 0x90,
+    0xf7, 0x90, 0x06, 0xd1, 0x40, 0xc0, 0xb0, 0x90, 0xb0, 0x61, 0x05, 0x30,
+    0xf0, 0x50, 0x03, 0xc0, 0xa0, 0x06, 0x30, 0xf0, 0x50, 0x03, 0xc0, 0xa0,
+    0x06, 0x30, 0xf0, 0x50, 0x03, 0xc0, 0xa0, 0x07, 0x30, 0xf0, 0x40, 0x01,
+    0xb0, 0xa0, 0x08, 0x30, 0xf0, 0x40, 0x01, 0xb0, 0xa0, 0x08, 0x20, 0xf0,
+    0xe0, 0x10, 0x90, 0xf0, 0x50, 0x07, 0x10, 0xf0, 0x70, 0x02, 0x10, 0xd0,
+    0x90, 0x06, 0x30, 0xf0, 0x40, 0x02, 0xc0, 0xa0, 0x06, 0x30, 0xf0, 0x50,
+    0x30, 0xc0, 0xf0, 0x70, 0x00, 0xc0, 0xa0, 0x07, 0x40, 0x70, 0xf0, 0x70,
+    0x41, 0x07, 0x10, 0xf0, 0x70, 0x90, 0xe0, 0x50, 0x00, 0x10, 0xe0, 0x90,
+    0x08, 0x50, 0xf1, 0x70, 0x0c, 0x90, 0xf0, 0x10, 0x0b, 0xf3, 0xd0, 0x09,
+    0x30, 0x71, 0xc0, 0xf0, 0x80, 0x70, 0xb0, 0xd0, 0x06, 0x60, 0xf0, 0x40,
+    0x80, 0xf2, 0x08, 0xd0, 0xc0, 0x10, 0x02, 0xd0, 0xb0, 0x07, 0xd0, 0xc0,
+    0x10, 0x02, 0xd0, 0xb0, 0x07, 0xd0, 0xc0, 0x10, 0x02, 0xd0, 0xb0, 0x08,
+    0xf0, 0x70, 0x01, 0x80, 0xd0, 0x09, 0xf0, 0x70, 0x01, 0x80, 0xd0, 0x08,
+    0x60, 0xf0, 0x70, 0x01, 0xa0, 0xe0, 0x30, 0x07, 0xf0, 0x70, 0x03, 0x80,
+    0xd0, 0x07, 0xf0, 0x70, 0x02, 0x80, 0xd0, 0x07, 0xd0, 0xc0, 0x10, 0x00,
+    0x70, 0xf0, 0xc0, 0xe0, 0xb0, 0x07, 0xe0, 0xf4, 0x40, 0x07, 0xf0, 0x70,
+    0x00, 0x60, 0xf0, 0x60, 0x00, 0x80, 0xd0, 0x07, 0x20, 0xe1, 0xa0, 0xf0,
+    0x80, 0x0b, 0x30, 0xf0, 0x70, 0x0b, 0xb0, 0xa0, 0x00, 0x60, 0xf0, 0x50,
+    0xb0, 0x20, 0x05, 0x40, 0xc0, 0x71, 0xb0, 0xf0, 0xd0, 0x70, 0xe0, 0xc0,
+    0x07, 0xd0, 0xb0, 0x60, 0xf0, 0x20, 0xf0, 0x80, 0x20, 0x06, 0x30, 0xe1,
+    0x80, 0x70, 0xd0, 0xf0, 0x70, 0x07, 0x30, 0xe1, 0x80, 0x70, 0xd0, 0xf0,
+    0x70, 0x07, 0x30, 0xe1, 0x80, 0x70, 0xd0, 0xf0, 0x70, 0x07, 0x70, 0xd0,
+    0xa0, 0x00, 0x50, 0xb0, 0xf0, 0x20, 0x07, 0x70, 0xd0, 0xa0, 0x00, 0x50,
+    0xb0, 0xf0, 0x20, 0x06, 0x60, 0xb0, 0xf0, 0x70, 0x01, 0x30, 0xf0, 0xd0,
+    0x70, 0x20, 0x05, 0xa0, 0xd0, 0x03, 0x70, 0xf0, 0x07, 0xb0, 0xa0, 0x02,
+    0x60, 0xf0, 0x20, 0x06, 0x30, 0xe1, 0x90, 0x70, 0xa0, 0xf1, 0x80, 0x08,
+    0xb1, 0x0b, 0x90, 0xd0, 0x01, 0x50, 0xe0, 0x90, 0x70, 0xf0, 0x07, 0x70,
+    0xf0, 0x60, 0x00, 0x60, 0xf0, 0x70, 0x09, 0x50, 0xf3, 0x60, 0x09, 0x80,
+    0xe0, 0x02, 0x30, 0xf0, 0x50, 0x05, 0x20, 0x90, 0xd0, 0xf1, 0x80, 0xa0,
+    0xf0, 0xe0, 0x50, 0x07, 0x60, 0xf0, 0x60, 0xf0, 0x50, 0x00, 0x80, 0x70,
+    0x07, 0x20, 0x90, 0xd0, 0xf0, 0xd0, 0x70, 0x09, 0x20, 0x90, 0xd0, 0xf0,
+    0xd0, 0x70, 0x09, 0x20, 0x90, 0xd0, 0xf0, 0xd0, 0x70, 0x08, 0xb0, 0xf0,
+    0xe0, 0x00, 0x70, 0xf1, 0x50, 0x07, 0xb0, 0xf0, 0xe0, 0x00, 0x70, 0xf1,
+    0x50, 0x06, 0x80, 0xf1, 0xe0, 0x01, 0x30, 0xf2, 0x50, 0x05, 0x30, 0xf0,
+    0x70, 0x02, 0xb0, 0xe0, 0x07, 0x80, 0xe0, 0x02, 0x20, 0xf0, 0x50, 0x07,
+    0x10, 0x80, 0xc0, 0xf1, 0xc0, 0x90, 0xc0, 0x08, 0x70, 0xe0, 0x01, 0x10,
+    0x50, 0x07, 0x30, 0xf0, 0x90, 0x01, 0x30, 0xe0, 0xf1, 0x08, 0x50, 0x02,
+    0x40, 0x10, 0x0a, 0x70, 0x90, 0xf0, 0xa0, 0x50, 0x08, 0x40, 0xa0, 0xf0,
+    0x73, 0xf0, 0x70, 0x0f, 0x08, 0x60, 0xf0, 0xc0, 0xf0, 0xb0, 0x70, 0xb0,
+    0x80, 0x07, 0x10, 0x70, 0x02, 0x50, 0x40, 0x0f, 0x0c, 0x20, 0x40, 0x10,
+    0x0a, 0x50, 0x02, 0x30, 0x10, 0x0b, 0x30, 0x40, 0x0f, 0x0b, 0x60, 0xf0,
+    0xb0, 0x70, 0xb0, 0xf0, 0x90, 0x06, 0x30, 0xa0, 0xf0, 0x70, 0x60, 0x30,
+    0x70, 0xf0, 0xb0, 0x50, 0x0f, 0x08, 0x20, 0xe0, 0xb0, 0x70, 0xb0, 0xf0,
+    0x60, 0x07, 0x60, 0xf0, 0xd0, 0x80, 0x70, 0xd0, 0xf0, 0xc0, 0x0f, 0x0b,
+    0x10, 0xd1, 0x71, 0x10, 0x06, 0x50, 0xf6, 0xb0, 0x0f, 0x08, 0x80, 0xf5,
+    0xc0, 0x08, 0x70, 0xd0, 0x40, 0x70, 0xe0, 0x30, 0x09, 0xe0, 0x90, 0x00,
+    0x20, 0xe0, 0x80, 0x0a, 0x30, 0xe0, 0x80, 0x0b, 0x70, 0xd0, 0x50, 0x70,
+    0xe0, 0x30, 0x0a, 0x40, 0xf0, 0x60, 0x0b, 0xe0, 0x90, 0x20, 0xe0, 0x80,
+    0x0a, 0x40, 0xa0, 0xf0, 0xe0, 0x90, 0x10, 0x06, 0x30, 0xf2, 0xc0, 0x40,
+    0xf2, 0xc0, 0x0f, 0x09, 0x30, 0xa0, 0xf0, 0xe0, 0x80, 0x09, 0x30, 0xa0,
+    0xe0, 0xf0, 0xd0, 0x91, 0x40, 0x0f, 0x0b, 0x30, 0xa0, 0xf1, 0x70, 0x0a,
+    0x41, 0x10, 0x0f, 0x1c, 0x40, 0xe0, 0xf0, 0x30, 0x0a, 0x90, 0xc0, 0x01,
+    0xb0, 0x90, 0x09, 0x30, 0xe0, 0xd0, 0x10, 0x0c, 0x30, 0xd0, 0xf0, 0x50,
+    0x0a, 0x30, 0xe0, 0xa0, 0x0c, 0x90, 0xc0, 0x00, 0xb0, 0x90, 0x0a, 0xa0,
+    0xc0, 0x01, 0xc0, 0xb0, 0x09, 0xa0, 0xc0, 0x00, 0xc0, 0xb0, 0x0f, 0x4d,
+    0x20, 0xc1, 0x20, 0x0f, 0x7a, 0x70, 0xe0, 0x20, 0x00, 0x70, 0xd0, 0x09,
+    0x70, 0xe0, 0x20, 0x70, 0xd0, 0x0f, 0x4e, 0x10, 0x90, 0xe0, 0x40, 0x0f,
+    0xff, 0x0f, 0xd9, 0x40, 0xe0, 0xc0, 0x20, 0x0f, 0x5c, 0xc0, 0xd0, 0x20,
+    0x0f, 0x7e, 0x40, 0x70, 0x90, 0x0f, 0x5c, 0x30, 0x60, 0x90, 0x0f, 0x7e,
+    0x50, 0xf0, 0x70, 0x0f, 0x5c, 0x30, 0xf0, 0x70, 0x0f, 0x7c, 0x10, 0x90,
+    0xd0, 0xf0, 0xd0, 0x70, 0x09, 0x20, 0xb0, 0xf0, 0xd0, 0xb0, 0xf1, 0x40,
+    0x07, 0x40, 0xa0, 0xf1, 0xd0, 0x90, 0x40, 0x07, 0x10, 0xb0, 0xf0, 0xe0,
+    0xa1, 0xf1, 0x50, 0x06, 0x10, 0xb0, 0xf0, 0xe0, 0xa1, 0xf1, 0x50, 0x06,
+    0x10, 0xb0, 0xf0, 0xe0, 0xa1, 0xf1, 0x50, 0x06, 0x20, 0xb0, 0xf0, 0xd0,
+    0x90, 0xa0, 0xf1, 0x50, 0x07, 0x50, 0xc0, 0xf0, 0xd0, 0x80, 0x10, 0x09,
+    0x40, 0xa0, 0xf1, 0xd0, 0x90, 0x40, 0x08, 0x40, 0xa0, 0xf1, 0xd0, 0x90,
+    0x40, 0x07, 0x40, 0xa0, 0xf1, 0xd0, 0x90, 0x40, 0x08, 0xe0, 0xf4, 0x80,
+    0x08, 0xe0, 0xf4, 0x80, 0x08, 0xe0, 0xf4, 0x80, 0x07, 0x70, 0xf1, 0xd0,
+    0x00, 0xc0, 0xf2, 0x20, 0x05, 0xc0, 0xf1, 0xd0, 0x00, 0xc0, 0xf2, 0x20,
+    0x07, 0xb0, 0xf0, 0xc0, 0x70, 0x80, 0xe0, 0x50, 0x08, 0x70, 0xf0, 0xa0,
+    0x90, 0xf1, 0x90, 0x40, 0x06, 0x30, 0xf0, 0xb0, 0x72, 0x90, 0xc0, 0x30,
+    0x06, 0x70, 0xf0, 0x90, 0x70, 0xc0, 0xf1, 0x90, 0x40, 0x06, 0x70, 0xf0,
+    0x90, 0x70, 0xc0, 0xf1, 0x90, 0x40, 0x06, 0x70, 0xf0, 0x90, 0x70, 0xc0,
+    0xf1, 0x90, 0x40, 0x06, 0x70, 0xf0, 0x81, 0xd0, 0xf1, 0x90, 0x40, 0x06,
+    0x10, 0xe1, 0x81, 0xd0, 0xe0, 0x40, 0x07, 0x30, 0xf0, 0xb0, 0x72, 0x90,
+    0xc0, 0x30, 0x06, 0x30, 0xf0, 0xc0, 0x72, 0x90, 0xc0, 0x40, 0x05, 0x30,
+    0xf0, 0xb0, 0x72, 0x90, 0xc0, 0x30, 0x07, 0x60, 0x70, 0x90, 0xf0, 0x90,
+    0x70, 0x60, 0x08, 0x60, 0x70, 0x90, 0xf0, 0x90, 0x70, 0x60, 0x08, 0x60,
+    0x70, 0x90, 0xf0, 0x90, 0x70, 0x60, 0x07, 0x40, 0xb0, 0xf0, 0x80, 0x00,
+    0x50, 0xb0, 0xf0, 0x90, 0x20, 0x05, 0x60, 0xb0, 0xf0, 0x80, 0x00, 0x50,
+    0xb0, 0xf0, 0x90, 0x20, 0x07, 0xf0, 0xb0, 0x02, 0x20, 0x10, 0x08, 0x70,
+    0xf0, 0x10, 0x00, 0x30, 0xf0, 0x70, 0x07, 0x70, 0xf6, 0x70, 0x06, 0x60,
+    0xf0, 0x40, 0x01, 0x30, 0xf0, 0x70, 0x07, 0x60, 0xf0, 0x40, 0x01, 0x30,
+    0xf0, 0x70, 0x07, 0x60, 0xf0, 0x40, 0x01, 0x30, 0xf0, 0x70, 0x07, 0x60,
+    0xf0, 0x40, 0x01, 0x40, 0xf0, 0x70, 0x07, 0x40, 0xf0, 0x50, 0x02, 0x70,
+    0x08, 0x70, 0xf6, 0x70, 0x06, 0x70, 0xf6, 0x70, 0x05, 0x70, 0xf6, 0x70,
+    0x0a, 0xf0, 0x70, 0x0d, 0xf0, 0x70, 0x0d, 0xf0, 0x70, 0x0a, 0x20, 0xf5,
+    0x30, 0x07, 0x20, 0xf5, 0x30, 0x07, 0x10, 0xf0, 0x70, 0x0d, 0x30, 0xf0,
+    0x40, 0x01, 0xb0, 0xa0, 0x07, 0x20, 0xf0, 0xb0, 0x73, 0xd0, 0x90, 0x07,
+    0x90, 0xf4, 0xa0, 0x08, 0x90, 0xf4, 0xa0, 0x08, 0x90, 0xf4, 0xa0, 0x08,
+    0x90, 0xf4, 0xa0, 0x07, 0x30, 0xf0, 0x50, 0x0c, 0x20, 0xf0, 0xb0, 0x73,
+    0xd0, 0x90, 0x06, 0x20, 0xf0, 0xb0, 0x73, 0xd0, 0x90, 0x05, 0x20, 0xf0,
+    0xb0, 0x73, 0xd0, 0x90, 0x0a, 0xb0, 0xa0, 0x0d, 0xb0, 0xa0, 0x0d, 0xb0,
+    0xa0, 0x0b, 0x70, 0xf0, 0xb0, 0x70, 0xf1, 0x09, 0x70, 0xf0, 0xb0, 0x70,
+    0xf1, 0x09, 0xf0, 0x70, 0x0e, 0xf0, 0x70, 0x01, 0x80, 0xd0, 0x08, 0xb0,
+    0xe0, 0x30, 0x01, 0x10, 0xe0, 0xb0, 0x08, 0x50, 0x72, 0xb0, 0xd0, 0x09,
+    0x50, 0x72, 0xb0, 0xd0, 0x09, 0x50, 0x72, 0xb0, 0xd0, 0x09, 0x60, 0x72,
+    0xb0, 0xd0, 0x08, 0xd0, 0xb0, 0x02, 0xb0, 0xe0, 0x08, 0xb0, 0xe0, 0x30,
+    0x01, 0x10, 0xe0, 0xb0, 0x07, 0xb0, 0xe0, 0x30, 0x01, 0x10, 0xe0, 0xb0,
+    0x06, 0xb0, 0xe0, 0x30, 0x01, 0x10, 0xe0, 0xb0, 0x0a, 0x80, 0xd0, 0x0d,
+    0x80, 0xd0, 0x0d, 0x80, 0xd0, 0x0b, 0x10, 0xd0, 0xc0, 0x00, 0xf0, 0xc0,
+    0x09, 0x10, 0xd0, 0xc0, 0x00, 0xf0, 0xc0, 0x09, 0xa0, 0xd0, 0x03, 0x70,
+    0x40, 0x07, 0x70, 0xd0, 0xa0, 0x00, 0x50, 0xb0, 0xf0, 0x20, 0x07, 0x20,
+    0xe0, 0xf0, 0x90, 0x70, 0xd0, 0xf0, 0x70, 0x08, 0xf0, 0xb0, 0x71, 0xe0,
+    0xf0, 0x09, 0xf0, 0xb0, 0x71, 0xe0, 0xf0, 0x09, 0xf0, 0xb0, 0x71, 0xe0,
+    0xf0, 0x09, 0xf0, 0x90, 0x70, 0x80, 0xe0, 0xf0, 0x08, 0x30, 0xe0, 0xd0,
+    0x70, 0x80, 0xe0, 0xf0, 0x08, 0x20, 0xe0, 0xf0, 0x90, 0x70, 0xd0, 0xf0,
+    0x70, 0x07, 0x20, 0xe0, 0xf0, 0x90, 0x70, 0xd0, 0xf0, 0x70, 0x06, 0x20,
+    0xe0, 0xf0, 0x90, 0x70, 0xd0, 0xf0, 0x70, 0x08, 0x40, 0x70, 0xb0, 0xf0,
+    0x20, 0x0a, 0x40, 0x70, 0xb0, 0xf0, 0x20, 0x0a, 0x40, 0x70, 0xb0, 0xf0,
+    0x20, 0x0b, 0x60, 0xf0, 0x40, 0xf0, 0x90, 0x0a, 0x60, 0xf0, 0x40, 0xf0,
+    0x90, 0x09, 0x40, 0xf0, 0x90, 0x02, 0xb0, 0x70, 0x07, 0xb0, 0xf0, 0xe0,
+    0x00, 0x70, 0xf1, 0x50, 0x08, 0x10, 0x80, 0xd0, 0xf0, 0xe0, 0x70, 0x08,
+    0x10, 0x70, 0xb0, 0xf1, 0xd0, 0x60, 0x08, 0x10, 0x70, 0xb0, 0xf1, 0xd0,
+    0x60, 0x08, 0x10, 0x70, 0xb0, 0xf1, 0xd0, 0x60, 0x08, 0x10, 0x80, 0xc0,
+    0xf1, 0xd0, 0x60, 0x09, 0x30, 0xa0, 0xe1, 0xb0, 0xf0, 0x50, 0x08, 0x10,
+    0x80, 0xd0, 0xf0, 0xe0, 0x70, 0x09, 0x10, 0x80, 0xd0, 0xf0, 0xe0, 0x70,
+    0x08, 0x10, 0x80, 0xd0, 0xf0, 0xe0, 0x70, 0x09, 0x40, 0xf2, 0x50, 0x0a,
+    0x40, 0xf2, 0x50, 0x0a, 0x40, 0xf2, 0x50, 0x0c, 0xb0, 0xe0, 0xf0, 0x70,
+    0x0b, 0xb0, 0xe0, 0xf0, 0x70, 0x0a, 0x60, 0xf0, 0xd0, 0x70, 0x80, 0xf0,
+    0x90, 0x0f, 0x0b, 0x41, 0x0b, 0x20, 0x60, 0x02, 0x30, 0x40, 0x0f, 0x0c,
+    0x10, 0x40, 0x20, 0x0b, 0xa0, 0xd0, 0xa0, 0x30, 0x0f, 0x0a, 0x20, 0x60,
+    0x02, 0x20, 0x60, 0x0f, 0x0b, 0x20, 0x40, 0x20, 0x0a, 0x30, 0xf0, 0x70,
+    0xe1, 0x50, 0x08, 0x10, 0x40, 0x02, 0x50, 0x0c, 0x31, 0x0b, 0x70, 0xa0,
+    0xf1, 0x40, 0x0a, 0x70, 0xa0, 0xf1, 0x40, 0x0b, 0x40, 0xa0, 0xe0, 0xf0,
+    0xc0, 0xb0, 0x09, 0x50, 0xb0, 0x00, 0x20, 0xe0, 0x80, 0x0a, 0x30, 0xc0,
+    0xb0, 0x20, 0x0a, 0x70, 0xd0, 0x61, 0xe0, 0x50, 0x09, 0xe0, 0x90, 0x00,
+    0x20, 0xe0, 0x80, 0x0a, 0x30, 0xc1, 0x0b, 0x20, 0xd0, 0x00, 0x50, 0xb0,
+    0x0f, 0x0b, 0x80, 0xd0, 0x50, 0x60, 0xe0, 0x60, 0x09, 0xe0, 0x90, 0x00,
+    0x20, 0xe0, 0x80, 0x09, 0x30, 0xe0, 0xc0, 0x0b, 0x10, 0xc0, 0x80, 0x90,
+    0xf0, 0x80, 0x08, 0x20, 0xa0, 0xb0, 0x30, 0x90, 0xc0, 0x10, 0x0a, 0x40,
+    0xf0, 0x40, 0x0b, 0xb0, 0xf2, 0x20, 0x0a, 0xb0, 0xf2, 0x20, 0x0f, 0x0c,
+    0x20, 0xb0, 0x01, 0xb0, 0x90, 0x0b, 0x10, 0xa0, 0xe0, 0x70, 0x0a, 0x40,
+    0xd0, 0xf0, 0x70, 0x0a, 0x90, 0xc0, 0x01, 0xb0, 0x90, 0x09, 0x30, 0xe1,
+    0x20, 0x0c, 0x70, 0xe0, 0xf0, 0x70, 0x0f, 0x0c, 0x40, 0xe0, 0xf0, 0x60,
+    0x0a, 0x90, 0xc0, 0x01, 0xb0, 0x90, 0x08, 0x40, 0xe1, 0x10, 0x0f, 0x0d,
+    0x60, 0xe0, 0xc0, 0x10, 0x0a, 0x30, 0xe0, 0xb0, 0x0d, 0xa0, 0xc0, 0x00,
+    0xc0, 0xb0, 0x0b, 0x60, 0xc0, 0x70, 0x0f, 0xdc, 0x70, 0xe0, 0x20, 0x70,
+    0xd0, 0x0b, 0xa0, 0x50, 0xc0, 0x30, 0x0f, 0xec, 0x30, 0xd0, 0xe0, 0x10,
+    0x0f, 0xb9, 0x10, 0xf0, 0x30, 0x0f, 0xee, 0xc0, 0x70, 0x0f, 0x2b, 0x70,
+    0xf3, 0x50, 0x0d, 0xe0, 0xf2, 0xc0, 0x0f, 0x66, 0x10, 0xf5, 0x30, 0x0f,
+    0x0c, 0x30, 0xc0, 0xf0, 0x40, 0x0b, 0x91, 0x0b, 0x70, 0xe0, 0x90, 0x10,
+    0x0f, 0x1b, 0x20, 0x70, 0xf0, 0xb0, 0x70, 0x40, 0x0d, 0x60, 0x70, 0xb0,
+    0xe0, 0x70, 0x0f, 0x67, 0x71, 0x80, 0xf1, 0x80, 0x20, 0x0f, 0x0c, 0x70,
+    0xf0, 0xa0, 0x40, 0x0b, 0x60, 0xc0, 0x0b, 0x20, 0x80, 0xe0, 0xb0, 0x0f,
+    0x1d, 0xc0, 0xa1, 0xf0, 0xd0, 0x70, 0x09, 0x50, 0xd0, 0xf0, 0xa1, 0xf0,
+    0x10, 0x07, 0x40, 0xf4, 0x70, 0x08, 0x10, 0xe0, 0xb0, 0xd0, 0xf1, 0xa0,
+    0x30, 0x08, 0x20, 0xc0, 0xf0, 0xe0, 0xa0, 0x60, 0x10, 0x08, 0x20, 0xb0,
+    0xf0, 0xd0, 0xb0, 0xf1, 0x40, 0x08, 0x50, 0xf1, 0x70, 0x0a, 0xb0, 0xe0,
+    0x10, 0x00, 0xc0, 0xd0, 0x07, 0xd0, 0xf1, 0xd0, 0x01, 0x90, 0xf2, 0x10,
+    0x07, 0xa0, 0xf0, 0xc0, 0x0a, 0xf6, 0x10, 0x09, 0x70, 0xf0, 0x10, 0x0c,
+    0x30, 0xf0, 0x0d, 0x70, 0xf0, 0x10, 0x0f, 0x1c, 0x90, 0xf0, 0xe0, 0x80,
+    0x90, 0xf0, 0x90, 0x07, 0x10, 0xe1, 0x70, 0x90, 0xf1, 0x40, 0x08, 0x70,
+    0x90, 0xf0, 0x90, 0x70, 0x50, 0x09, 0x90, 0xf0, 0xb0, 0x71, 0xb0, 0xe0,
+    0x20, 0x07, 0x70, 0xf0, 0xa0, 0x70, 0xc0, 0xf0, 0x40, 0x08, 0x70, 0xf0,
+    0xa0, 0x90, 0xf1, 0x90, 0x40, 0x08, 0x80, 0xf2, 0x30, 0x09, 0xb0, 0xe0,
+    0x90, 0x00, 0xf1, 0x60, 0x06, 0x60, 0x90, 0xf0, 0xe0, 0x10, 0x00, 0x60,
+    0xf1, 0x80, 0x20, 0x07, 0x80, 0xf1, 0x90, 0x09, 0x70, 0xf0, 0xe0, 0x71,
+    0x90, 0xf0, 0x40, 0x09, 0x40, 0xf0, 0x40, 0x0d, 0xf0, 0x40, 0x0c, 0x40,
+    0xf0, 0x40, 0x0b, 0x10, 0x0f, 0x0f, 0x70, 0xf0, 0x60, 0x01, 0x50, 0xf0,
+    0x60, 0x06, 0x40, 0xf0, 0x60, 0x01, 0x50, 0xf0, 0x70, 0x0a, 0xf0, 0x70,
+    0x0b, 0x60, 0xb0, 0x20, 0x40, 0x50, 0x80, 0xf0, 0x70, 0x07, 0x70, 0xf0,
+    0x10, 0x01, 0x21, 0x08, 0x70, 0xf0, 0x10, 0x00, 0x30, 0xf0, 0x70, 0x09,
+    0xb0, 0xf0, 0x60, 0xf0, 0xc0, 0x09, 0xb0, 0x80, 0xe0, 0x70, 0xf0, 0x70,
+    0xd0, 0x08, 0x20, 0x90, 0xe0, 0x90, 0xe1, 0x50, 0x09, 0xc0, 0xf0, 0xd0,
+    0xf0, 0x70, 0x09, 0x40, 0xe0, 0xb0, 0x10, 0x00, 0xb0, 0x60, 0x0a, 0xf0,
+    0x70, 0x0d, 0xb0, 0x70, 0x0d, 0xf0, 0x70, 0x0a, 0x10, 0xd0, 0x20, 0x40,
+    0xc0, 0xf0, 0x80, 0x0f, 0x0a, 0x30, 0xf0, 0x40, 0x02, 0xc0, 0xa0, 0x06,
+    0x30, 0xf0, 0x50, 0x02, 0xb0, 0xa0, 0x0a, 0xb0, 0xa0, 0x0c, 0x70, 0xf3,
+    0xe0, 0x20, 0x07, 0x30, 0xf0, 0x40, 0x0c, 0x30, 0xf0, 0x40, 0x01, 0xb0,
+    0xa0, 0x09, 0xf0, 0xe0, 0x00, 0x70, 0xf0, 0x70, 0x08, 0xe0, 0x71, 0xe0,
+    0xf0, 0x10, 0xf0, 0x60, 0x09, 0xd0, 0xf1, 0xe0, 0x10, 0x08, 0x20, 0xf0,
+    0xe0, 0x10, 0x90, 0xf0, 0x50, 0x09, 0x10, 0xc0, 0xe0, 0x40, 0x0b, 0x90,
+    0xf0, 0x70, 0x0d, 0x70, 0xa0, 0x0d, 0x90, 0xe0, 0x80, 0x09, 0x20, 0xc0,
+    0xf1, 0xe0, 0xb0, 0xf0, 0x70, 0x0f, 0x0a, 0xf0, 0xa0, 0x02, 0xd0, 0xb0,
+    0x07, 0xd0, 0xb0, 0x02, 0xc0, 0xd0, 0x0a, 0x80, 0xf0, 0x70, 0x0b, 0xe0,
+    0xc0, 0x60, 0x41, 0x70, 0x60, 0x08, 0xf0, 0x70, 0x0d, 0xf0, 0x70, 0x01,
+    0x80, 0xd0, 0x08, 0x40, 0xf0, 0x90, 0x01, 0xa0, 0xf0, 0x30, 0x07, 0xf0,
+    0x70, 0x10, 0xe1, 0x00, 0x90, 0xd0, 0x08, 0x70, 0xf0, 0x70, 0x90, 0xf0,
+    0xa0, 0x08, 0x60, 0xf0, 0x70, 0x01, 0xa0, 0xe0, 0x30, 0x07, 0x70, 0x40,
+    0x00, 0x80, 0xf0, 0x70, 0x0a, 0xd0, 0xf0, 0x90, 0x0d, 0x50, 0xd0, 0x0d,
+    0x50, 0xf1, 0x30, 0x09, 0x10, 0x80, 0x90, 0x10, 0x00, 0x60, 0x10, 0x0f,
+    0x09, 0x70, 0xd0, 0xf0, 0xd0, 0x70, 0xa0, 0xf0, 0x70, 0x07, 0x30, 0xf0,
+    0xc0, 0x70, 0xb0, 0xf1, 0x70, 0x30, 0x07, 0x70, 0xb0, 0xf1, 0xb1, 0xc0,
+    0x20, 0x07, 0x90, 0xe0, 0x80, 0x70, 0x90, 0xf0, 0xb0, 0x07, 0x60, 0xd0,
+    0xc0, 0x72, 0x40, 0x08, 0x70, 0xd0, 0xa0, 0x00, 0x50, 0xb0, 0xf0, 0x20,
+    0x06, 0x60, 0xb0, 0xf0, 0xa0, 0x20, 0x00, 0x70, 0xf0, 0xc0, 0x70, 0x20,
+    0x04, 0x60, 0xf0, 0xb0, 0x60, 0x70, 0xb0, 0x20, 0xa0, 0xf0, 0x90, 0x20,
+    0x05, 0x60, 0xe0, 0xf0, 0x70, 0x20, 0xe0, 0xf0, 0x90, 0x20, 0x05, 0x60,
+    0xb0, 0xf0, 0x70, 0x01, 0x30, 0xf0, 0xd0, 0x70, 0x20, 0x05, 0xb0, 0xc0,
+    0x71, 0xc0, 0xf0, 0xb0, 0x10, 0x09, 0x70, 0xf0, 0x20, 0x0c, 0x20, 0xf0,
+    0x20, 0x0c, 0x60, 0xf0, 0x30, 0x0f, 0x1b, 0xb0, 0xf1, 0xa0, 0xe0, 0xf0,
+    0x90, 0x10, 0x08, 0x30, 0xa0, 0xf0, 0xd0, 0x80, 0xf1, 0x70, 0x07, 0xc0,
+    0xf1, 0x60, 0x90, 0xf0, 0xc0, 0x08, 0x10, 0x80, 0xd0, 0xf0, 0xd1, 0xe0,
+    0x07, 0x90, 0xf4, 0x90, 0x08, 0xb0, 0xf0, 0xe0, 0x00, 0x70, 0xf1, 0x50,
+    0x06, 0x90, 0xf2, 0x60, 0x00, 0x90, 0xf2, 0x60, 0x04, 0x90, 0xf1, 0xd0,
+    0x01, 0x20, 0xf2, 0x60, 0x05, 0x80, 0xf1, 0xd0, 0x20, 0xf2, 0x50, 0x05,
+    0x80, 0xf1, 0xe0, 0x01, 0x30, 0xf2, 0x50, 0x05, 0x80, 0xf5, 0x50, 0x09,
+    0x20, 0xf0, 0x50, 0x0d, 0xe0, 0x50, 0x0c, 0x20, 0xf0, 0x50, 0x0f, 0x51,
+    0x10, 0x09, 0x50, 0xf0, 0x20, 0x0f, 0x5f, 0xd1, 0x70, 0x20, 0x0b, 0xa0,
+    0x70, 0x0b, 0x40, 0x80, 0xf0, 0x70, 0x0f, 0x5c, 0x20, 0xf0, 0x50, 0x0f,
+    0x5f, 0x30, 0xb0, 0xf0, 0x60, 0x0b, 0x70, 0xb0, 0x0b, 0x60, 0xf0, 0xd0,
+    0x30, 0x0f, 0xde, 0x40, 0xe0, 0x0f, 0xee, 0x10, 0xf0, 0x30, 0x0f, 0xff,
+    0x0f, 0xff, 0x0f, 0xff, 0x0f, 0x6c, 0x70, 0xb0, 0xf1, 0xd0, 0x90, 0x10,
+    0x0f, 0x19, 0x90, 0xe0, 0xf0, 0xd0, 0x70, 0x0f, 0xbb, 0x50, 0xb0, 0x71,
+    0x80, 0xe0, 0xb0, 0x0f, 0x19, 0x50, 0x90, 0x70, 0x90, 0xf0, 0x80, 0x0f,
+    0x5a, 0x10, 0xb0, 0xf0, 0xe0, 0xa1, 0xf1, 0x50, 0x05, 0x10, 0xf1, 0xa1,
+    0xf0, 0xd0, 0x70, 0x09, 0x40, 0xc0, 0xf0, 0xe0, 0xa0, 0x40, 0x09, 0x50,
+    0xd0, 0xf0, 0xa1, 0xf1, 0x40, 0x07, 0x40, 0xa0, 0xf1, 0xd0, 0x90, 0x40,
+    0x08, 0xe0, 0xf4, 0x20, 0x08, 0x50, 0xd0, 0xf0, 0xb0, 0xc0, 0xf0, 0x10,
+    0x06, 0x10, 0xf2, 0xa0, 0x80, 0xf2, 0x30, 0x07, 0xe0, 0xf4, 0x80, 0x0b,
+    0x70, 0xf0, 0x10, 0x07, 0x10, 0xf1, 0x90, 0x00, 0xc0, 0xf2, 0x20, 0x06,
+    0xe0, 0xf4, 0x80, 0x07, 0xd0, 0xf1, 0x70, 0xc0, 0xf0, 0x70, 0xc0, 0xf0,
+    0x70, 0x04, 0x10, 0xf3, 0x00, 0xe0, 0xf2, 0x30, 0x06, 0x30, 0x90, 0xe0,
+    0xf0, 0xe0, 0xa0, 0x50, 0x0f, 0x09, 0x70, 0xf0, 0x90, 0x70, 0xc0, 0xf1,
+    0x90, 0x40, 0x06, 0x70, 0xb0, 0xf0, 0xe0, 0x80, 0x90, 0xf0, 0x90, 0x07,
+    0x10, 0xe1, 0x80, 0x70, 0xc0, 0xf0, 0x70, 0x07, 0x20, 0xf0, 0xe0, 0x70,
+    0x90, 0xf1, 0x90, 0x40, 0x06, 0x30, 0xf0, 0xb0, 0x72, 0x90, 0xc0, 0x30,
+    0x07, 0x60, 0x90, 0xf0, 0x90, 0x71, 0x20, 0x07, 0x20, 0xf0, 0xe0, 0x80,
+    0x90, 0xf1, 0x40, 0x07, 0x70, 0xb0, 0xe0, 0x70, 0x30, 0x90, 0xf0, 0x90,
+    0x30, 0x07, 0x60, 0x70, 0x90, 0xf0, 0x90, 0x70, 0x60, 0x0b, 0x40, 0xf0,
+    0x40, 0x08, 0x70, 0xb0, 0xc0, 0x00, 0x60, 0xf0, 0xd0, 0x70, 0x20, 0x06,
+    0x60, 0x70, 0x90, 0xf0, 0x90, 0x70, 0x60, 0x07, 0x60, 0xb0, 0xe0, 0x50,
+    0x90, 0xe0, 0x50, 0x90, 0xe0, 0x60, 0x05, 0x70, 0xb0, 0xe0, 0x70, 0x20,
+    0x60, 0x90, 0xf0, 0x90, 0x30, 0x05, 0x10, 0xe0, 0xf0, 0xa0, 0x71, 0xc0,
+    0xf0, 0x90, 0x0f, 0x08, 0x60, 0xf0, 0x40, 0x01, 0x30, 0xf0, 0x70, 0x08,
+    0x70, 0xf0, 0x60, 0x01, 0x50, 0xf0, 0x60, 0x06, 0x40, 0xf0, 0x50, 0x02,
+    0x40, 0x30, 0x07, 0x40, 0xf0, 0x60, 0x01, 0x30, 0xf0, 0x70, 0x07, 0x70,
+    0xf6, 0x70, 0x09, 0xf0, 0x70, 0x0a, 0x40, 0xf0, 0x60, 0x01, 0x50, 0xf0,
+    0x70, 0x08, 0x70, 0xf0, 0x10, 0x01, 0xf0, 0x70, 0x0b, 0xf0, 0x70, 0x0e,
+    0xf0, 0x70, 0x09, 0x70, 0xf0, 0x10, 0x70, 0xf0, 0x40, 0x0b, 0xf0, 0x70,
+    0x0a, 0x70, 0xf0, 0x10, 0x70, 0xf0, 0x10, 0x70, 0xf0, 0x10, 0x06, 0x70,
+    0xf0, 0x10, 0x02, 0xf0, 0x70, 0x06, 0x40, 0xf0, 0x70, 0x03, 0x60, 0xf0,
+    0x50, 0x0f, 0x08, 0x90, 0xf4, 0xa0, 0x08, 0x30, 0xf0, 0x40, 0x02, 0xc0,
+    0xa0, 0x06, 0x30, 0xf0, 0x50, 0x0c, 0x30, 0xf0, 0x50, 0x02, 0xb0, 0xa0,
+    0x07, 0x20, 0xf0, 0xb0, 0x73, 0xd0, 0x90, 0x09, 0xb0, 0xa0, 0x0a, 0x30,
+    0xf0, 0x50, 0x02, 0xc0, 0xa0, 0x08, 0x30, 0xf0, 0x40, 0x01, 0xb0, 0xa0,
+    0x0b, 0xb0, 0xa0, 0x0e, 0xb0, 0xa0, 0x09, 0x30, 0xf0, 0xd0, 0xf0, 0x70,
+    0x0c, 0xb0, 0xa0, 0x0a, 0x30, 0xf0, 0x40, 0x30, 0xf0, 0x40, 0x30, 0xf0,
+    0x40, 0x06, 0x30, 0xf0, 0x40, 0x02, 0xb0, 0xa0, 0x06, 0x30, 0xf0, 0x50,
+    0x04, 0xc0, 0xa0, 0x0f, 0x09, 0x50, 0x72, 0xb0, 0xd0, 0x09, 0xf0, 0xa0,
+    0x02, 0xd0, 0xb0, 0x07, 0xd0, 0xb0, 0x02, 0x70, 0xf0, 0x30, 0x07, 0xd0,
+    0xb0, 0x02, 0xc0, 0xd0, 0x08, 0xb0, 0xe0, 0x30, 0x01, 0x10, 0xe0, 0xb0,
+    0x09, 0x80, 0xd0, 0x0b, 0xd0, 0xc0, 0x02, 0xd1, 0x09, 0xf0, 0xa0, 0x01,
+    0x80, 0xd0, 0x0b, 0x80, 0xd0, 0x0e, 0x80, 0xd0, 0x0a, 0xf0, 0xc0, 0xe0,
+    0x90, 0x0c, 0x80, 0xd0, 0x0b, 0xf0, 0x70, 0x00, 0xf0, 0x70, 0x00, 0xf0,
+    0x70, 0x07, 0xf0, 0xa0, 0x10, 0x01, 0x80, 0xd0, 0x07, 0xd0, 0xc0, 0x10,
+    0x02, 0x10, 0xd0, 0xb0, 0x0f, 0x09, 0xf0, 0xb0, 0x71, 0xe0, 0xf0, 0x09,
+    0xb0, 0xf0, 0xd0, 0x70, 0xa0, 0xf0, 0x70, 0x07, 0x30, 0xe0, 0xd0, 0x71,
+    0xd0, 0xf0, 0x40, 0x07, 0x30, 0xe0, 0xc0, 0x70, 0xb0, 0xf1, 0x20, 0x07,
+    0x20, 0xe0, 0xf0, 0x90, 0x70, 0xd0, 0xf0, 0x70, 0x08, 0x60, 0xb0, 0xf0,
+    0x72, 0x20, 0x07, 0x40, 0xf0, 0xd0, 0x70, 0xa0, 0xf1, 0x70, 0x30, 0x07,
+    0xb0, 0xf0, 0xc0, 0x70, 0xc0, 0xf0, 0x09, 0x40, 0x70, 0xb0, 0xf0, 0x20,
+    0x0a, 0x72, 0xb0, 0xf0, 0x20, 0x09, 0xb0, 0xa1, 0xf0, 0xb0, 0x70, 0x20,
+    0x09, 0x60, 0xf0, 0x20, 0x09, 0x60, 0xd0, 0xe0, 0x50, 0xf0, 0xe0, 0x60,
+    0xf0, 0x90, 0x06, 0x70, 0xd0, 0xf0, 0xe0, 0x90, 0x70, 0xe0, 0xf0, 0x07,
+    0x30, 0xe1, 0x90, 0x70, 0x80, 0xd0, 0xf0, 0x70, 0x0f, 0x08, 0x10, 0x70,
+    0xb0, 0xf1, 0xd0, 0x60, 0x09, 0x80, 0xf0, 0x90, 0xe0, 0xf0, 0x90, 0x10,
+    0x08, 0x20, 0x90, 0xe0, 0xf0, 0xa0, 0xf0, 0x80, 0x08, 0x30, 0xa0, 0xf0,
+    0xd0, 0x80, 0xf0, 0x50, 0x08, 0x10, 0x80, 0xd0, 0xf0, 0xe0, 0x70, 0x09,
+    0x90, 0xf4, 0x60, 0x08, 0x40, 0xa0, 0xf0, 0xd0, 0x90, 0xf1, 0x70, 0x07,
+    0x80, 0xf0, 0x90, 0xe0, 0xf0, 0x80, 0x09, 0x40, 0xf2, 0x50, 0x0a, 0xc0,
+    0xf3, 0x50, 0x09, 0x80, 0xe0, 0xc0, 0xf2, 0x60, 0x09, 0x20, 0xf0, 0x50,
+    0x09, 0x90, 0xf1, 0xb0, 0xe0, 0x80, 0xd0, 0xe0, 0x50, 0x06, 0xb0, 0xf1,
+    0xa0, 0xc0, 0xf0, 0xe0, 0x80, 0x08, 0x10, 0x80, 0xc0, 0xf1, 0xc0, 0x60,
+    0x0c, 0x40, 0x20, 0x0f, 0x0a, 0x70, 0xd0, 0xf0, 0x20, 0x0f, 0x0f, 0x30,
+    0xb1, 0xf0, 0x70, 0x0f, 0x0b, 0xd0, 0xb0, 0x72, 0x0f, 0x08, 0x70, 0xd0,
+    0xf0, 0x20, 0x0e, 0x20, 0x70, 0x40, 0x0d, 0x20, 0x70, 0x40, 0x08, 0x70,
+    0xd0, 0xf0, 0x20, 0x0b, 0x30, 0xb1, 0xf0, 0x70, 0x0f, 0x2e, 0x90, 0xe0,
+    0x20, 0x0f, 0x0a, 0x60, 0xb0, 0xf0, 0x50, 0x0f, 0x0f, 0x20, 0xb1, 0xe0,
+    0xb0, 0x0f, 0x0b, 0x30, 0xc0, 0xf2, 0x60, 0x0f, 0x07, 0x60, 0xb0, 0xf0,
+    0x50, 0x0e, 0x20, 0xf0, 0xb0, 0x0d, 0x20, 0xf0, 0xb0, 0x08, 0x60, 0xb0,
+    0xf0, 0x50, 0x0b, 0x30, 0xb1, 0xe0, 0xb0, 0x0f, 0x2d, 0x70, 0xf0, 0x70,
+    0x0f, 0x7f, 0xe0, 0xf0, 0x0e, 0xe0, 0xf0, 0x0f, 0xff, 0x0f, 0xff, 0x0f,
+    0xff, 0x0f, 0x2c, 0x50, 0x20, 0x00, 0x30, 0x0f, 0xec, 0xe0, 0xf3, 0xd0,
+    0x50, 0x0f, 0x8a, 0xc0, 0xf1, 0x70, 0x0e, 0x50, 0x10, 0x08, 0x90, 0xf1,
+    0x90, 0x0f, 0x0a, 0x40, 0xb7, 0x70, 0x0f, 0x09, 0x30, 0xe0, 0xf1, 0xb0,
+    0x90, 0x70, 0x0f, 0x8a, 0x90, 0xe0, 0x70, 0x50, 0x0e, 0xf0, 0xa0, 0x08,
+    0x40, 0x70, 0xb0, 0xc0, 0x0f, 0x1b, 0x10, 0xf4, 0x50, 0x0a, 0x30, 0xe0,
+    0xd0, 0xb0, 0xc0, 0x50, 0x07, 0x10, 0xf2, 0xb0, 0x00, 0x20, 0xf1, 0xa0,
+    0x06, 0x10, 0xe0, 0xb0, 0xc0, 0xf0, 0xe0, 0x90, 0x20, 0x08, 0x20, 0xf3,
+    0xb0, 0x09, 0x70, 0xc0, 0xf1, 0xd0, 0x90, 0x10, 0x09, 0x40, 0xf1, 0x70,
+    0x09, 0x40, 0xf0, 0x70, 0x01, 0x40, 0xf0, 0x60, 0x07, 0xc0, 0xf1, 0xd0,
+    0x80, 0xf2, 0x20, 0x07, 0x20, 0xf3, 0xb0, 0x08, 0xe0, 0xf5, 0x10, 0x09,
+    0x70, 0xf0, 0x10, 0x0e, 0x40, 0xf0, 0x70, 0x0a, 0x70, 0xf0, 0x10, 0x0f,
+    0x1b, 0x70, 0xb0, 0xe0, 0x71, 0x40, 0x0a, 0xd0, 0xb0, 0x01, 0x30, 0xe0,
+    0x60, 0x07, 0x70, 0xb0, 0xe0, 0x70, 0x00, 0x70, 0xf1, 0x60, 0x10, 0x06,
+    0xb0, 0xf0, 0xd0, 0x70, 0x80, 0xd0, 0xe0, 0x10, 0x08, 0x70, 0x90, 0xf0,
+    0x90, 0x70, 0x08, 0x30, 0xf0, 0xe0, 0x80, 0x70, 0x90, 0xf0, 0xc0, 0x09,
+    0x50, 0xf1, 0xe0, 0x10, 0x08, 0x10, 0xf0, 0xe0, 0x20, 0x00, 0x70, 0xf0,
+    0xa0, 0x07, 0x60, 0xa0, 0xf0, 0xb0, 0x40, 0xd0, 0xf0, 0x70, 0x20, 0x08,
+    0x70, 0x90, 0xf0, 0x90, 0x70, 0x08, 0x70, 0xf0, 0xe0, 0x71, 0x90, 0xf0,
+    0x40, 0x09, 0x40, 0xf0, 0x40, 0x0e, 0x70, 0xf0, 0x40, 0x0a, 0x40, 0xf0,
+    0x40, 0x0f, 0x1c, 0x70, 0xf0, 0x10, 0x0b, 0x10, 0xf0, 0x50, 0x02, 0x50,
+    0xf0, 0x20, 0x07, 0x70, 0xf0, 0x10, 0x20, 0xe0, 0xf0, 0xd0, 0x08, 0x90,
+    0xf0, 0x10, 0x01, 0x10, 0xf0, 0x70, 0x0a, 0xf0, 0x70, 0x09, 0x40, 0xf0,
+    0x50, 0x02, 0x30, 0xf0, 0x60, 0x08, 0x70, 0xf0, 0xc0, 0xf0, 0x90, 0x09,
+    0xf0, 0xd0, 0x90, 0x00, 0x80, 0xc0, 0xf0, 0x20, 0x08, 0xa0, 0xe0, 0x40,
+    0xf0, 0xb0, 0x0c, 0xf0, 0x70, 0x0a, 0x90, 0xf0, 0x80, 0x01, 0xf0, 0x70,
+    0x0a, 0xf0, 0x70, 0x0e, 0xb0, 0xf0, 0x0c, 0xf0, 0x70, 0x0f, 0x1c, 0x30,
+    0xf3, 0xc0, 0x70, 0x07, 0x10, 0xf0, 0x40, 0x03, 0xd0, 0x90, 0x07, 0x30,
+    0xf4, 0x90, 0x08, 0x20, 0x40, 0x20, 0x71, 0xa0, 0xf0, 0x70, 0x0a, 0xb0,
+    0xa0, 0x09, 0x30, 0xf0, 0x40, 0x03, 0xc0, 0xa0, 0x08, 0x90, 0xf0, 0x50,
+    0xb0, 0xf0, 0x30, 0x08, 0xf0, 0x80, 0xe0, 0x40, 0xb0, 0x70, 0xe0, 0x70,
+    0x08, 0x10, 0xc0, 0xe0, 0xf0, 0x40, 0x0c, 0xd0, 0xb0, 0x0b, 0xb0, 0xf0,
+    0x60, 0x00, 0x80, 0x70, 0x0a, 0xb0, 0xa0, 0x0e, 0xf0, 0xb0, 0x0c, 0xb0,
+    0xa0, 0x0b, 0x20, 0x30, 0x01, 0x60, 0x0f, 0x0c, 0xf0, 0xb0, 0x71, 0xa0,
+    0xf0, 0x80, 0x07, 0xf0, 0x80, 0x03, 0x80, 0xd0, 0x08, 0xf0, 0xb0, 0x71,
+    0xb0, 0xf0, 0x80, 0x08, 0x40, 0xf3, 0xd0, 0x20, 0x07, 0x20, 0x30, 0x00,
+    0x80, 0xd0, 0x00, 0x10, 0x40, 0x07, 0xf0, 0x70, 0x03, 0x80, 0xd0, 0x08,
+    0xb0, 0xf0, 0x21, 0xe0, 0xb0, 0x08, 0xc0, 0x80, 0x70, 0xb0, 0xc0, 0x70,
+    0xa0, 0xc0, 0x09, 0x30, 0xf0, 0xc0, 0x0c, 0x70, 0xf1, 0x90, 0x0a, 0x10,
+    0xc0, 0xf0, 0x60, 0x0c, 0x80, 0xd0, 0x0d, 0x40, 0xf0, 0x70, 0x0c, 0x80,
+    0xd0, 0x0b, 0xc0, 0xd0, 0x10, 0x40, 0xf0, 0x80, 0x0f, 0x0b, 0xb0, 0xa0,
+    0x02, 0x70, 0xf0, 0x10, 0x06, 0xa0, 0xd0, 0x10, 0x02, 0x70, 0xf0, 0x08,
+    0xb0, 0xa0, 0x02, 0x70, 0xf0, 0x10, 0x07, 0xa0, 0xf0, 0x80, 0x40, 0x20,
+    0x10, 0x40, 0x10, 0x06, 0xa0, 0xf0, 0x00, 0x60, 0xf0, 0x20, 0x40, 0xf0,
+    0x70, 0x06, 0xb0, 0xa0, 0x03, 0x60, 0xf0, 0x20, 0x07, 0xe0, 0xd0, 0x01,
+    0x70, 0xf0, 0x50, 0x07, 0xb1, 0x10, 0xe0, 0xf0, 0x40, 0x60, 0xf0, 0x20,
+    0x08, 0x50, 0xf1, 0x60, 0x0a, 0x10, 0xe1, 0x90, 0xf0, 0x90, 0x08, 0x61,
+    0x10, 0xe1, 0x30, 0x0b, 0x60, 0xf0, 0x20, 0x0c, 0x70, 0xf0, 0x40, 0x0c,
+    0x60, 0xf0, 0x20, 0x0a, 0x20, 0xe0, 0xb0, 0x90, 0xf0, 0x20, 0x0f, 0x0b,
+    0x80, 0xe0, 0x02, 0x50, 0xf0, 0x40, 0x06, 0x40, 0xf0, 0x90, 0x02, 0xd0,
+    0xf0, 0x08, 0x80, 0xe0, 0x02, 0x40, 0xf0, 0x40, 0x07, 0x70, 0xe0, 0x10,
+    0x01, 0x40, 0xf0, 0x60, 0x06, 0x60, 0xf0, 0x50, 0x20, 0xf0, 0x50, 0x10,
+    0xf0, 0x70, 0x06, 0x80, 0xe0, 0x03, 0x20, 0xf0, 0x50, 0x07, 0xf0, 0xa0,
+    0x02, 0xc0, 0xd0, 0x07, 0xb1, 0x00, 0x70, 0xf0, 0x40, 0x10, 0xf0, 0x70,
+    0x08, 0xb0, 0xf0, 0x70, 0xf0, 0x60, 0x09, 0x80, 0xf0, 0x50, 0x00, 0x70,
+    0xf0, 0x60, 0x07, 0x80, 0xe0, 0x00, 0x30, 0xe1, 0x30, 0x0a, 0x20, 0xf0,
+    0x50, 0x0c, 0xb0, 0xf0, 0x0d, 0x20, 0xf0, 0x50, 0x0b, 0x40, 0xf1, 0xb0,
+    0x0f, 0x0b, 0x40, 0xa0, 0xf0, 0x71, 0x80, 0xe0, 0xf0, 0x30, 0x07, 0x60,
+    0xf0, 0xb0, 0x70, 0xb0, 0xf0, 0x90, 0x07, 0x40, 0xa0, 0xf0, 0x72, 0xc0,
+    0xf0, 0x40, 0x07, 0x20, 0xe0, 0xd0, 0x80, 0x70, 0xc0, 0xf0, 0x80, 0x06,
+    0x20, 0xf0, 0xb0, 0x70, 0xf0, 0xb0, 0x70, 0xf0, 0xb0, 0x05, 0x30, 0xa0,
+    0xf0, 0x71, 0x00, 0x60, 0x70, 0xf0, 0xb0, 0x50, 0x04, 0x20, 0x80, 0xf0,
+    0xb0, 0x40, 0x00, 0x10, 0xa0, 0xf0, 0xa0, 0x40, 0x04, 0x20, 0xd0, 0xf0,
+    0x70, 0x20, 0x01, 0x70, 0xd1, 0x40, 0x05, 0x20, 0x80, 0xf0, 0xd0, 0x20,
+    0xa0, 0xf0, 0x80, 0x50, 0x05, 0x20, 0x70, 0xf0, 0xe0, 0x20, 0x01, 0xb0,
+    0xf0, 0x80, 0x40, 0x05, 0x50, 0xf0, 0x71, 0xa0, 0xf0, 0xd0, 0x10, 0x0a,
+    0xe0, 0xb0, 0x70, 0x30, 0x0a, 0xf0, 0xb0, 0x0c, 0x60, 0x70, 0xf0, 0x70,
+    0x0c, 0x60, 0xf0, 0x60, 0x0f, 0x0b, 0x50, 0xf4, 0xd0, 0x70, 0x09, 0x50,
+    0xb0, 0xf0, 0xe0, 0x90, 0x10, 0x07, 0x50, 0xf5, 0x80, 0x09, 0x30, 0xa0,
+    0xe0, 0xf0, 0xc0, 0xb1, 0x10, 0x06, 0xc0, 0xf5, 0xc0, 0x05, 0x30, 0xf3,
+    0x40, 0x90, 0xf2, 0xc0, 0x04, 0x20, 0xf2, 0x90, 0x01, 0xf2, 0xb0, 0x04,
+    0x20, 0xf2, 0x50, 0x01, 0xb0, 0xf1, 0xb0, 0x05, 0x30, 0xf2, 0x50, 0x90,
+    0xf1, 0xc0, 0x05, 0x20, 0xf2, 0x50, 0x01, 0xb0, 0xf1, 0xb0, 0x05, 0x20,
+    0xf5, 0x70, 0x0a, 0xb0, 0xf1, 0x80, 0x09, 0x10, 0x90, 0x70, 0x0c, 0x70,
+    0xf1, 0xb0, 0x0d, 0x90, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff,
+    0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xb2, 0x50, 0xc0, 0xf1, 0xb0, 0x70, 0x07,
+    0xc0, 0xf1, 0xd0, 0x01, 0xc0, 0xf2, 0x20, 0x04, 0x10, 0xf5, 0xa0, 0x30,
+    0x08, 0x10, 0xa0, 0xf1, 0xa0, 0x40, 0x07, 0x10, 0xf5, 0xa0, 0x40, 0x06,
+    0x10, 0xf7, 0x10, 0x05, 0x10, 0xf4, 0x30, 0x0a, 0x30, 0xb0, 0xf1, 0xd0,
+    0xb0, 0x70, 0x10, 0x06, 0xd0, 0xf1, 0xa0, 0x70, 0xf2, 0x10, 0x07, 0xe0,
+    0xf4, 0x80, 0x06, 0x20, 0x80, 0xc0, 0xf1, 0xa0, 0x30, 0x07, 0x10, 0xf3,
+    0x90, 0x01, 0xf1, 0x70, 0x05, 0x40, 0xf6, 0xe0, 0x06, 0xa0, 0xf1, 0xe0,
+    0x00, 0xb0, 0xf1, 0xd0, 0x06, 0xb0, 0xf2, 0x30, 0x20, 0xf1, 0x10, 0x07,
+    0x10, 0x80, 0xd0, 0xf0, 0xe0, 0x90, 0x20, 0x08, 0x10, 0xe1, 0x80, 0x71,
+    0xb0, 0x07, 0x60, 0xb0, 0xf0, 0x80, 0x01, 0x50, 0xb0, 0xf0, 0x90, 0x20,
+    0x05, 0x70, 0xb0, 0xe0, 0x72, 0xd0, 0xe0, 0x20, 0x07, 0xb0, 0xf0, 0x90,
+    0x70, 0xb0, 0xf0, 0x50, 0x07, 0x70, 0xb0, 0xe0, 0x71, 0x80, 0xd0, 0xf0,
+    0x60, 0x06, 0x70, 0xb0, 0xe0, 0x72, 0x90, 0xf0, 0x40, 0x06, 0x70, 0xb0,
+    0xe0, 0x71, 0x30, 0x0a, 0xe1, 0x90, 0x71, 0xa0, 0xf0, 0x40, 0x06, 0x60,
+    0xb0, 0xe0, 0x70, 0x20, 0x90, 0xf0, 0x90, 0x20, 0x07, 0x60, 0x70, 0x90,
+    0xf0, 0x90, 0x70, 0x60, 0x06, 0x80, 0xf0, 0xe0, 0x80, 0x70, 0xc0, 0xe0,
+    0x10, 0x07, 0x70, 0xb0, 0xe0, 0x70, 0x60, 0x00, 0x50, 0xf0, 0xb0, 0x60,
+    0x05, 0x10, 0x70, 0xb0, 0xe0, 0x72, 0x90, 0xf0, 0x40, 0x05, 0x40, 0xb0,
+    0xe0, 0x70, 0x10, 0x40, 0x90, 0xf0, 0x90, 0x06, 0x40, 0xb0, 0xe0, 0x70,
+    0x30, 0x60, 0xf1, 0x40, 0x07, 0x90, 0xf0, 0xc0, 0x70, 0x80, 0xd0, 0xe0,
+    0x60, 0x07, 0x40, 0xf0, 0x71, 0xf0, 0xe0, 0x90, 0xf1, 0x50, 0x05, 0x20,
+    0xf6, 0x30, 0x07, 0x70, 0xf0, 0x10, 0x01, 0x10, 0xf0, 0x70, 0x07, 0xf0,
+    0x80, 0x02, 0x40, 0x09, 0x70, 0xf0, 0x10, 0x02, 0x90, 0xf0, 0x20, 0x06,
+    0x70, 0xf0, 0x10, 0x02, 0xf0, 0x70, 0x07, 0x70, 0xf0, 0x10, 0x00, 0x40,
+    0x20, 0x08, 0x40, 0xf0, 0x50, 0x00, 0x60, 0xf3, 0x30, 0x06, 0x70, 0xf0,
+    0x10, 0x01, 0xf0, 0x70, 0x0b, 0xf0, 0x70, 0x08, 0x70, 0xf0, 0x50, 0x01,
+    0x20, 0xf0, 0x70, 0x08, 0x70, 0xf0, 0x10, 0x01, 0xb0, 0xf0, 0x30, 0x08,
+    0x70, 0xf0, 0x10, 0x01, 0x10, 0xf0, 0x70, 0x06, 0x70, 0xf0, 0x10, 0x80,
+    0x90, 0x00, 0xf0, 0x70, 0x07, 0x70, 0xf0, 0x10, 0x00, 0xa0, 0xf1, 0x70,
+    0x07, 0xf0, 0xb0, 0x02, 0x10, 0x90, 0xe0, 0x20, 0x06, 0x30, 0xf0, 0x50,
+    0xb0, 0xc0, 0x40, 0xa0, 0xf0, 0xd0, 0x40, 0x06, 0x70, 0xf0, 0xb0, 0x71,
+    0xf1, 0x08, 0x30, 0xf0, 0x90, 0x71, 0xc0, 0xf0, 0x60, 0x06, 0x10, 0xf0,
+    0x70, 0x0d, 0x30, 0xf0, 0x40, 0x02, 0x10, 0xe0, 0x90, 0x06, 0x30, 0xf0,
+    0x90, 0x70, 0xe0, 0xa0, 0x60, 0x50, 0x07, 0x30, 0xf0, 0x90, 0x70, 0xd0,
+    0xa0, 0x08, 0x30, 0xf0, 0x40, 0x00, 0x20, 0x73, 0x30, 0x06, 0x30, 0xf0,
+    0x90, 0x71, 0xd0, 0xa0, 0x0b, 0xb0, 0xa0, 0x08, 0x40, 0xf0, 0x50, 0x02,
+    0xc0, 0xa0, 0x08, 0x30, 0xf0, 0xa0, 0x40, 0x90, 0xf0, 0xd0, 0x09, 0x30,
+    0xf0, 0x40, 0x02, 0xb1, 0x06, 0x30, 0xf0, 0x40, 0xb0, 0xf0, 0x20, 0xb0,
+    0xa0, 0x07, 0x30, 0xf0, 0x40, 0x10, 0xf0, 0xa0, 0xb0, 0xa0, 0x07, 0xf0,
+    0x70, 0x03, 0x10, 0xe0, 0x90, 0x07, 0xe0, 0x70, 0x50, 0xf0, 0x90, 0x50,
+    0xc0, 0xd0, 0x07, 0x10, 0xd0, 0xe0, 0x10, 0x30, 0xf0, 0xc0, 0x09, 0xf4,
+    0xe0, 0x30, 0x07, 0xf0, 0x70, 0x0e, 0xf0, 0x70, 0x03, 0x80, 0xd0, 0x07,
+    0xf3, 0xd0, 0x0a, 0xf3, 0xd0, 0x09, 0xe0, 0x80, 0x02, 0x21, 0x09, 0xf4,
+    0xd0, 0x0b, 0x80, 0xd0, 0x08, 0x10, 0xb0, 0x60, 0x02, 0x80, 0xd0, 0x09,
+    0xf3, 0xe0, 0x30, 0x0a, 0xf0, 0x70, 0x02, 0x20, 0x40, 0x07, 0xf0, 0x70,
+    0xb0, 0xe0, 0x90, 0x80, 0xd0, 0x08, 0xf0, 0x70, 0x60, 0xf0, 0x60, 0x80,
+    0xd0, 0x07, 0xf0, 0x70, 0x04, 0x80, 0xd0, 0x07, 0x90, 0xd0, 0x00, 0x40,
+    0xa0, 0xe0, 0xf1, 0x20, 0x07, 0x60, 0xf0, 0x80, 0x70, 0xf0, 0x90, 0x09,
+    0xb0, 0xa0, 0x01, 0x10, 0xa0, 0xe0, 0x10, 0x06, 0xa0, 0xc0, 0x02, 0x30,
+    0x70, 0x40, 0x08, 0xb0, 0xa0, 0x03, 0x70, 0xf0, 0x07, 0xb0, 0xa0, 0x00,
+    0x60, 0xf0, 0x50, 0xb0, 0x20, 0x07, 0xb0, 0xa0, 0x00, 0x60, 0xf0, 0x50,
+    0xb0, 0x20, 0x06, 0x90, 0xe0, 0x10, 0x01, 0x40, 0xf0, 0x40, 0x08, 0xb0,
+    0xa0, 0x01, 0x60, 0xf0, 0x20, 0x0a, 0x60, 0xf0, 0x20, 0x0d, 0x60, 0xf0,
+    0x20, 0x08, 0xb1, 0x80, 0xf0, 0xc0, 0x30, 0x0a, 0xb0, 0xa0, 0x0c, 0xb0,
+    0xa0, 0xb0, 0x70, 0xe0, 0x70, 0xf0, 0x20, 0x07, 0xb0, 0xa1, 0xf0, 0x10,
+    0x60, 0xf0, 0x20, 0x06, 0x90, 0xd0, 0x04, 0x70, 0xf0, 0x07, 0x40, 0xf0,
+    0x70, 0x02, 0x30, 0xf0, 0x50, 0x08, 0xb0, 0xf0, 0xc0, 0xf0, 0x70, 0x09,
+    0x80, 0xe0, 0x02, 0x40, 0xf0, 0x40, 0x06, 0x40, 0xf0, 0x60, 0x01, 0x50,
+    0xf0, 0x70, 0x08, 0x80, 0xe0, 0x03, 0xa0, 0xf0, 0x07, 0x80, 0xe0, 0x02,
+    0x30, 0xf0, 0x50, 0x07, 0x80, 0xe0, 0x02, 0x30, 0xf0, 0x50, 0x06, 0x20,
+    0xf0, 0xa0, 0x01, 0x50, 0xf0, 0x70, 0x08, 0x80, 0xe0, 0x01, 0x20, 0xf0,
+    0x50, 0x0a, 0x20, 0xf0, 0x50, 0x0d, 0x20, 0xf0, 0x50, 0x08, 0x80, 0xe0,
+    0x00, 0x40, 0xc0, 0xe0, 0x30, 0x09, 0x80, 0xe0, 0x0c, 0x80, 0xe0, 0xb0,
+    0x40, 0x70, 0xb0, 0xf0, 0x50, 0x07, 0x80, 0xe1, 0xa0, 0x00, 0x20, 0xf0,
+    0x50, 0x06, 0x30, 0xf0, 0x90, 0x02, 0x10, 0xd0, 0xe0, 0x08, 0x80, 0xf0,
+    0xb0, 0x71, 0xb0, 0xf0, 0x70, 0x07, 0x70, 0xa0, 0xf2, 0x40, 0x08, 0x40,
+    0xa0, 0xf0, 0x72, 0xc0, 0xf0, 0x50, 0x07, 0x70, 0xf0, 0x90, 0x70, 0xd0,
+    0xf0, 0x90, 0x07, 0x40, 0xa0, 0xf0, 0x72, 0xb0, 0xf0, 0xb0, 0x06, 0x40,
+    0xa0, 0xf0, 0x73, 0xf0, 0x70, 0x06, 0x40, 0xa0, 0xf0, 0x73, 0xf0, 0x70,
+    0x07, 0x60, 0xf0, 0xd0, 0x70, 0xc0, 0xf0, 0x90, 0x07, 0x30, 0xa0, 0xf0,
+    0x70, 0x20, 0x70, 0xf0, 0xb0, 0x50, 0x07, 0x40, 0x71, 0xf0, 0xb0, 0x71,
+    0x10, 0x07, 0x20, 0x72, 0xf0, 0xb0, 0x70, 0x40, 0x05, 0x40, 0xa0, 0xf0,
+    0x71, 0x10, 0xe1, 0x80, 0x50, 0x06, 0x60, 0xa0, 0xf0, 0x71, 0x20, 0x08,
+    0x10, 0xa0, 0xf0, 0xd0, 0x40, 0x10, 0xd0, 0xf0, 0xb0, 0x40, 0x05, 0x20,
+    0xa0, 0xf1, 0x60, 0x30, 0x70, 0xf0, 0xb0, 0x40, 0x06, 0x60, 0xf0, 0xd0,
+    0x80, 0x70, 0xd0, 0xf0, 0x80, 0x09, 0x50, 0xb0, 0xf1, 0xe0, 0x90, 0x10,
+    0x07, 0xb0, 0xf3, 0x20, 0x08, 0x50, 0xf5, 0x90, 0x09, 0x50, 0xc0, 0xf0,
+    0xc0, 0xb1, 0x07, 0x50, 0xf5, 0xa0, 0x20, 0x06, 0x50, 0xf6, 0xb0, 0x06,
+    0x50, 0xf6, 0xb0, 0x08, 0x50, 0xc0, 0xf0, 0xc0, 0xb0, 0xa0, 0x07, 0x30,
+    0xf2, 0x60, 0xb0, 0xf1, 0xc0, 0x07, 0x40, 0xf5, 0x40, 0x07, 0x10, 0xf5,
+    0x80, 0x05, 0x50, 0xf3, 0x10, 0xe0, 0xf1, 0xc0, 0x06, 0x80, 0xf3, 0x70,
+    0x09, 0xf2, 0x40, 0x00, 0x70, 0xf1, 0x80, 0x06, 0xf2, 0x20, 0x40, 0xf2,
+    0x90, 0x07, 0x30, 0xa0, 0xe0, 0xf0, 0xd0, 0x70, 0x0f, 0xff, 0x0f, 0xff,
+    0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0x5d, 0x30, 0xf0, 0xd0, 0x10,
+    0x0f, 0xed, 0x90, 0xf0, 0x80, 0x0f, 0x3e, 0x60, 0xe1, 0x80, 0x10, 0x09,
+    0xe0, 0xf4, 0x80, 0x07, 0x20, 0xf5, 0x10, 0x07, 0x10, 0x70, 0xc0, 0xf0,
+    0xe0, 0x90, 0x10, 0x0a, 0x60, 0xf3, 0x60, 0x07, 0x30, 0x90, 0xd0, 0xf0,
+    0xe0, 0x90, 0x10, 0x0a, 0x60, 0xe0, 0xf0, 0x90, 0x10, 0x09, 0x10, 0xd1,
+    0x10, 0x0c, 0x80, 0xe0, 0xf0, 0x90, 0x10, 0x09, 0xe0, 0xf0, 0xd0, 0x90,
+    0x10, 0x0b, 0x70, 0xf0, 0xb0, 0x20, 0x0a, 0x20, 0xf1, 0x50, 0x0e, 0x10,
+    0x90, 0x60, 0x0f, 0x09, 0x60, 0x90, 0x20, 0x0e, 0x70, 0xf0, 0x80, 0x0b,
+    0x10, 0xf0, 0xc0, 0x80, 0xe0, 0xa0, 0x09, 0x60, 0x70, 0x90, 0xf0, 0x90,
+    0x70, 0x60, 0x08, 0xa0, 0xf0, 0xd0, 0x70, 0x90, 0xf0, 0x40, 0x08, 0xb0,
+    0xd0, 0x71, 0xd1, 0x10, 0x09, 0x20, 0x70, 0x90, 0xf0, 0x90, 0x40, 0x08,
+    0xc0, 0xa0, 0x70, 0x80, 0xe0, 0xc0, 0x10, 0x08, 0x10, 0xf0, 0xc0, 0x70,
+    0xd0, 0xc0, 0x10, 0x09, 0x40, 0xf0, 0x70, 0x0b, 0x40, 0xf0, 0xc0, 0x70,
+    0xd0, 0xc0, 0x10, 0x08, 0x60, 0x70, 0x80, 0xd0, 0xe0, 0x30, 0x0a, 0x80,
+    0xf1, 0x70, 0x0b, 0x70, 0xf0, 0xe0, 0x10, 0x0c, 0x40, 0xd0, 0xf0, 0x90,
+    0x0f, 0x09, 0x50, 0xd0, 0xf0, 0x70, 0x10, 0x0c, 0x80, 0xf1, 0x30, 0x0a,
+    0x40, 0xf0, 0x50, 0x00, 0x40, 0xf0, 0x40, 0x0b, 0xf0, 0x70, 0x0b, 0x50,
+    0xe0, 0xb0, 0x20, 0x70, 0x40, 0x08, 0x10, 0x02, 0x20, 0xf0, 0x70, 0x08,
+    0xd0, 0xf4, 0xb0, 0x0c, 0x30, 0xf0, 0x70, 0x08, 0x40, 0xf0, 0x50, 0x00,
+    0x10, 0xf0, 0x70, 0x0a, 0xa0, 0xe0, 0x20, 0x0a, 0x60, 0xf0, 0x30, 0x00,
+    0x30, 0xf0, 0x70, 0x0c, 0xa0, 0xd0, 0x10, 0x0a, 0x60, 0xa0, 0x20, 0x0b,
+    0x10, 0x41, 0x20, 0x0b, 0x70, 0xf0, 0xe0, 0x50, 0x09, 0x60, 0xf5, 0x50,
+    0x09, 0x60, 0xe1, 0x70, 0x10, 0x0b, 0x61, 0x0b, 0x20, 0xf0, 0x50, 0x01,
+    0xd0, 0x90, 0x0b, 0xb0, 0xa0, 0x0c, 0x10, 0xb0, 0xe0, 0x60, 0x0e, 0xe0,
+    0x90, 0x08, 0x60, 0xf0, 0xc0, 0x70, 0xd1, 0x70, 0x0d, 0xd0, 0x90, 0x08,
+    0x30, 0xf0, 0x70, 0x01, 0xe0, 0xa0, 0x0a, 0x20, 0xe0, 0xa0, 0x0a, 0x20,
+    0xf0, 0x70, 0x01, 0xe0, 0x90, 0x0a, 0x50, 0x71, 0xf0, 0x70, 0x0a, 0x70,
+    0xb0, 0x50, 0x0c, 0x70, 0xb0, 0x50, 0x09, 0x10, 0xb0, 0xf0, 0xe0, 0x10,
+    0x0a, 0x30, 0xb5, 0x60, 0x0a, 0x10, 0x90, 0xf0, 0xd0, 0x30, 0x0a, 0xc0,
+    0xa0, 0x0c, 0xf0, 0x70, 0x01, 0x80, 0xd0, 0x0b, 0x80, 0xd0, 0x0e, 0x90,
+    0xf0, 0x60, 0x0b, 0x60, 0xa0, 0xf0, 0x70, 0x09, 0x90, 0xe0, 0x30, 0x80,
+    0xd0, 0x0a, 0xe0, 0xa0, 0x70, 0xc0, 0xf0, 0x70, 0x09, 0xe0, 0xf0, 0x90,
+    0xa0, 0xf0, 0x80, 0x0b, 0x70, 0xf0, 0x40, 0x0a, 0x80, 0xf0, 0x90, 0xa0,
+    0xf0, 0x70, 0x09, 0x60, 0xf3, 0xd0, 0x0a, 0xf2, 0x20, 0x0b, 0xf2, 0x20,
+    0x09, 0x10, 0x70, 0xf0, 0xd0, 0x60, 0x0a, 0xb5, 0x80, 0x0a, 0x70, 0xf0,
+    0xe0, 0x70, 0x0b, 0x80, 0xf0, 0xd0, 0x80, 0x10, 0x09, 0xa0, 0xc0, 0x01,
+    0x70, 0xf0, 0x0b, 0x60, 0xf0, 0x20, 0x0e, 0x80, 0xe0, 0x10, 0x0a, 0x70,
+    0xf1, 0x60, 0x0a, 0xa0, 0xc0, 0x70, 0xf0, 0x20, 0x09, 0xb0, 0xe0, 0xc0,
+    0xe0, 0x90, 0x10, 0x09, 0x90, 0xe0, 0xb0, 0xe0, 0xa0, 0x10, 0x0b, 0x10,
+    0xd0, 0xc0, 0x0a, 0x20, 0xf3, 0x60, 0x09, 0xb0, 0xe0, 0x11, 0x90, 0xf0,
+    0x10, 0x09, 0x60, 0xe0, 0xc0, 0x10, 0x0b, 0x60, 0xe0, 0xc0, 0x10, 0x0b,
+    0x20, 0x90, 0xf0, 0xb0, 0x40, 0x08, 0xb0, 0xf5, 0x08, 0x20, 0xb0, 0xf0,
+    0xc0, 0x20, 0x0c, 0x20, 0x50, 0x90, 0xe0, 0xc0, 0x09, 0x60, 0xf0, 0x30,
+    0x00, 0x70, 0xf0, 0x09, 0x40, 0x70, 0x30, 0xf0, 0x50, 0x0a, 0x60, 0xb0,
+    0x01, 0x40, 0xf0, 0x40, 0x0c, 0x70, 0xf0, 0x40, 0x09, 0x10, 0xc0, 0xb0,
+    0xf0, 0x50, 0x09, 0x80, 0xe0, 0x0d, 0x20, 0xe0, 0x70, 0x0b, 0x40, 0x70,
+    0x01, 0x50, 0xf0, 0x70, 0x09, 0x70, 0xf0, 0x20, 0x00, 0x50, 0xf0, 0x40,
+    0x08, 0x80, 0xe0, 0x10, 0x00, 0x50, 0xf0, 0x40, 0x0f, 0x1c, 0x20, 0xb0,
+    0xd0, 0x0f, 0x09, 0x50, 0xf0, 0x70, 0x0c, 0x60, 0xb0, 0x02, 0x40, 0xf0,
+    0x40, 0x09, 0xc0, 0xe0, 0x70, 0xe1, 0x09, 0x60, 0xf2, 0x70, 0x0a, 0x40,
+    0xf0, 0xb0, 0x70, 0xc0, 0xf0, 0x30, 0x09, 0xe0, 0xa0, 0x70, 0xa0, 0xf0,
+    0x70, 0x0a, 0x20, 0xe0, 0xf0, 0x70, 0x09, 0x50, 0xf0, 0x73, 0x20, 0x09,
+    0x60, 0xf0, 0xc0, 0x71, 0x60, 0x07, 0x50, 0xf0, 0x72, 0xe1, 0x10, 0x08,
+    0x30, 0xf0, 0xb0, 0x70, 0xa0, 0xf0, 0x60, 0x08, 0x10, 0xe0, 0xc0, 0x70,
+    0xd0, 0xe0, 0x0f, 0x1f, 0x10, 0x0f, 0x0a, 0x10, 0x0d, 0x50, 0xf0, 0xa0,
+    0x71, 0xc0, 0xf0, 0x40, 0x09, 0x10, 0x90, 0xf0, 0xe0, 0x60, 0x0a, 0x20,
+    0x70, 0xd0, 0xb0, 0x0b, 0x40, 0xa0, 0xf0, 0xe0, 0x70, 0x0a, 0x40, 0xa0,
+    0xe0, 0xf0, 0x90, 0x10, 0x0b, 0x30, 0xe0, 0xb0, 0x09, 0x20, 0xf4, 0x60,
+    0x0a, 0x30, 0x90, 0xe0, 0xf0, 0xc0, 0x07, 0x20, 0xf5, 0x50, 0x09, 0x40,
+    0xa0, 0xf0, 0xe0, 0x80, 0x0a, 0x30, 0xa0, 0xf0, 0xd0, 0x50, 0x0f, 0x49,
+    0x20, 0x90, 0xd0, 0xf1, 0xd0, 0x70, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff,
+    0x0f, 0xff, 0x0f, 0xff, 0x00, 0xc0, 0x90, 0x0f, 0x2e, 0x40, 0xb0, 0x40,
+    0x0a, 0x60, 0xb0, 0x20, 0x0f, 0x1b, 0x30, 0xf0, 0xe0, 0x10, 0x0f, 0x1d,
+    0x40, 0x30, 0x0f, 0x2e, 0x20, 0xf0, 0x60, 0x00, 0xc1, 0x0c, 0x90, 0xc0,
+    0x0f, 0x2e, 0x80, 0xf0, 0x10, 0x0b, 0xc0, 0xb0, 0x0f, 0x1c, 0x90, 0xf0,
+    0xa0, 0x0f, 0x1c, 0x10, 0xc1, 0x0f, 0x10, 0x70, 0xf0, 0xb0, 0x0f, 0x0c,
+    0xc0, 0xa0, 0x00, 0x70, 0xf0, 0x10, 0x08, 0xb0, 0xa0, 0xb0, 0xd0, 0xf0,
+    0xa0, 0x30, 0x0c, 0x60, 0xe0, 0xd0, 0x50, 0x06, 0x20, 0xc0, 0xf0, 0xb0,
+    0x90, 0xf1, 0x80, 0x0f, 0x0c, 0xb1, 0x0c, 0x30, 0xf0, 0x60, 0x0f, 0x1b,
+    0x10, 0xe0, 0xf0, 0x50, 0x0f, 0x0d, 0x90, 0xf0, 0x80, 0x0b, 0x30, 0xf0,
+    0x70, 0x0f, 0x0f, 0x70, 0xf1, 0x40, 0x0f, 0x0b, 0x80, 0xe0, 0x00, 0x30,
+    0xf0, 0x50, 0x08, 0x80, 0xf0, 0xc0, 0xb1, 0xd0, 0xe0, 0x20, 0x0b, 0xb0,
+    0xa0, 0x50, 0xf0, 0x20, 0x05, 0x70, 0xf0, 0x80, 0xa0, 0xf0, 0xd0, 0x70,
+    0x60, 0x0f, 0x0c, 0xe0, 0x90, 0x0d, 0x90, 0xd0, 0x0f, 0x0d, 0x40, 0xf0,
+    0x40, 0x0b, 0x70, 0xf0, 0xe0, 0x10, 0x0f, 0x0c, 0xd0, 0xf1, 0x40, 0x0b,
+    0x70, 0xf0, 0x30, 0x0f, 0x0f, 0x61, 0x0f, 0x0b, 0xa0, 0xf5, 0xe0, 0x07,
+    0x60, 0x90, 0x02, 0x20, 0xf0, 0x70, 0x07, 0x50, 0x90, 0x20, 0x00, 0xa1,
+    0x00, 0xd0, 0x70, 0x05, 0x60, 0xf0, 0x40, 0x90, 0xf1, 0x40, 0x0f, 0x0d,
+    0xd0, 0x70, 0x0d, 0x20, 0xf0, 0x60, 0x0f, 0x0d, 0xf0, 0x70, 0x0b, 0x10,
+    0x41, 0x20, 0x0f, 0x0c, 0x30, 0xa0, 0x90, 0x10, 0x0c, 0xc1, 0x0f, 0x10,
+    0xb0, 0x70, 0x0f, 0x0a, 0x40, 0x90, 0xf0, 0x90, 0x70, 0xd1, 0x70, 0x10,
+    0x08, 0x20, 0x70, 0x80, 0xd0, 0xf0, 0x60, 0x07, 0x10, 0x70, 0xf0, 0x90,
+    0x30, 0xb0, 0xf0, 0xe0, 0x20, 0x05, 0x10, 0xe0, 0xf2, 0xe0, 0xc0, 0x70,
+    0x10, 0x0f, 0x0b, 0xb1, 0x0e, 0xc0, 0xa0, 0x0b, 0x70, 0x21, 0x70, 0x09,
+    0x40, 0xb1, 0xe0, 0xd0, 0xb1, 0x30, 0x0f, 0x08, 0x30, 0xb4, 0x80, 0x0f,
+    0x0b, 0x30, 0xf0, 0x70, 0x0f, 0x0f, 0xd1, 0x0b, 0x31, 0x00, 0x30, 0x40,
+    0x0a, 0xf0, 0x70, 0x00, 0x90, 0xd0, 0x09, 0x60, 0xf2, 0xd0, 0x70, 0x09,
+    0x20, 0x40, 0x90, 0xe0, 0x70, 0x40, 0x10, 0x07, 0x30, 0xb0, 0xf0, 0xa0,
+    0x50, 0xf1, 0x50, 0x0a, 0x30, 0x40, 0x0d, 0x70, 0xe0, 0x0e, 0xb1, 0x0a,
+    0x10, 0xc1, 0xa0, 0xf0, 0x50, 0x08, 0x30, 0xf5, 0x70, 0x0f, 0x09, 0xf4,
+    0xe0, 0x0f, 0x0c, 0x70, 0xf0, 0x40, 0x0f, 0x0e, 0xb0, 0xf0, 0x20, 0x0a,
+    0xb0, 0xf0, 0x00, 0xa0, 0xf0, 0x10, 0x07, 0x20, 0x70, 0xd1, 0x70, 0xa0,
+    0xf0, 0x80, 0x40, 0x07, 0xb0, 0xe0, 0x60, 0x20, 0x00, 0x20, 0x10, 0x07,
+    0x40, 0xe0, 0xf0, 0x80, 0x20, 0xa0, 0xe0, 0x70, 0x20, 0x07, 0x80, 0xe0,
+    0x20, 0x0e, 0xa0, 0xf0, 0x10, 0x0c, 0x20, 0xf0, 0x60, 0x0d, 0xb1, 0x0b,
+    0x20, 0xe0, 0xf0, 0xc0, 0x10, 0x0b, 0x60, 0xf0, 0x20, 0x0f, 0x2e, 0xc0,
+    0xd0, 0x10, 0x0f, 0x0d, 0x70, 0xf0, 0x70, 0x0a, 0x80, 0xf0, 0x50, 0x70,
+    0xf0, 0x60, 0x08, 0xf6, 0x80, 0x07, 0x70, 0xf0, 0x80, 0x60, 0x40, 0xa0,
+    0xf0, 0x07, 0x70, 0xc0, 0x10, 0xe0, 0x40, 0x00, 0x40, 0xb0, 0x20, 0x07,
+    0x70, 0xe0, 0x70, 0xb0, 0x90, 0x0c, 0x70, 0xf0, 0x60, 0x0d, 0x80, 0xe0,
+    0x10, 0x0c, 0xc0, 0xb0, 0x0a, 0x50, 0xf4, 0x70, 0x0a, 0x20, 0xf0, 0x50,
+    0x0f, 0x2e, 0x30, 0xf0, 0x80, 0x0f, 0x0d, 0x60, 0xf0, 0xa0, 0x0a, 0x70,
+    0xf0, 0x80, 0x70, 0xf0, 0x90, 0x09, 0x60, 0xf0, 0x11, 0xf0, 0x70, 0x09,
+    0x80, 0xf4, 0x20, 0x06, 0x40, 0xe0, 0x50, 0xd0, 0x70, 0x0c, 0x80, 0xe0,
+    0xd0, 0x70, 0x10, 0x0b, 0x60, 0xf0, 0x90, 0x0d, 0x10, 0xe0, 0xa0, 0x0b,
+    0x10, 0xf0, 0x80, 0x0b, 0x80, 0x40, 0xe0, 0x80, 0x60, 0x50, 0x0b, 0x70,
+    0x40, 0x0f, 0x2f, 0x70, 0xf0, 0x40, 0x0f, 0x0c, 0x40, 0xf0, 0xe0, 0x0a,
+    0x40, 0xf0, 0xd0, 0x40, 0xf0, 0xe0, 0x09, 0x20, 0xf0, 0x60, 0x00, 0xb1,
+    0x0b, 0x40, 0xc0, 0xd1, 0x70, 0x07, 0x60, 0xe0, 0xc0, 0x10, 0x0f, 0x0e,
+    0x40, 0xf0, 0xe0, 0x0e, 0x40, 0xf0, 0x60, 0x0a, 0x60, 0xf0, 0x50, 0x0d,
+    0xb0, 0xc0, 0x0f, 0x40, 0xb0, 0x70, 0x0f, 0x2b, 0xd0, 0xa0, 0x00, 0x70,
+    0xf0, 0x10, 0x0b, 0x70, 0xf0, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f,
+    0xfd, 0x70, 0xf0, 0xc0, 0x30, 0x0f, 0x5d, 0x40, 0x20, 0x0f, 0x7f, 0x90,
+    0xd0, 0x0f, 0x5d, 0xf0, 0x70, 0x0f, 0x80, 0xe0, 0x60, 0x0d, 0x41, 0x0d,
+    0x30, 0x40, 0x10, 0x0f, 0x1a, 0x40, 0x10, 0x00, 0x41, 0x0f, 0x0c, 0xb1,
+    0x0d, 0xf5, 0xb0, 0x07, 0x30, 0xd0, 0xe0, 0x81, 0xe0, 0xf0, 0xc0, 0x50,
+    0x05, 0xa0, 0x90, 0x01, 0x70, 0xf2, 0xb0, 0x08, 0x50, 0xc0, 0xf0, 0xe0,
+    0x90, 0x10, 0x09, 0x50, 0xc0, 0xf0, 0xe0, 0x90, 0x10, 0x09, 0x50, 0xc0,
+    0xf0, 0xe0, 0x90, 0x10, 0x09, 0x30, 0xd0, 0xf0, 0x90, 0x10, 0xf0, 0x70,
+    0x08, 0x30, 0xd0, 0xf0, 0x90, 0x10, 0xf0, 0x70, 0x0a, 0xc0, 0xd0, 0x0b,
+    0x30, 0xe0, 0xc1, 0xe0, 0x30, 0x09, 0x10, 0xc0, 0xe0, 0xb0, 0xf0, 0x60,
+    0x08, 0x90, 0xb0, 0xd0, 0xf0, 0xe0, 0x90, 0x10, 0x09, 0xf5, 0x08, 0x80,
+    0xc0, 0xe0, 0xd0, 0xc0, 0xe0, 0x30, 0x08, 0x70, 0x30, 0x03, 0x60, 0x50,
+    0x08, 0x80, 0xe0, 0x0d, 0xf0, 0x70, 0x0c, 0xd1, 0x40, 0xc0, 0xf0, 0x90,
+    0x00, 0x30, 0x40, 0x05, 0x60, 0xe0, 0x01, 0x70, 0xf0, 0x0a, 0x50, 0xf0,
+    0x70, 0x00, 0x20, 0xc1, 0x08, 0x50, 0xf0, 0x70, 0x00, 0x20, 0xc1, 0x08,
+    0x50, 0xf0, 0x70, 0x00, 0x20, 0xc1, 0x09, 0xd1, 0x50, 0x70, 0xa0, 0xf0,
+    0x70, 0x08, 0xd1, 0x50, 0x70, 0xa0, 0xf0, 0x70, 0x09, 0x30, 0xf1, 0x40,
+    0x09, 0x20, 0xe0, 0x70, 0x01, 0x70, 0xe0, 0x20, 0x08, 0x90, 0xd0, 0x10,
+    0x00, 0x30, 0xf0, 0x20, 0x07, 0x60, 0xf0, 0xa0, 0x00, 0x20, 0xc1, 0x09,
+    0x70, 0xe0, 0x50, 0x42, 0x08, 0x30, 0xf0, 0x90, 0x01, 0x70, 0xe0, 0x20,
+    0x07, 0x30, 0xd0, 0x30, 0x01, 0x60, 0xc0, 0x10, 0x08, 0x70, 0xf0, 0x20,
+    0x0c, 0xf0, 0x70, 0x0c, 0xf0, 0x70, 0x00, 0x70, 0xf0, 0x10, 0x09, 0xe0,
+    0x70, 0x40, 0x90, 0xf0, 0x0a, 0xc0, 0xb0, 0x02, 0x40, 0xf0, 0x50, 0x07,
+    0xc0, 0xb0, 0x02, 0x40, 0xf0, 0x50, 0x07, 0xc0, 0xb0, 0x02, 0x40, 0xf0,
+    0x50, 0x08, 0xf0, 0x70, 0x01, 0x40, 0xf0, 0x70, 0x08, 0xf0, 0x70, 0x01,
+    0x40, 0xf0, 0x70, 0x09, 0x90, 0xe0, 0xa1, 0x09, 0x80, 0xd0, 0x03, 0xd0,
+    0x80, 0x08, 0xe0, 0x70, 0x02, 0xc0, 0x70, 0x07, 0xc1, 0xe0, 0x30, 0x00,
+    0x50, 0xf0, 0x50, 0x09, 0x90, 0xa0, 0x0b, 0x80, 0xf0, 0xd0, 0x10, 0x01,
+    0xd0, 0x80, 0x08, 0x30, 0xd0, 0x30, 0x60, 0xc0, 0x10, 0x09, 0x40, 0xf0,
+    0x50, 0x0c, 0xf0, 0x70, 0x0c, 0xb1, 0x00, 0x70, 0xf0, 0x0a, 0x90, 0xe0,
+    0xb0, 0xd0, 0xf0, 0x0a, 0xf0, 0x70, 0x03, 0xf0, 0x70, 0x07, 0xf0, 0x70,
+    0x03, 0xf0, 0x70, 0x07, 0xf0, 0x70, 0x03, 0xf0, 0x70, 0x08, 0xf0, 0x70,
+    0x02, 0xf0, 0x70, 0x08, 0xf0, 0x70, 0x02, 0xf0, 0x70, 0x08, 0x10, 0xe0,
+    0x80, 0x30, 0xf0, 0x20, 0x08, 0xc0, 0x90, 0x03, 0x90, 0xc0, 0x08, 0xf0,
+    0x70, 0x02, 0xb0, 0x70, 0x07, 0xf0, 0x70, 0x40, 0xe0, 0x10, 0x00, 0xf0,
+    0x70, 0x09, 0x70, 0xf0, 0x0b, 0xc0, 0xa0, 0xb0, 0x70, 0x01, 0x90, 0xc0,
+    0x09, 0x30, 0xd0, 0xc0, 0x10, 0x0b, 0xf0, 0x70, 0x0c, 0xf0, 0x70, 0x0c,
+    0x30, 0xc0, 0xd1, 0xf3, 0x70, 0x06, 0x50, 0xf0, 0x10, 0x70, 0xf0, 0x0a,
+    0xf0, 0x70, 0x03, 0xf0, 0x70, 0x07, 0xf0, 0x70, 0x03, 0xf0, 0x70, 0x07,
+    0xf0, 0x70, 0x03, 0xf0, 0x70, 0x08, 0xf0, 0x70, 0x02, 0xf0, 0x70, 0x08,
+    0xf0, 0x70, 0x02, 0xf0, 0x70, 0x08, 0x60, 0xf0, 0x20, 0x00, 0xb0, 0x90,
+    0x08, 0xf0, 0x70, 0x03, 0x70, 0xf0, 0x08, 0xf0, 0x70, 0x02, 0xb0, 0x70,
+    0x07, 0xf0, 0x70, 0x00, 0x70, 0xb0, 0x00, 0xf0, 0x70, 0x09, 0x70, 0xf0,
+    0x0b, 0xf0, 0x70, 0x30, 0xf0, 0x20, 0x00, 0x70, 0xf0, 0x09, 0x60, 0xd0,
+    0xe0, 0x30, 0x0b, 0xc0, 0xa0, 0x0c, 0xf0, 0xd0, 0xb2, 0x80, 0x0a, 0x30,
+    0x90, 0xf0, 0x41, 0xf0, 0x70, 0x07, 0xd0, 0x60, 0x70, 0xf0, 0xb1, 0x30,
+    0x07, 0xc0, 0xb0, 0x02, 0x40, 0xf0, 0x50, 0x07, 0xc0, 0xb0, 0x02, 0x40,
+    0xf0, 0x50, 0x07, 0xc0, 0xb0, 0x02, 0x40, 0xf0, 0x50, 0x08, 0xf0, 0x70,
+    0x02, 0xf0, 0x70, 0x08, 0xf0, 0x70, 0x02, 0xf0, 0x70, 0x08, 0xd0, 0xb0,
+    0x01, 0x50, 0xe0, 0x10, 0x07, 0xf0, 0x70, 0x03, 0x70, 0xf0, 0x08, 0xf0,
+    0x70, 0x02, 0xb0, 0x70, 0x07, 0xc1, 0x01, 0xa0, 0xb0, 0xf0, 0x50, 0x08,
+    0x80, 0xd0, 0xf0, 0xb0, 0x60, 0x09, 0xf0, 0x70, 0x00, 0x80, 0xb0, 0x00,
+    0x70, 0xf0, 0x08, 0x60, 0xc0, 0x10, 0x60, 0xe0, 0x30, 0x09, 0x80, 0xe1,
+    0xb0, 0x30, 0x0a, 0xf0, 0x90, 0x42, 0x30, 0x08, 0x10, 0x20, 0x00, 0xa0,
+    0xf0, 0x70, 0x30, 0xf0, 0x30, 0x07, 0x80, 0xc0, 0x70, 0xf0, 0x41, 0x10,
+    0x07, 0x50, 0xf0, 0x70, 0x00, 0x20, 0xc1, 0x08, 0x50, 0xf0, 0x70, 0x00,
+    0x20, 0xc1, 0x08, 0x50, 0xf0, 0x70, 0x00, 0x20, 0xc1, 0x09, 0xf0, 0x70,
+    0x02, 0xf0, 0x70, 0x08, 0xf0, 0x70, 0x02, 0xf0, 0x70, 0x07, 0x40, 0xf0,
+    0x60, 0x02, 0xd0, 0x70, 0x07, 0xf0, 0x70, 0x03, 0x70, 0xf0, 0x08, 0xf0,
+    0x70, 0x02, 0xb0, 0x70, 0x07, 0x50, 0xf0, 0x70, 0x00, 0x30, 0xf0, 0xc0,
+    0x09, 0x30, 0x90, 0xf0, 0x40, 0x20, 0x09, 0xf0, 0x70, 0x00, 0x10, 0xd0,
+    0x50, 0x70, 0xf0, 0x07, 0x60, 0xc0, 0x10, 0x01, 0x60, 0xd0, 0x30, 0x08,
+    0x30, 0x90, 0xf0, 0x50, 0x10, 0x0a, 0xf0, 0x70, 0x0c, 0x40, 0xf1, 0xe0,
+    0x80, 0xe0, 0xf0, 0x80, 0x08, 0x30, 0xf0, 0x90, 0xf0, 0x0b, 0x50, 0xc0,
+    0xf0, 0xe0, 0x90, 0x10, 0x09, 0x50, 0xc0, 0xf0, 0xe0, 0x90, 0x10, 0x09,
+    0x50, 0xc0, 0xf0, 0xe0, 0x90, 0x10, 0x09, 0xf0, 0x70, 0x02, 0xf0, 0x70,
+    0x08, 0xf0, 0x70, 0x02, 0xf0, 0x70, 0x07, 0x90, 0xd0, 0x03, 0x70, 0xd0,
+    0x07, 0xb0, 0xa0, 0x03, 0xa0, 0xb0, 0x08, 0xf0, 0x70, 0x02, 0xb0, 0x70,
+    0x08, 0x50, 0xc0, 0xf1, 0xa0, 0xd0, 0x30, 0x09, 0x70, 0xf0, 0x0b, 0xb0,
+    0xa0, 0x01, 0x50, 0xd0, 0xc0, 0xb0, 0x07, 0x50, 0x10, 0x03, 0x31, 0x09,
+    0x30, 0xf0, 0x40, 0x0b, 0xf0, 0x70, 0x0f, 0x0f, 0xc0, 0xe0, 0xf0, 0x0f,
+    0x5b, 0x70, 0xe0, 0x10, 0x01, 0x10, 0xe0, 0x70, 0x08, 0xf0, 0x70, 0x02,
+    0xb0, 0x70, 0x0f, 0x0a, 0x70, 0xf0, 0x0b, 0x70, 0xe0, 0x10, 0x01, 0xb0,
+    0xf0, 0x70, 0x0f, 0x0b, 0xd0, 0x80, 0x0b, 0xf0, 0x90, 0x43, 0x20, 0x0f,
+    0x0a, 0x70, 0xf1, 0x41, 0x20, 0x08, 0x51, 0x00, 0x30, 0x70, 0x0a, 0x40,
+    0x60, 0x00, 0x40, 0x60, 0x0d, 0x70, 0x30, 0x0b, 0x70, 0x30, 0x00, 0x51,
+    0x0c, 0x70, 0x30, 0x0b, 0x70, 0x20, 0x00, 0x70, 0x20, 0x08, 0x10, 0xc0,
+    0x90, 0x11, 0x90, 0xc0, 0x10, 0x08, 0xf0, 0x70, 0x02, 0xb0, 0x70, 0x0f,
+    0x0a, 0x30, 0xf0, 0x50, 0x00, 0x30, 0x08, 0x10, 0xc0, 0x90, 0x11, 0x90,
+    0xf0, 0x30, 0x0f, 0x0b, 0x70, 0xe0, 0x20, 0x00, 0x20, 0x08, 0xb5, 0x60,
+    0x0f, 0x0a, 0x20, 0xb3, 0x60, 0x08, 0x20, 0xe0, 0x70, 0xe0, 0x50, 0x0a,
+    0x60, 0x80, 0x00, 0x60, 0x80, 0x0c, 0x90, 0xb0, 0x0c, 0x50, 0xe0, 0x70,
+    0xe0, 0x20, 0x0b, 0x90, 0xb0, 0x0c, 0xb0, 0x30, 0x00, 0xb0, 0x30, 0x09,
+    0x10, 0xa0, 0xf1, 0xa0, 0x10, 0x09, 0xb0, 0x60, 0x02, 0x80, 0x60, 0x0f,
+    0x0b, 0x60, 0xd0, 0xf0, 0xe0, 0x09, 0x20, 0xa0, 0xf1, 0xa0, 0x80, 0xb0,
+    0x0f, 0x0c, 0x70, 0xe0, 0xf0, 0x70, 0x09, 0x10, 0x40, 0x10, 0x0f, 0x1d,
+    0x30, 0x70, 0x50, 0x0f, 0x0d, 0x60, 0xb0, 0x20, 0x0d, 0x50, 0x70, 0x30,
+    0x0b, 0x60, 0xb0, 0x20, 0x0f, 0x0c, 0x10, 0x40, 0x00, 0x10, 0x40, 0x0b,
+    0x40, 0x10, 0x00, 0x40, 0x10, 0x0f, 0x4c, 0xa0, 0x90, 0x0f, 0x7c, 0x40,
+    0xf0, 0x00, 0x40, 0xf0, 0x0b, 0xf0, 0x40, 0x00, 0xf0, 0x40, 0x0f, 0x4c,
+    0x80, 0xf0, 0xc0, 0x0f, 0x5d, 0x50, 0xb0, 0x70, 0x0f, 0x7d, 0x20, 0x81,
+    0x0f, 0x5d, 0x10, 0x30, 0xe0, 0x0f, 0x7d, 0x40, 0xb0, 0x40, 0x10, 0x0f,
+    0x5c, 0x10, 0xc0, 0x10, 0x0f, 0x7b, 0x20, 0xb0, 0xf0, 0xc0, 0xb0, 0xd0,
+    0xa0, 0x08, 0x30, 0xd0, 0xf0, 0x90, 0x10, 0xf0, 0x70, 0x08, 0x50, 0xb0,
+    0xf1, 0xe0, 0xa0, 0x08, 0x30, 0xd0, 0xf0, 0xc0, 0x50, 0xa0, 0xf0, 0x70,
+    0x07, 0x30, 0xd0, 0xf0, 0xc0, 0x50, 0xa0, 0xf0, 0x70, 0x07, 0x30, 0xd0,
+    0xf0, 0xc0, 0x50, 0xa0, 0xf0, 0x70, 0x07, 0x30, 0xd0, 0xf0, 0xc0, 0x50,
+    0xa0, 0xf0, 0x70, 0x09, 0x50, 0xc0, 0xf1, 0xd0, 0x70, 0x08, 0x50, 0xb0,
+    0xf1, 0xe0, 0xa0, 0x09, 0x50, 0xb0, 0xf1, 0xe0, 0xa0, 0x09, 0x50, 0xb0,
+    0xf1, 0xe0, 0xa0, 0x0c, 0xf0, 0x70, 0x0d, 0xf0, 0x70, 0x0d, 0xf0, 0x70,
+    0x08, 0xc0, 0x70, 0x04, 0xb0, 0xc0, 0x06, 0xc0, 0x70, 0x04, 0xb0, 0xc0,
+    0x07, 0x10, 0xc0, 0xe0, 0x40, 0x02, 0x20, 0x08, 0xd1, 0x50, 0x70, 0xa0,
+    0xf0, 0x70, 0x07, 0x50, 0xf0, 0x90, 0x20, 0x00, 0x20, 0x60, 0x08, 0xd0,
+    0xb0, 0x10, 0x20, 0xa0, 0xf0, 0x50, 0x08, 0xd0, 0xb0, 0x10, 0x20, 0xa0,
+    0xf0, 0x50, 0x08, 0xd0, 0xb0, 0x10, 0x20, 0xa0, 0xf0, 0x50, 0x08, 0xd0,
+    0xb0, 0x10, 0x20, 0xa0, 0xf0, 0x50, 0x09, 0x50, 0xf0, 0x90, 0x20, 0x00,
+    0x20, 0x40, 0x07, 0x50, 0xf0, 0x90, 0x20, 0x00, 0x20, 0x60, 0x08, 0x50,
+    0xf0, 0x90, 0x20, 0x00, 0x20, 0x60, 0x08, 0x50, 0xf0, 0x90, 0x20, 0x00,
+    0x20, 0x60, 0x0c, 0xf0, 0x70, 0x0d, 0xf0, 0x70, 0x0d, 0xf0, 0x70, 0x08,
+    0x70, 0xd0, 0x03, 0x20, 0xf0, 0x70, 0x06, 0x70, 0xd0, 0x03, 0x20, 0xf0,
+    0x70, 0x07, 0x70, 0xf0, 0x30, 0x0d, 0xf0, 0x70, 0x01, 0x40, 0xf0, 0x70,
+    0x07, 0xc1, 0x0d, 0xe0, 0x70, 0x01, 0x40, 0xf0, 0x40, 0x08, 0xe0, 0x70,
+    0x01, 0x40, 0xf0, 0x40, 0x08, 0xe0, 0x70, 0x01, 0x40, 0xf0, 0x40, 0x08,
+    0xe0, 0x70, 0x01, 0x40, 0xf0, 0x40, 0x09, 0xc1, 0x0c, 0xc1, 0x0d, 0xc1,
+    0x0d, 0xc1, 0x0f, 0x02, 0xf0, 0x70, 0x0d, 0xf0, 0x70, 0x0d, 0xf0, 0x70,
+    0x08, 0x20, 0xf0, 0x30, 0x02, 0x70, 0xf0, 0x20, 0x06, 0x20, 0xf0, 0x30,
+    0x02, 0x70, 0xf0, 0x20, 0x07, 0xc0, 0xb0, 0x0e, 0xf0, 0x70, 0x02, 0xf0,
+    0x70, 0x07, 0xf0, 0x90, 0x44, 0x08, 0x70, 0xe0, 0x50, 0x00, 0x40, 0xf0,
+    0x40, 0x08, 0x70, 0xe0, 0x50, 0x00, 0x40, 0xf0, 0x40, 0x08, 0x70, 0xe0,
+    0x50, 0x00, 0x40, 0xf0, 0x40, 0x08, 0x70, 0xe0, 0x50, 0x00, 0x40, 0xf0,
+    0x40, 0x09, 0xf0, 0x70, 0x0c, 0xf0, 0x90, 0x44, 0x08, 0xf0, 0x90, 0x44,
+    0x08, 0xf0, 0x90, 0x44, 0x0c, 0xf0, 0x70, 0x0d, 0xf0, 0x70, 0x0d, 0xf0,
+    0x70, 0x09, 0xc0, 0xf4, 0xc0, 0x08, 0xc0, 0xf4, 0xc0, 0x08, 0xf0, 0x70,
+    0x0e, 0xf0, 0x70, 0x02, 0xf0, 0x70, 0x07, 0xf0, 0xd0, 0xb2, 0xd0, 0xf0,
+    0x09, 0x40, 0x90, 0xb0, 0xc0, 0xf0, 0x40, 0x09, 0x40, 0x90, 0xb0, 0xc0,
+    0xf0, 0x40, 0x09, 0x40, 0x90, 0xb0, 0xc0, 0xf0, 0x40, 0x09, 0x40, 0x90,
+    0xb0, 0xc0, 0xf0, 0x40, 0x09, 0xf0, 0x70, 0x0c, 0xf0, 0xd0, 0xb2, 0xd0,
+    0xf0, 0x08, 0xf0, 0xd0, 0xb2, 0xd0, 0xf0, 0x08, 0xf0, 0xd0, 0xb2, 0xd0,
+    0xf0, 0x0c, 0xf0, 0x70, 0x0d, 0xf0, 0x70, 0x0d, 0xf0, 0x70, 0x09, 0x70,
+    0xd0, 0x01, 0x20, 0xf0, 0x70, 0x08, 0x70, 0xd0, 0x01, 0x20, 0xf0, 0x70,
+    0x08, 0xf0, 0x70, 0x0e, 0xf0, 0x70, 0x02, 0xf0, 0x70, 0x07, 0xa0, 0x90,
+    0x02, 0x80, 0xd0, 0x0c, 0x40, 0xf0, 0x40, 0x0c, 0x40, 0xf0, 0x40, 0x0c,
+    0x40, 0xf0, 0x40, 0x0c, 0x40, 0xf0, 0x40, 0x09, 0xb0, 0xc0, 0x0c, 0xa0,
+    0x90, 0x02, 0x80, 0xd0, 0x08, 0xa0, 0x90, 0x02, 0x80, 0xd0, 0x08, 0xa0,
+    0x90, 0x02, 0x80, 0xd0, 0x0c, 0xf0, 0x70, 0x0d, 0xf0, 0x70, 0x0d, 0xf0,
+    0x70, 0x09, 0x20, 0xf0, 0x30, 0x00, 0x70, 0xf0, 0x20, 0x08, 0x20, 0xf0,
+    0x30, 0x00, 0x70, 0xf0, 0x20, 0x08, 0xd0, 0x80, 0x0e, 0xf0, 0x70, 0x02,
+    0xf0, 0x70, 0x07, 0x30, 0xf0, 0x70, 0x00, 0x30, 0xe0, 0x90, 0x08, 0x30,
+    0x60, 0x10, 0x00, 0x80, 0xf0, 0x20, 0x08, 0x30, 0x60, 0x10, 0x00, 0x80,
+    0xf0, 0x20, 0x08, 0x30, 0x60, 0x10, 0x00, 0x80, 0xf0, 0x20, 0x08, 0x30,
+    0x60, 0x10, 0x00, 0x80, 0xf0, 0x20, 0x09, 0x40, 0xf0, 0x90, 0x10, 0x00,
+    0x31, 0x07, 0x30, 0xf0, 0x70, 0x00, 0x30, 0xe0, 0x90, 0x08, 0x30, 0xf0,
+    0x70, 0x00, 0x30, 0xe0, 0x90, 0x08, 0x30, 0xf0, 0x70, 0x00, 0x30, 0xe0,
+    0x90, 0x0c, 0xf0, 0x70, 0x0d, 0xf0, 0x70, 0x0d, 0xf0, 0x70, 0x0a, 0xa0,
+    0x80, 0x00, 0xd0, 0xa0, 0x0a, 0xa0, 0x80, 0x00, 0xd0, 0xa0, 0x09, 0xa0,
+    0xd0, 0x0e, 0xf0, 0x70, 0x02, 0xf0, 0x70, 0x08, 0x40, 0xc0, 0xf0, 0xe0,
+    0x90, 0x10, 0x08, 0x20, 0xa0, 0xe0, 0xf0, 0xe0, 0x70, 0x09, 0x20, 0xa0,
+    0xe0, 0xf0, 0xe0, 0x70, 0x09, 0x20, 0xa0, 0xe0, 0xf0, 0xe0, 0x70, 0x09,
+    0x20, 0xa0, 0xe0, 0xf0, 0xe0, 0x70, 0x0b, 0x50, 0xc0, 0xf1, 0xd0, 0x60,
+    0x08, 0x40, 0xc0, 0xf0, 0xe0, 0x90, 0x10, 0x09, 0x40, 0xc0, 0xf0, 0xe0,
+    0x90, 0x10, 0x09, 0x40, 0xc0, 0xf0, 0xe0, 0x90, 0x10, 0x09, 0xf3, 0x70,
+    0x0a, 0xf3, 0x70, 0x0a, 0xf3, 0x70, 0x0a, 0x60, 0xe0, 0x30, 0xf0, 0x60,
+    0x0a, 0x60, 0xe0, 0x30, 0xf0, 0x60, 0x09, 0x40, 0xf0, 0x50, 0x0f, 0xce,
+    0x10, 0xf0, 0xc0, 0xf0, 0x10, 0x0a, 0x10, 0xf0, 0xc0, 0xf0, 0x10, 0x0a,
+    0x90, 0xe0, 0x60, 0x01, 0x40, 0x70, 0x09, 0x70, 0x20, 0x00, 0x70, 0x20,
+    0x0a, 0x50, 0x60, 0x0c, 0x51, 0x00, 0x30, 0x70, 0x0a, 0x40, 0x60, 0x00,
+    0x40, 0x60, 0x0c, 0x20, 0x70, 0x10, 0x0b, 0x10, 0x70, 0x30, 0x0f, 0x0c,
+    0x51, 0x00, 0x30, 0x70, 0x0a, 0x20, 0x70, 0x00, 0x20, 0x70, 0x0d, 0x70,
+    0x30, 0x0b, 0x60, 0x40, 0x00, 0x60, 0x40, 0x0a, 0x70, 0x30, 0x00, 0x51,
+    0x0b, 0x20, 0x70, 0x10, 0x0b, 0xa0, 0xf0, 0xa0, 0x0c, 0xa0, 0xf0, 0xa0,
+    0x0c, 0x60, 0xb0, 0xf1, 0xd0, 0x80, 0x09, 0xb0, 0x30, 0x00, 0xb0, 0x30,
+    0x0a, 0x10, 0xe0, 0x60, 0x0b, 0x20, 0xe0, 0x70, 0xe0, 0x50, 0x0a, 0x60,
+    0x80, 0x00, 0x60, 0x80, 0x0b, 0x10, 0xc0, 0x70, 0x0c, 0x70, 0x10, 0x80,
+    0x0f, 0x0c, 0x20, 0xe0, 0x70, 0xe0, 0x50, 0x0a, 0x30, 0xb0, 0x00, 0x30,
+    0xb0, 0x0c, 0x90, 0xb0, 0x0c, 0x80, 0x60, 0x00, 0x80, 0x60, 0x0a, 0x50,
+    0xe0, 0x70, 0xe0, 0x20, 0x0a, 0x10, 0xc0, 0x70, 0x0c, 0x50, 0xb0, 0x50,
+    0x0c, 0x70, 0xf0, 0x70, 0x0f, 0x1e, 0x50, 0xb0, 0x30, 0x0b, 0x30, 0x70,
+    0x50, 0x0f, 0x0d, 0x80, 0xa0, 0x0d, 0x30, 0x80, 0x60, 0x0f, 0x0d, 0x30,
+    0x70, 0x50, 0x0f, 0x0d, 0x60, 0xb0, 0x20, 0x0f, 0x0e, 0x50, 0x70, 0x30,
+    0x0b, 0x80, 0xa0, 0x0c, 0x30, 0x20, 0x00, 0x30, 0x20, 0x0b, 0x70, 0x00,
+    0x70, 0x0f, 0xdc, 0xb0, 0x70, 0x00, 0xb0, 0x70, 0x0b, 0x40, 0x70, 0x40,
+    0x0b, 0xf0, 0x70, 0x0f, 0x02, 0x70, 0xf0, 0x0f, 0x69, 0x70, 0xf0, 0xc0,
+    0x30, 0x0f, 0x10, 0x10, 0x41, 0x0b, 0x40, 0x0c, 0x41, 0x10, 0x0f, 0x1d,
+    0xf0, 0x70, 0x0f, 0x02, 0x70, 0xf0, 0x0f, 0x6b, 0x90, 0xd0, 0x0f, 0x0f,
+    0x60, 0xf0, 0xb1, 0x0b, 0xf0, 0x0c, 0xb1, 0xf0, 0x60, 0x0f, 0x1c, 0xf0,
+    0x70, 0x0f, 0x02, 0x70, 0xf0, 0x0f, 0x6c, 0xe0, 0x60, 0x0f, 0x0e, 0xe0,
+    0x50, 0x0d, 0xf0, 0x0e, 0x50, 0xe0, 0x0f, 0x1c, 0xf0, 0x80, 0xa0, 0xf0,
+    0xd0, 0x60, 0x09, 0x80, 0xf0, 0xd0, 0x60, 0x70, 0xf0, 0x0a, 0xf0, 0x70,
+    0x0c, 0xa0, 0xd0, 0xf1, 0xc0, 0x50, 0x0a, 0x30, 0xc0, 0xf2, 0x09, 0x30,
+    0xd0, 0xf0, 0x90, 0x10, 0xf0, 0x70, 0x0a, 0xe1, 0x0a, 0x80, 0xf0, 0x20,
+    0x00, 0x20, 0xf0, 0x80, 0x08, 0x90, 0xc0, 0x02, 0x70, 0xf0, 0x60, 0x0a,
+    0xc0, 0xd0, 0x0a, 0xf6, 0x0b, 0xf0, 0x40, 0x0d, 0xf0, 0x0e, 0x40, 0xf0,
+    0x0f, 0x1c, 0xf0, 0xe0, 0x40, 0x00, 0x70, 0xf0, 0x50, 0x07, 0x70, 0xf0,
+    0x70, 0x50, 0xb1, 0xf0, 0x0a, 0xf0, 0x70, 0x0c, 0x70, 0x30, 0x01, 0x70,
+    0xf0, 0x40, 0x09, 0xd0, 0xc0, 0x20, 0x0b, 0xd1, 0x50, 0x70, 0xa0, 0xf0,
+    0x70, 0x09, 0x60, 0xf0, 0xe0, 0x60, 0x09, 0xb0, 0xe0, 0x60, 0x00, 0x50,
+    0xf0, 0xb0, 0x08, 0x10, 0xd0, 0x80, 0x00, 0x30, 0xf0, 0x90, 0x0a, 0x30,
+    0xf1, 0x40, 0x09, 0x90, 0xe0, 0x20, 0x0f, 0x00, 0xf0, 0x70, 0x0d, 0xf0,
+    0x0e, 0x60, 0xf0, 0x0f, 0x1c, 0xf0, 0x70, 0x02, 0xa0, 0xb0, 0x07, 0xd0,
+    0xa0, 0x02, 0xa0, 0xf0, 0x0a, 0xf0, 0x70, 0x0f, 0x01, 0x30, 0xf0, 0x70,
+    0x09, 0xf0, 0x70, 0x0c, 0xf0, 0x70, 0x01, 0x40, 0xf0, 0x70, 0x09, 0xb0,
+    0xd0, 0x80, 0xb0, 0x09, 0xf0, 0x70, 0xa0, 0x00, 0x81, 0xf0, 0x09, 0x30,
+    0xf0, 0x60, 0xd0, 0xc0, 0x10, 0x0a, 0x90, 0xe0, 0xa1, 0x0a, 0x90, 0xc0,
+    0x10, 0x0e, 0xf0, 0x70, 0x0d, 0xf0, 0x0e, 0x70, 0xf0, 0x0e, 0x20, 0x70,
+    0x60, 0x0f, 0x0a, 0xf0, 0x70, 0x02, 0x70, 0xf0, 0x07, 0xf0, 0x70, 0x02,
+    0x70, 0xf0, 0x0a, 0xf0, 0x70, 0x0d, 0x10, 0x70, 0xc0, 0xf0, 0xe0, 0x20,
+    0x09, 0xf0, 0x70, 0x0c, 0xf0, 0x70, 0x02, 0xf0, 0x70, 0x08, 0x20, 0xf0,
+    0x70, 0x20, 0xf0, 0x20, 0x07, 0x30, 0xf0, 0x10, 0xe0, 0x00, 0xc0, 0x50,
+    0xc0, 0x30, 0x09, 0x70, 0xf0, 0xe0, 0x30, 0x0a, 0x10, 0xe0, 0x80, 0x30,
+    0xf0, 0x20, 0x0a, 0xb0, 0xc0, 0x10, 0x0c, 0x50, 0xf0, 0x40, 0x0d, 0xf0,
+    0x0e, 0x40, 0xf0, 0x50, 0x09, 0xe0, 0x10, 0x00, 0x70, 0xe0, 0x80, 0xc0,
+    0x60, 0x0f, 0x09, 0xf0, 0x70, 0x02, 0x70, 0xf0, 0x07, 0xf0, 0x70, 0x02,
+    0x70, 0xf0, 0x0a, 0xf0, 0x70, 0x0c, 0x40, 0xe0, 0xf0, 0xc0, 0x70, 0x10,
+    0x0a, 0xf0, 0x70, 0x0c, 0xf0, 0x70, 0x02, 0xf0, 0x70, 0x08, 0x90, 0xe0,
+    0x10, 0x00, 0xb0, 0x90, 0x07, 0x50, 0xc0, 0x00, 0xb0, 0x30, 0xf0, 0x10,
+    0xa0, 0x50, 0x09, 0x60, 0xf0, 0xe0, 0x20, 0x0a, 0x60, 0xf0, 0x20, 0x00,
+    0xb0, 0x90, 0x0a, 0x10, 0xc0, 0xb0, 0x0b, 0xf1, 0x70, 0x0e, 0xf0, 0x0f,
+    0x00, 0x70, 0xf1, 0x08, 0x70, 0xd1, 0xb0, 0x20, 0x00, 0x30, 0x80, 0x0f,
+    0x09, 0xf0, 0xa0, 0x02, 0xa0, 0xd0, 0x07, 0xb0, 0xa0, 0x02, 0x70, 0xf0,
+    0x0a, 0xf0, 0xc0, 0x10, 0x00, 0x20, 0x60, 0x08, 0xb0, 0xd0, 0x20, 0x0d,
+    0xf0, 0x70, 0x0c, 0xf0, 0x70, 0x02, 0xf0, 0x70, 0x07, 0x10, 0xe0, 0x90,
+    0x01, 0x60, 0xe0, 0x10, 0x06, 0x70, 0xa0, 0x00, 0x70, 0xb0, 0xc0, 0x00,
+    0x71, 0x08, 0x30, 0xe0, 0xa0, 0xb1, 0x0a, 0xd0, 0xb0, 0x01, 0x50, 0xe0,
+    0x10, 0x0a, 0x10, 0xc0, 0x90, 0x0b, 0x50, 0xf0, 0x40, 0x0d, 0xf0, 0x0e,
+    0x40, 0xf0, 0x50, 0x0a, 0x31, 0x0f, 0x0e, 0xf0, 0xb1, 0x50, 0x70, 0xf0,
+    0x70, 0x07, 0x50, 0xf0, 0x70, 0x00, 0x40, 0xe0, 0xf0, 0x0a, 0xf0, 0xb0,
+    0xc0, 0x60, 0x70, 0xb0, 0x08, 0x90, 0xd0, 0x20, 0x01, 0x40, 0x20, 0x09,
+    0xf0, 0x70, 0x0c, 0xf0, 0x70, 0x02, 0xf0, 0x70, 0x07, 0x60, 0xf0, 0x30,
+    0x02, 0xe0, 0x60, 0x06, 0xb0, 0x70, 0x00, 0x30, 0xf0, 0x80, 0x00, 0x40,
+    0xb0, 0x07, 0x10, 0xc0, 0xd0, 0x11, 0xe0, 0x70, 0x08, 0x40, 0xf0, 0x60,
+    0x02, 0xd0, 0x70, 0x0b, 0x30, 0xe0, 0x90, 0x0b, 0xf0, 0x70, 0x0d, 0xf0,
+    0x0e, 0x70, 0xf0, 0x0f, 0x1c, 0xf0, 0x70, 0x60, 0xe0, 0xf0, 0x80, 0x09,
+    0x50, 0xd0, 0xf0, 0xb0, 0x60, 0xf0, 0x0a, 0xf0, 0x70, 0x50, 0xd0, 0xf0,
+    0xa0, 0x08, 0x10, 0x90, 0xe0, 0xf1, 0xc0, 0x30, 0x07, 0xf5, 0xb0, 0x09,
+    0xf0, 0x70, 0x02, 0xf0, 0x70, 0x07, 0xc1, 0x03, 0x80, 0xc0, 0x06, 0xe0,
+    0x50, 0x01, 0x40, 0x20, 0x00, 0x20, 0xe0, 0x07, 0x90, 0xf0, 0x30, 0x01,
+    0x50, 0xf0, 0x30, 0x07, 0x90, 0xd0, 0x03, 0x70, 0xd0, 0x07, 0xb0, 0xf5,
+    0x0b, 0xf0, 0x70, 0x0d, 0xf0, 0x0e, 0x70, 0xf0, 0x0f, 0x5d, 0xf0, 0x70,
+    0x0f, 0x5f, 0xf0, 0x40, 0x0d, 0xf0, 0x0e, 0x40, 0xf0, 0x0f, 0x5d, 0xb0,
+    0x60, 0x0f, 0x5f, 0xf0, 0x40, 0x0d, 0xf0, 0x0e, 0x40, 0xf0, 0x0f, 0xce,
+    0x80, 0xd0, 0x71, 0x0b, 0xf0, 0x0c, 0x71, 0xd0, 0x80, 0x0f, 0xcf, 0x50,
+    0x71, 0x0b, 0x70, 0x0c, 0x71, 0x50, 0x0f, 0xff, 0x0f, 0x7d, 0x30, 0xb0,
+    0xf1, 0xc0, 0x50, 0x0f, 0x1a, 0xb0, 0xf1, 0xc0, 0x30, 0x0f, 0xbc, 0x60,
+    0x01, 0x70, 0xf0, 0x40, 0x0f, 0x19, 0x50, 0x01, 0xa0, 0xe0, 0x0f, 0xc0,
+    0xd0, 0x80, 0x0f, 0x1c, 0x40, 0xf0, 0x40, 0x0f, 0x5a, 0x30, 0xd0, 0xf0,
+    0xc0, 0x50, 0xa0, 0xf0, 0x70, 0x07, 0xf0, 0x70, 0xa0, 0xf0, 0xe0, 0x70,
+    0x0b, 0x40, 0xb0, 0xf1, 0xd0, 0x80, 0x07, 0x10, 0x90, 0xf0, 0xd0, 0x30,
+    0xb1, 0x09, 0x50, 0xb0, 0xf1, 0xe0, 0xa0, 0x0a, 0xb1, 0x0c, 0x80, 0xf0,
+    0xe0, 0x60, 0xb1, 0x09, 0xf0, 0x70, 0x02, 0xf0, 0x70, 0x0a, 0x40, 0xf0,
+    0x40, 0x0c, 0x40, 0xf0, 0x40, 0x0a, 0xf0, 0x70, 0x01, 0x30, 0xe0, 0xc0,
+    0x10, 0x0a, 0xf0, 0x70, 0x09, 0xf0, 0x40, 0x00, 0xb0, 0x70, 0x00, 0x70,
+    0xb0, 0x08, 0xf0, 0x70, 0x02, 0xf0, 0x70, 0x08, 0x50, 0xc0, 0xf0, 0xe0,
+    0x90, 0x10, 0x0f, 0x09, 0xd0, 0xb0, 0x10, 0x20, 0xa0, 0xf0, 0x50, 0x08,
+    0xf0, 0xe0, 0x50, 0x00, 0x40, 0xe0, 0x70, 0x09, 0x40, 0xf0, 0x90, 0x20,
+    0x00, 0x20, 0x40, 0x07, 0x70, 0xf0, 0x70, 0x50, 0xb0, 0xc0, 0xb0, 0x08,
+    0x50, 0xf0, 0x90, 0x20, 0x00, 0x20, 0x60, 0x0a, 0xb1, 0x0b, 0x70, 0xf0,
+    0x70, 0x50, 0xc0, 0xb1, 0x09, 0xf0, 0x70, 0x02, 0xf0, 0x70, 0x0a, 0x40,
+    0xf0, 0x40, 0x0c, 0x40, 0xf0, 0x40, 0x0a, 0xf0, 0x70, 0x00, 0x20, 0xe0,
+    0xc0, 0x10, 0x0b, 0xf0, 0x70, 0x09, 0xf0, 0x40, 0x00, 0xb0, 0x70, 0x00,
+    0x70, 0xb0, 0x08, 0xf0, 0x70, 0x02, 0xf0, 0x70, 0x07, 0x50, 0xf0, 0x70,
+    0x00, 0x20, 0xc1, 0x0f, 0x09, 0xe0, 0x70, 0x01, 0x40, 0xf0, 0x40, 0x08,
+    0xf0, 0x70, 0x02, 0x70, 0xe0, 0x09, 0xc1, 0x0c, 0xd0, 0xa0, 0x01, 0x10,
+    0xd0, 0xb0, 0x08, 0xc1, 0x0f, 0x00, 0xb1, 0x0b, 0xd0, 0xa0, 0x01, 0x10,
+    0xd0, 0xb0, 0x09, 0xf0, 0x70, 0x02, 0xf0, 0x70, 0x0a, 0x40, 0xf0, 0x40,
+    0x0c, 0x40, 0xf0, 0x40, 0x0a, 0xf0, 0x70, 0x10, 0xc0, 0xe0, 0x10, 0x0c,
+    0xf0, 0x70, 0x09, 0xf0, 0x40, 0x00, 0xb0, 0x70, 0x00, 0x70, 0xb0, 0x08,
+    0xf0, 0x70, 0x02, 0xf0, 0x70, 0x07, 0xc0, 0xb0, 0x02, 0x40, 0xf0, 0x50,
+    0x0f, 0x08, 0x70, 0xe0, 0x50, 0x00, 0x40, 0xf0, 0x40, 0x08, 0xf0, 0x70,
+    0x02, 0x40, 0xf0, 0x40, 0x08, 0xf0, 0x70, 0x0c, 0xf0, 0x70, 0x02, 0xb1,
+    0x08, 0xf0, 0x90, 0x44, 0x0a, 0xb1, 0x0b, 0xf0, 0x70, 0x02, 0xb1, 0x09,
+    0xf0, 0x70, 0x02, 0xf0, 0x70, 0x0a, 0x40, 0xf0, 0x40, 0x0c, 0x40, 0xf0,
+    0x40, 0x0a, 0xf0, 0x80, 0xc0, 0xe0, 0x30, 0x0d, 0xf0, 0x70, 0x09, 0xf0,
+    0x40, 0x00, 0xb0, 0x70, 0x00, 0x70, 0xb0, 0x08, 0xf0, 0x70, 0x02, 0xf0,
+    0x70, 0x07, 0xf0, 0x70, 0x03, 0xf0, 0x70, 0x0f, 0x09, 0x40, 0x90, 0xb0,
+    0xc0, 0xf0, 0x40, 0x08, 0xf0, 0x70, 0x02, 0x40, 0xf0, 0x40, 0x08, 0xf0,
+    0x70, 0x0c, 0xf0, 0x70, 0x02, 0xb1, 0x08, 0xf0, 0xd0, 0xb2, 0xd0, 0xf0,
+    0x0a, 0xb1, 0x0b, 0xf0, 0x70, 0x02, 0xb1, 0x09, 0xf0, 0x70, 0x02, 0xf0,
+    0x70, 0x0a, 0x40, 0xf0, 0x40, 0x0c, 0x40, 0xf0, 0x40, 0x0a, 0xf0, 0xa0,
+    0xe0, 0x70, 0x0e, 0xf0, 0x70, 0x09, 0xf0, 0x40, 0x00, 0xb0, 0x70, 0x00,
+    0x70, 0xb0, 0x08, 0xf0, 0x70, 0x02, 0xf0, 0x70, 0x07, 0xf0, 0x70, 0x03,
+    0xf0, 0x70, 0x0f, 0x0c, 0x40, 0xf0, 0x40, 0x08, 0xf0, 0xa0, 0x02, 0x70,
+    0xf0, 0x20, 0x08, 0xc1, 0x0c, 0xb0, 0xa0, 0x02, 0xb1, 0x08, 0xa0, 0x90,
+    0x02, 0x80, 0xd0, 0x0a, 0xb1, 0x0b, 0xa1, 0x02, 0xb1, 0x09, 0xf0, 0xb0,
+    0x02, 0xf0, 0x70, 0x0a, 0x40, 0xf0, 0x40, 0x0c, 0x40, 0xf0, 0x40, 0x0a,
+    0xf0, 0x70, 0x50, 0xf0, 0x60, 0x0d, 0xf0, 0x70, 0x09, 0xf0, 0x70, 0x00,
+    0xb1, 0x00, 0x70, 0xb0, 0x08, 0xf0, 0xb0, 0x02, 0xf0, 0x70, 0x07, 0xc0,
+    0xb0, 0x02, 0x40, 0xf0, 0x50, 0x0f, 0x08, 0x30, 0x60, 0x10, 0x00, 0x80,
+    0xf0, 0x20, 0x08, 0xf0, 0xb1, 0x50, 0x60, 0xe0, 0xb0, 0x09, 0x40, 0xf0,
+    0x90, 0x10, 0x00, 0x31, 0x07, 0x50, 0xf0, 0x60, 0x00, 0x70, 0xf0, 0xb0,
+    0x08, 0x30, 0xf0, 0x70, 0x00, 0x30, 0xe0, 0x90, 0x0a, 0xb1, 0x0b, 0x50,
+    0xf0, 0x40, 0x00, 0x70, 0xf0, 0xb0, 0x09, 0xf0, 0xb1, 0x40, 0x80, 0xf0,
+    0x60, 0x0a, 0x40, 0xf0, 0x40, 0x0c, 0x40, 0xf0, 0x40, 0x0a, 0xf0, 0x70,
+    0x00, 0x60, 0xe0, 0x30, 0x0c, 0xf0, 0x70, 0x09, 0xf0, 0xb0, 0x60, 0xd0,
+    0xb0, 0x90, 0xa0, 0xb0, 0x08, 0xf0, 0xb1, 0x40, 0x80, 0xf0, 0x60, 0x07,
+    0x50, 0xf0, 0x70, 0x00, 0x20, 0xc1, 0x0f, 0x09, 0x20, 0xa0, 0xe0, 0xf0,
+    0xe0, 0x70, 0x09, 0xf0, 0x70, 0x50, 0xd0, 0xf0, 0xb0, 0x10, 0x0a, 0x50,
+    0xc0, 0xf1, 0xd0, 0x60, 0x08, 0x70, 0xe0, 0xf0, 0x80, 0xb1, 0x09, 0x40,
+    0xc0, 0xf0, 0xe0, 0x90, 0x10, 0x08, 0xf6, 0x70, 0x08, 0x60, 0xe0, 0xf0,
+    0x90, 0x80, 0xb0, 0x09, 0xf0, 0x70, 0x50, 0xd0, 0xf0, 0x80, 0x09, 0xf3,
+    0x40, 0x09, 0x70, 0xf3, 0x40, 0x0a, 0xf0, 0x70, 0x01, 0x70, 0xe0, 0x30,
+    0x0b, 0xf0, 0x70, 0x09, 0xf0, 0x40, 0xb0, 0xe0, 0x20, 0x90, 0xf0, 0x50,
+    0x08, 0xf0, 0x70, 0x50, 0xd0, 0xf0, 0x80, 0x09, 0x50, 0xc0, 0xf0, 0xe0,
+    0x90, 0x10, 0x0f, 0x19, 0xf0, 0x70, 0x0f, 0x13, 0xb1, 0x0f, 0x0b, 0xb1,
+    0x0f, 0x0d, 0xf0, 0x70, 0x0f, 0x1e, 0xf0, 0x70, 0x0f, 0x01, 0xf0, 0x70,
+    0x0f, 0x2d, 0x20, 0x70, 0x10, 0x0f, 0x0a, 0xf0, 0x70, 0x0f, 0x13, 0xb1,
+    0x0f, 0x0b, 0xa0, 0xc0, 0x0f, 0x0d, 0xf0, 0x70, 0x0f, 0x1e, 0xf0, 0x70,
+    0x0f, 0x01, 0xf0, 0x70, 0x0f, 0x2c, 0x10, 0xc0, 0x70, 0x0f, 0x0b, 0xf0,
+    0x70, 0x0f, 0x13, 0xb1, 0x0f, 0x0b, 0x50, 0xf0, 0xb0, 0x71, 0x80, 0x0f,
+    0x09, 0xf0, 0x70, 0x0f, 0x00, 0x70, 0xf0, 0x40, 0x0c, 0x70, 0xf0, 0x40,
+    0x0a, 0xf0, 0x70, 0x0d, 0x72, 0xf0, 0x70, 0x0f, 0x2c, 0x80, 0xa0, 0x0f,
+    0x0c, 0x70, 0x40, 0x0f, 0x13, 0x61, 0x0f, 0x0c, 0x20, 0x72, 0x30, 0x0f,
+    0x09, 0x70, 0x40, 0x0f, 0x00, 0x60, 0xb0, 0x30, 0x0c, 0x60, 0xb0, 0x30,
+    0x0a, 0x70, 0x40, 0x0d, 0x73, 0x40, 0x0f, 0xff, 0x0f, 0x32, 0x30, 0x0f,
+    0x8b, 0x43, 0x30, 0x0d, 0x10, 0x40, 0x07, 0x43, 0x30, 0x0f, 0x30, 0x20,
+    0xb0, 0xf0, 0x60, 0x0f, 0x8a, 0xf0, 0xd0, 0xb1, 0x80, 0x0d, 0x70, 0x90,
+    0x07, 0xb2, 0xe0, 0xb0, 0x0f, 0x2e, 0x40, 0x50, 0xe0, 0x90, 0x30, 0x0f,
+    0x0a, 0x20, 0x41, 0x10, 0x0f, 0x0d, 0x30, 0x40, 0x10, 0x0f, 0x4d, 0xf0,
+    0x70, 0x0f, 0x00, 0x10, 0xe0, 0x20, 0x0a, 0xb1, 0x0f, 0x0a, 0xf8, 0x08,
+    0xf0, 0x70, 0x0d, 0x30, 0xe0, 0xc1, 0xe0, 0x50, 0x09, 0xf0, 0x70, 0x02,
+    0x70, 0xf0, 0x50, 0x07, 0xd0, 0xf0, 0xb1, 0xf0, 0x80, 0x0a, 0x70, 0xf0,
+    0x0c, 0x10, 0xc0, 0xe0, 0xb0, 0xf0, 0x60, 0x0a, 0x70, 0xf0, 0x70, 0x0a,
+    0x70, 0xf0, 0x50, 0x00, 0x80, 0xf0, 0x40, 0x07, 0x80, 0xd0, 0x10, 0x02,
+    0x60, 0xf0, 0x50, 0x09, 0x40, 0xf0, 0x40, 0x0a, 0xf6, 0x70, 0x0a, 0xf0,
+    0x70, 0x0f, 0x00, 0x70, 0x90, 0x0b, 0xb1, 0x0f, 0x1c, 0xf0, 0x70, 0x0c,
+    0x20, 0xe0, 0x70, 0x01, 0x70, 0xe0, 0x20, 0x08, 0xf0, 0x70, 0x01, 0x20,
+    0xe0, 0xa0, 0x08, 0x60, 0x10, 0x01, 0x30, 0xf0, 0x60, 0x09, 0x70, 0xf0,
+    0x0c, 0x90, 0xd0, 0x10, 0x00, 0x30, 0xf0, 0x20, 0x09, 0xc0, 0xf0, 0xc0,
+    0x0a, 0xb0, 0xf0, 0x70, 0x00, 0xb0, 0xe0, 0x70, 0x07, 0x10, 0xd0, 0x70,
+    0x01, 0x10, 0xe0, 0xb0, 0x0a, 0x40, 0xf0, 0x40, 0x0a, 0xa0, 0xe0, 0x20,
+    0x0f, 0x00, 0xf0, 0x70, 0x0e, 0x10, 0xe0, 0x20, 0x0b, 0xb1, 0x0f, 0x1c,
+    0xf0, 0x70, 0x0c, 0x80, 0xd0, 0x03, 0xd0, 0x80, 0x08, 0xf0, 0x70, 0x01,
+    0xb0, 0xe0, 0x10, 0x0d, 0xb1, 0x09, 0x70, 0xf0, 0x0c, 0xe0, 0x70, 0x02,
+    0xc0, 0x70, 0x08, 0x20, 0xf0, 0x90, 0xf0, 0x20, 0x09, 0xc0, 0xa0, 0xb0,
+    0x00, 0xf0, 0xa0, 0x80, 0x08, 0x40, 0xf0, 0x30, 0x00, 0x90, 0xe0, 0x20,
+    0x0a, 0x40, 0xf0, 0x40, 0x0a, 0x10, 0xe0, 0xb0, 0x0f, 0x00, 0xf0, 0x70,
+    0x0e, 0x70, 0x90, 0x0c, 0xb1, 0x0a, 0x90, 0x70, 0x03, 0x40, 0xd0, 0x0f,
+    0x09, 0xf0, 0x70, 0x0c, 0xc0, 0x90, 0x03, 0x90, 0xc0, 0x08, 0xf0, 0x70,
+    0x00, 0x50, 0xf0, 0x60, 0x0d, 0x10, 0xe0, 0xa0, 0x09, 0x70, 0xf0, 0x0c,
+    0xf0, 0x70, 0x02, 0xb0, 0x70, 0x08, 0x70, 0xf0, 0x20, 0xd0, 0x70, 0x09,
+    0xf0, 0x50, 0xe0, 0x30, 0xf0, 0x40, 0xb0, 0x09, 0xa0, 0xc0, 0x40, 0xf0,
+    0x70, 0x0b, 0x40, 0xf0, 0x40, 0x0b, 0x50, 0xf0, 0x70, 0x0e, 0xf0, 0x70,
+    0x0d, 0x10, 0xe0, 0x20, 0x0c, 0xb1, 0x0a, 0x20, 0xd0, 0x03, 0x90, 0x60,
+    0x0f, 0x09, 0xf0, 0xb0, 0x71, 0x30, 0x09, 0xf0, 0x70, 0x03, 0x70, 0xf0,
+    0x08, 0xf0, 0x90, 0x40, 0xe0, 0xb0, 0x0d, 0x60, 0xe1, 0x40, 0x09, 0x70,
+    0xf0, 0x0c, 0xf0, 0x70, 0x02, 0xb0, 0x70, 0x08, 0xc0, 0xb0, 0x00, 0x70,
+    0xc0, 0x08, 0x20, 0xf0, 0x20, 0xd0, 0x70, 0xc0, 0x20, 0xd0, 0x09, 0x10,
+    0xe1, 0xd0, 0x0c, 0x50, 0xf0, 0x50, 0x0c, 0xa0, 0xe0, 0x20, 0x0d, 0xf0,
+    0x70, 0x0d, 0x70, 0x90, 0x0d, 0xb1, 0x0b, 0x90, 0x60, 0x01, 0x20, 0xd0,
+    0x0f, 0x0a, 0xf0, 0xb0, 0x70, 0x80, 0xd0, 0xc0, 0x10, 0x07, 0xf0, 0x70,
+    0x03, 0x70, 0xf0, 0x08, 0xf0, 0xd0, 0xb0, 0xe0, 0xb0, 0x20, 0x0a, 0x40,
+    0xd0, 0xf0, 0xb0, 0x30, 0x0a, 0x70, 0xf0, 0x0c, 0xf0, 0x70, 0x02, 0xb0,
+    0x70, 0x07, 0x30, 0xf0, 0x60, 0x00, 0x20, 0xf0, 0x30, 0x07, 0x40, 0xf0,
+    0x00, 0xb0, 0xc0, 0x90, 0x00, 0xf0, 0x0a, 0x80, 0xf0, 0x50, 0x0c, 0xc0,
+    0xf0, 0xc0, 0x0c, 0x20, 0xe0, 0xb0, 0x0d, 0xf0, 0x70, 0x0c, 0x10, 0xe0,
+    0x20, 0x0d, 0xb1, 0x0b, 0x20, 0xd0, 0x01, 0x90, 0x60, 0x0f, 0x0a, 0xf0,
+    0x70, 0x01, 0x10, 0xd0, 0xa0, 0x07, 0xf0, 0x70, 0x03, 0x70, 0xf0, 0x08,
+    0xf0, 0x70, 0x01, 0x90, 0xe0, 0x10, 0x08, 0x60, 0xf0, 0xc0, 0x40, 0x0c,
+    0x70, 0xf0, 0x0c, 0xf0, 0x70, 0x02, 0xb0, 0x70, 0x07, 0x80, 0xf0, 0x10,
+    0x01, 0xc0, 0x80, 0x07, 0x70, 0xc0, 0x00, 0x70, 0xf0, 0x70, 0x00, 0xc0,
+    0x30, 0x08, 0x20, 0xe0, 0xf0, 0xb0, 0x0b, 0x60, 0xf0, 0x50, 0xe0, 0x60,
+    0x0c, 0x70, 0xf0, 0x50, 0x0c, 0xf0, 0x70, 0x0c, 0x70, 0x90, 0x0e, 0xb1,
+    0x0c, 0x90, 0x60, 0x20, 0xd0, 0x0f, 0x0b, 0xf0, 0x70, 0x02, 0x80, 0xf0,
+    0x07, 0xb0, 0xa0, 0x03, 0xa0, 0xb0, 0x08, 0xf0, 0x70, 0x01, 0x10, 0xf0,
+    0x70, 0x08, 0xe0, 0xa0, 0x0e, 0x70, 0xf0, 0x0c, 0xf0, 0x70, 0x02, 0xb0,
+    0x70, 0x07, 0xd0, 0xa0, 0x02, 0x70, 0xd0, 0x07, 0x70, 0xb0, 0x00, 0x40,
+    0xb0, 0x30, 0x00, 0xb0, 0x40, 0x08, 0xa0, 0xe0, 0x30, 0xe0, 0x50, 0x09,
+    0x10, 0xe0, 0xb0, 0x00, 0x70, 0xe0, 0x10, 0x0c, 0xb0, 0xe0, 0x10, 0x0b,
+    0xf0, 0x70, 0x0b, 0x10, 0xe0, 0x20, 0x0e, 0xb1, 0x0c, 0x40, 0xd0, 0x90,
+    0x70, 0x0f, 0x0b, 0xf0, 0x70, 0x02, 0x80, 0xf0, 0x07, 0x70, 0xe0, 0x10,
+    0x01, 0x10, 0xe0, 0x70, 0x08, 0xf0, 0x70, 0x01, 0x10, 0xf0, 0x70, 0x08,
+    0xf0, 0x40, 0x0e, 0x70, 0xf0, 0x0c, 0xf0, 0x70, 0x02, 0xb0, 0x70, 0x06,
+    0x30, 0xf0, 0x60, 0x02, 0x20, 0xf0, 0x30, 0x06, 0xb0, 0x80, 0x04, 0x71,
+    0x07, 0x40, 0xf0, 0x70, 0x00, 0x70, 0xe0, 0x10, 0x08, 0x80, 0xf0, 0x20,
+    0x01, 0xc0, 0x80, 0x0c, 0x20, 0xe0, 0xa0, 0x0b, 0xf0, 0x70, 0x0b, 0x70,
+    0x90, 0x0f, 0x00, 0xb1, 0x0d, 0xb0, 0xe0, 0x10, 0x0f, 0x0b, 0xf0, 0x90,
+    0x41, 0x70, 0xf0, 0x80, 0x07, 0x10, 0xc0, 0x90, 0x11, 0x90, 0xc0, 0x10,
+    0x08, 0xf0, 0x90, 0x40, 0x50, 0xa0, 0xe0, 0x20, 0x08, 0x90, 0xa0, 0x10,
+    0x00, 0x30, 0x70, 0x07, 0x42, 0x90, 0xf0, 0x42, 0x20, 0x08, 0xf0, 0x70,
+    0x02, 0xb0, 0x70, 0x06, 0x80, 0xf0, 0x10, 0x03, 0xa0, 0x80, 0x06, 0xc0,
+    0x70, 0x04, 0x70, 0x80, 0x07, 0xd0, 0xc0, 0x02, 0xc0, 0xa0, 0x07, 0x20,
+    0xf0, 0x70, 0x02, 0x40, 0xf0, 0x20, 0x07, 0x30, 0x43, 0x90, 0xf0, 0x50,
+    0x0a, 0xf0, 0x70, 0x0a, 0x10, 0xe0, 0x20, 0x0f, 0x00, 0xb1, 0x0d, 0x40,
+    0x70, 0x0f, 0x0c, 0xb3, 0xa0, 0x60, 0x09, 0x10, 0xa0, 0xf1, 0xa0, 0x10,
+    0x09, 0xb3, 0x90, 0x30, 0x09, 0x10, 0x90, 0xf1, 0xe0, 0xa0, 0x07, 0xb7,
+    0x60, 0x08, 0xb0, 0x60, 0x02, 0x80, 0x60, 0x06, 0x90, 0x70, 0x04, 0x50,
+    0x90, 0x06, 0xb0, 0x30, 0x04, 0x30, 0x80, 0x06, 0x50, 0xb0, 0x40, 0x02,
+    0x30, 0xb0, 0x20, 0x06, 0x70, 0xb0, 0x10, 0x03, 0x80, 0x70, 0x07, 0x80,
+    0xb5, 0x60, 0x0a, 0xf0, 0xb0, 0x71, 0x60, 0x07, 0x70, 0x90, 0x0d, 0x72,
+    0xd0, 0xb0, 0x0e, 0x10, 0x0f, 0xbe, 0x73, 0x60, 0x07, 0x70, 0x20, 0x0d,
+    0x73, 0x60, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0x21, 0x10, 0x41,
+    0x20, 0x0f, 0x2c, 0x10, 0x41, 0x20, 0x0f, 0x1b, 0x41, 0x0f, 0x3f, 0x41,
+    0x0b, 0x10, 0x90, 0xf1, 0xa0, 0x20, 0x07, 0xc0, 0x70, 0x04, 0xb0, 0xc0,
+    0x08, 0xf3, 0xe0, 0x70, 0x09, 0x10, 0x90, 0xf0, 0xd0, 0xb0, 0xd0, 0xa0,
+    0x08, 0xf2, 0xe0, 0x90, 0x20, 0x09, 0xf5, 0xb0, 0x08, 0xf0, 0x70, 0x0d,
+    0x10, 0x90, 0xf0, 0xc0, 0xb0, 0xe0, 0x90, 0x08, 0xf0, 0x70, 0x02, 0xf0,
+    0x70, 0x08, 0xf5, 0x70, 0x08, 0xf0, 0xc1, 0xe0, 0x50, 0x0a, 0xf0, 0x70,
+    0x02, 0xb0, 0xe0, 0x30, 0x07, 0xf5, 0x70, 0x07, 0xf0, 0x04, 0x70, 0xb0,
+    0x08, 0xf0, 0x40, 0x02, 0xd0, 0xb0, 0x08, 0x30, 0xe0, 0xc1, 0xe0, 0x30,
+    0x08, 0x10, 0xc0, 0x90, 0x10, 0x00, 0x50, 0x20, 0x07, 0x70, 0xd0, 0x03,
+    0x20, 0xf0, 0x70, 0x08, 0xf0, 0x70, 0x01, 0x40, 0xf0, 0x70, 0x08, 0xc0,
+    0xe0, 0x40, 0x02, 0x20, 0x08, 0xf0, 0x70, 0x00, 0x20, 0xa0, 0xe0, 0x20,
+    0x08, 0xf0, 0x70, 0x0d, 0xf0, 0x70, 0x0d, 0xc0, 0xe0, 0x40, 0x01, 0xb1,
+    0x08, 0xf0, 0x70, 0x02, 0xf0, 0x70, 0x0a, 0x70, 0xf0, 0x0b, 0x10, 0x01,
+    0x70, 0xe0, 0x0a, 0xf0, 0x70, 0x01, 0x70, 0xf0, 0x60, 0x08, 0xf0, 0x70,
+    0x0c, 0xf0, 0x04, 0x70, 0xb0, 0x08, 0xf0, 0x40, 0x01, 0x70, 0xf0, 0xb0,
+    0x07, 0x20, 0xe0, 0x70, 0x01, 0x70, 0xe0, 0x20, 0x07, 0x70, 0xa0, 0x00,
+    0x30, 0x70, 0x10, 0x60, 0x70, 0x20, 0x05, 0x20, 0xf0, 0x30, 0x02, 0x70,
+    0xf0, 0x20, 0x08, 0xf0, 0x70, 0x02, 0xb1, 0x07, 0x70, 0xf0, 0x30, 0x0d,
+    0xf0, 0x70, 0x02, 0xd0, 0xa0, 0x08, 0xf0, 0x70, 0x0d, 0xf0, 0x70, 0x0c,
+    0x60, 0xf0, 0x30, 0x02, 0xb1, 0x08, 0xf0, 0x70, 0x02, 0xf0, 0x70, 0x0a,
+    0x70, 0xf0, 0x0e, 0x40, 0xf0, 0x30, 0x09, 0xf0, 0x70, 0x00, 0x40, 0xf0,
+    0x90, 0x09, 0xf0, 0x70, 0x0c, 0xf0, 0x04, 0x70, 0xb0, 0x08, 0xf0, 0x40,
+    0x00, 0x10, 0xe0, 0xf0, 0xb0, 0x07, 0x80, 0xd0, 0x03, 0xd0, 0x80, 0x07,
+    0xc0, 0x40, 0x00, 0xe0, 0x91, 0xb0, 0x90, 0x20, 0x06, 0xc0, 0xf4, 0xc0,
+    0x09, 0xf0, 0x70, 0x01, 0x10, 0xe0, 0x90, 0x07, 0xb1, 0x0e, 0xf0, 0x70,
+    0x02, 0x70, 0xf0, 0x08, 0xf0, 0x70, 0x0d, 0xf0, 0x70, 0x0c, 0xb1, 0x03,
+    0xb1, 0x08, 0xf0, 0x70, 0x02, 0xf0, 0x70, 0x0a, 0x70, 0xf0, 0x0e, 0x40,
+    0xf0, 0x40, 0x09, 0xf0, 0x70, 0x10, 0xe0, 0xc0, 0x10, 0x09, 0xf0, 0x70,
+    0x0c, 0xf0, 0x00, 0x10, 0xe0, 0xa0, 0x00, 0x70, 0xb0, 0x08, 0xf0, 0x40,
+    0x00, 0x70, 0xf0, 0xb1, 0x07, 0xc0, 0x90, 0x03, 0x90, 0xc0, 0x07, 0xf0,
+    0x00, 0x40, 0xc0, 0x00, 0x90, 0xd0, 0x40, 0x07, 0x70, 0xd0, 0x01, 0x20,
+    0xf0, 0x70, 0x09, 0xf0, 0x70, 0x00, 0x30, 0xb0, 0xe0, 0x20, 0x07, 0xf0,
+    0x70, 0x0e, 0xf0, 0x70, 0x02, 0x40, 0xf0, 0x40, 0x07, 0xf0, 0x70, 0x0d,
+    0xf0, 0x90, 0x43, 0x08, 0xf0, 0x70, 0x03, 0x81, 0x08, 0xf0, 0x70, 0x02,
+    0xf0, 0x70, 0x0a, 0x70, 0xf0, 0x0e, 0x40, 0xf0, 0x40, 0x09, 0xf0, 0x70,
+    0xb0, 0xe0, 0x30, 0x0a, 0xf0, 0x70, 0x0c, 0xf0, 0x00, 0x60, 0xe0, 0xf0,
+    0x10, 0x70, 0xb0, 0x08, 0xf0, 0x40, 0x10, 0xe0, 0xb0, 0x70, 0xb0, 0x07,
+    0xf0, 0x70, 0x03, 0x70, 0xf0, 0x07, 0xf0, 0x00, 0x40, 0xb0, 0x00, 0x20,
+    0xf0, 0x40, 0x07, 0x20, 0xf0, 0x30, 0x00, 0x70, 0xf0, 0x20, 0x09, 0xf3,
+    0xc0, 0x10, 0x08, 0xf0, 0x70, 0x0e, 0xf0, 0x70, 0x02, 0x40, 0xf0, 0x40,
+    0x07, 0xf0, 0xd0, 0xb2, 0x80, 0x09, 0xf0, 0xd0, 0xb3, 0x08, 0xf0, 0x70,
+    0x0e, 0xf5, 0x70, 0x0a, 0x70, 0xf0, 0x0e, 0x40, 0xf0, 0x40, 0x09, 0xf0,
+    0xd0, 0xf0, 0x70, 0x0b, 0xf0, 0x70, 0x0c, 0xf0, 0x00, 0xa0, 0x90, 0xd0,
+    0x60, 0x70, 0xb0, 0x08, 0xf0, 0x40, 0x70, 0xf0, 0x40, 0x70, 0xb0, 0x07,
+    0xf0, 0x70, 0x03, 0x70, 0xf0, 0x07, 0xd0, 0x20, 0x10, 0xd0, 0x01, 0xc0,
+    0x40, 0x08, 0xa0, 0x80, 0x00, 0xd0, 0xa0, 0x0a, 0xf0, 0x70, 0x00, 0x30,
+    0xc0, 0xb0, 0x08, 0xe0, 0x90, 0x0e, 0xf0, 0x70, 0x02, 0x40, 0xf0, 0x40,
+    0x07, 0xf0, 0x90, 0x42, 0x30, 0x09, 0xf0, 0x70, 0x0c, 0xe0, 0x90, 0x0e,
+    0xf0, 0x70, 0x02, 0xf0, 0x70, 0x0a, 0x70, 0xf0, 0x0e, 0x40, 0xf0, 0x40,
+    0x09, 0xf0, 0x70, 0xb0, 0xa0, 0x0b, 0xf0, 0x70, 0x0c, 0xf0, 0x10, 0xf0,
+    0x40, 0x70, 0xa0, 0x70, 0xb0, 0x08, 0xf0, 0x60, 0xe0, 0x90, 0x00, 0x70,
+    0xb0, 0x07, 0xf0, 0x70, 0x03, 0x70, 0xf0, 0x07, 0x90, 0x70, 0x00, 0x80,
+    0x70, 0x00, 0xc0, 0x40, 0x08, 0x60, 0xe0, 0x30, 0xf0, 0x60, 0x0a, 0xf0,
+    0x70, 0x01, 0x20, 0xf0, 0x60, 0x07, 0xa0, 0xd0, 0x0e, 0xf0, 0x70, 0x02,
+    0x70, 0xf0, 0x10, 0x07, 0xf0, 0x70, 0x0d, 0xf0, 0x70, 0x0c, 0xa0, 0xd0,
+    0x0e, 0xf0, 0x70, 0x02, 0xf0, 0x70, 0x0a, 0x70, 0xf0, 0x0e, 0x40, 0xf0,
+    0x40, 0x09, 0xf0, 0x70, 0x20, 0xe0, 0x70, 0x0a, 0xf0, 0x70, 0x0c, 0xf0,
+    0x70, 0xd0, 0x00, 0x20, 0xe0, 0x70, 0xb0, 0x08, 0xf0, 0xd0, 0xf0, 0x20,
+    0x00, 0x70, 0xb0, 0x07, 0xb0, 0xa0, 0x03, 0xa0, 0xb0, 0x07, 0x40, 0xd0,
+    0x10, 0x00, 0x70, 0xb0, 0xd0, 0x40, 0x08, 0x10, 0xf0, 0xc0, 0xf0, 0x10,
+    0x0a, 0xf0, 0x70, 0x01, 0x10, 0xf0, 0x70, 0x07, 0x40, 0xf0, 0x50, 0x0d,
+    0xf0, 0x70, 0x01, 0x10, 0xd0, 0xa0, 0x08, 0xf0, 0x70, 0x0d, 0xf0, 0x70,
+    0x0c, 0x40, 0xf0, 0x50, 0x0d, 0xf0, 0x70, 0x02, 0xf0, 0x70, 0x0a, 0x70,
+    0xf0, 0x0e, 0x40, 0xf0, 0x40, 0x09, 0xf0, 0x70, 0x00, 0x50, 0xe0, 0x30,
+    0x09, 0xf0, 0x70, 0x0c, 0xf0, 0xc0, 0x80, 0x01, 0xc1, 0xb0, 0x08, 0xf1,
+    0x90, 0x01, 0x70, 0xb0, 0x07, 0x70, 0xe0, 0x10, 0x01, 0x10, 0xe0, 0x70,
+    0x08, 0x90, 0xc0, 0x20, 0x00, 0x40, 0xe0, 0x0a, 0xa0, 0xf0, 0xa0, 0x0b,
+    0xf0, 0x90, 0x40, 0x50, 0xc0, 0xf0, 0x20, 0x08, 0x90, 0xe0, 0x60, 0x01,
+    0x40, 0x70, 0x08, 0xf0, 0x90, 0x40, 0x60, 0xb0, 0xe0, 0x30, 0x08, 0xf0,
+    0x90, 0x43, 0x20, 0x08, 0xf0, 0x90, 0x43, 0x30, 0x08, 0x90, 0xe0, 0x60,
+    0x01, 0x30, 0x60, 0x08, 0xf0, 0x70, 0x02, 0xf0, 0x70, 0x08, 0x41, 0x90,
+    0xf0, 0x41, 0x20, 0x08, 0x10, 0x41, 0x70, 0xf0, 0x40, 0x09, 0xf0, 0x70,
+    0x01, 0x90, 0xc0, 0x09, 0xf0, 0x70, 0x0c, 0xf1, 0x30, 0x01, 0x70, 0xf0,
+    0xb0, 0x08, 0xf1, 0x20, 0x01, 0x70, 0xb0, 0x07, 0x10, 0xc0, 0x90, 0x11,
+    0x90, 0xc0, 0x10, 0x09, 0x70, 0xd0, 0xf0, 0xd0, 0x50, 0x0a, 0x50, 0xb0,
+    0x50, 0x0b, 0xb3, 0xa0, 0x40, 0x0a, 0x60, 0xb0, 0xf1, 0xd0, 0x80, 0x08,
+    0xb3, 0x70, 0x20, 0x09, 0xb5, 0x60, 0x08, 0xb5, 0x80, 0x09, 0x60, 0xb0,
+    0xf1, 0xd0, 0x80, 0x08, 0xb0, 0x60, 0x02, 0xb0, 0x60, 0x08, 0xb5, 0x60,
+    0x08, 0x30, 0xb3, 0x30, 0x09, 0xb0, 0x60, 0x01, 0x10, 0xa0, 0x60, 0x08,
+    0xb0, 0x60, 0x0c, 0xb0, 0xa0, 0x02, 0x20, 0xb0, 0x80, 0x08, 0xb0, 0x70,
+    0x02, 0x60, 0x80, 0x08, 0x10, 0xa0, 0xf1, 0xa0, 0x10, 0x0f, 0xff, 0x0f,
+    0xff, 0x0f, 0x8e, 0x30, 0x0f, 0xef, 0xa0, 0x80, 0x0f, 0x3d, 0x10, 0x40,
+    0x20, 0x0f, 0x1c, 0x10, 0x41, 0x20, 0x0f, 0x0c, 0x10, 0x41, 0x0d, 0x10,
+    0x40, 0x20, 0x0f, 0x0d, 0x30, 0x40, 0x20, 0x0b, 0x20, 0x40, 0x30, 0x0f,
+    0x0f, 0x10, 0xf0, 0x20, 0x0f, 0x3b, 0x60, 0xe0, 0xb0, 0xe0, 0x80, 0x0a,
+    0xf6, 0x70, 0x07, 0xf5, 0x40, 0x08, 0xf0, 0xc0, 0xb0, 0xf0, 0xb0, 0x10,
+    0x0c, 0x70, 0xf0, 0x0a, 0xf0, 0xb0, 0xc0, 0xe0, 0x50, 0x0a, 0x70, 0xf0,
+    0xb0, 0xe0, 0x90, 0x0a, 0x70, 0xf0, 0x10, 0x0b, 0x10, 0xc0, 0xe0, 0xb0,
+    0xe0, 0xb0, 0x10, 0x08, 0x70, 0xe0, 0xb0, 0xd0, 0xb0, 0x30, 0x0c, 0xf1,
+    0x40, 0x0c, 0xf1, 0x40, 0x0f, 0x00, 0x61, 0x0f, 0x08, 0x90, 0x20, 0x0f,
+    0x00, 0x40, 0xf0, 0x70, 0x0a, 0x20, 0xf0, 0x40, 0x00, 0x10, 0xe0, 0x60,
+    0x0c, 0xf0, 0x70, 0x0a, 0xd1, 0x43, 0x10, 0x08, 0x20, 0x01, 0x10, 0xe0,
+    0x90, 0x0c, 0x70, 0xf0, 0x0a, 0x10, 0x01, 0x90, 0xf0, 0x20, 0x08, 0x40,
+    0xe0, 0x30, 0x00, 0x10, 0xe0, 0x70, 0x09, 0x30, 0xf0, 0x50, 0x0b, 0xa0,
+    0xd0, 0x10, 0x00, 0x10, 0xc0, 0x90, 0x08, 0x20, 0x02, 0x60, 0xd0, 0x10,
+    0x0b, 0xf1, 0x40, 0x0c, 0xf1, 0x40, 0x0d, 0x60, 0xd0, 0xb0, 0x30, 0x0f,
+    0x08, 0x70, 0xe0, 0x90, 0x20, 0x0d, 0x20, 0x70, 0x40, 0x0a, 0x80, 0xc0,
+    0x02, 0x80, 0xc0, 0x0c, 0xf0, 0x70, 0x0a, 0x40, 0xf0, 0x40, 0x0f, 0x01,
+    0x80, 0xf0, 0x0c, 0x70, 0xf0, 0x0d, 0x10, 0xf0, 0x70, 0x08, 0xa0, 0x90,
+    0x02, 0x80, 0xd0, 0x0a, 0xb0, 0x90, 0x0b, 0xf0, 0x70, 0x02, 0x70, 0xf0,
+    0x0d, 0xb0, 0x70, 0x0b, 0x41, 0x10, 0x0c, 0x41, 0x10, 0x0b, 0x60, 0xd0,
+    0xb0, 0x40, 0x09, 0xf6, 0xb0, 0x08, 0x10, 0x70, 0xe0, 0x90, 0x20, 0x0f,
+    0x0a, 0xc0, 0x80, 0x02, 0x60, 0xf0, 0x10, 0x0b, 0xf0, 0x70, 0x0b, 0x70,
+    0xe0, 0x30, 0x0f, 0x00, 0x80, 0xe0, 0x08, 0xf6, 0x70, 0x0c, 0xf0, 0x70,
+    0x08, 0xd0, 0x70, 0x02, 0x70, 0xf0, 0x0a, 0x40, 0xf0, 0x20, 0x0a, 0xd0,
+    0x90, 0x02, 0xd0, 0xe0, 0x0a, 0x30, 0x40, 0x00, 0x70, 0xb0, 0x0f, 0x19,
+    0x60, 0xd0, 0xb0, 0x40, 0x0f, 0x0f, 0x10, 0x70, 0xe0, 0x90, 0x20, 0x0a,
+    0xb0, 0x60, 0x0a, 0xf0, 0x70, 0x02, 0x40, 0xf0, 0x40, 0x0b, 0xf0, 0x70,
+    0x0c, 0x90, 0xe0, 0x30, 0x0d, 0x30, 0xe0, 0x80, 0x08, 0xc0, 0x50, 0x01,
+    0x70, 0xf0, 0x0d, 0x70, 0xf0, 0x30, 0x08, 0xf0, 0x90, 0x02, 0xa0, 0xd0,
+    0x0b, 0xb0, 0x90, 0x0a, 0x50, 0xe0, 0x30, 0x20, 0xc0, 0xf0, 0x60, 0x08,
+    0x10, 0xb0, 0xf0, 0xb0, 0xd0, 0x70, 0xf0, 0x0f, 0x19, 0x20, 0x90, 0xe0,
+    0x70, 0x10, 0x0a, 0x76, 0x60, 0x0a, 0x40, 0xb0, 0xd0, 0x60, 0x0b, 0xc0,
+    0x90, 0x0a, 0xf0, 0x70, 0x02, 0x40, 0xf0, 0x40, 0x0b, 0xf0, 0x70, 0x0d,
+    0x90, 0xe0, 0x30, 0x09, 0x30, 0xb0, 0xc0, 0xe0, 0x70, 0x09, 0x30, 0xe0,
+    0x10, 0x00, 0x70, 0xf0, 0x0a, 0x60, 0x70, 0xb0, 0xf0, 0x60, 0x09, 0xf0,
+    0xd0, 0x40, 0x00, 0x70, 0xf0, 0x70, 0x0b, 0x40, 0xf0, 0x20, 0x0a, 0x60,
+    0xe0, 0xf0, 0xe0, 0x50, 0x09, 0x90, 0xe0, 0x30, 0x00, 0x10, 0xd0, 0xf0,
+    0x0b, 0x41, 0x10, 0x0c, 0x41, 0x10, 0x0b, 0x20, 0x90, 0xe0, 0x70, 0x10,
+    0x08, 0x76, 0x60, 0x08, 0x40, 0xb0, 0xd0, 0x60, 0x0d, 0x50, 0xf0, 0x50,
+    0x09, 0xf0, 0x70, 0x02, 0x40, 0xf0, 0x40, 0x0b, 0xf0, 0x70, 0x0e, 0xb0,
+    0xc0, 0x09, 0x10, 0x40, 0x50, 0xb0, 0xa0, 0x0a, 0x70, 0xb0, 0x00, 0x70,
+    0xf0, 0x0a, 0xb1, 0x70, 0x20, 0x0a, 0xe0, 0x50, 0xa0, 0xf0, 0xe0, 0x70,
+    0x0d, 0x91, 0x0a, 0x90, 0xf0, 0x90, 0xc0, 0x70, 0x09, 0xe0, 0x90, 0x02,
+    0x80, 0xf0, 0x0b, 0xf1, 0x40, 0x0c, 0xf1, 0x40, 0x0d, 0x20, 0x90, 0xe0,
+    0x50, 0x0f, 0x08, 0xb0, 0xd0, 0x60, 0x0f, 0x01, 0x60, 0xe0, 0x70, 0x08,
+    0xb0, 0x90, 0x02, 0x60, 0xf0, 0x0c, 0xf0, 0x70, 0x0e, 0x50, 0xf0, 0x30,
+    0x0b, 0x10, 0xd0, 0x70, 0x0a, 0xb0, 0x71, 0xf0, 0x0a, 0xb0, 0x70, 0x0c,
+    0xa0, 0x70, 0x0f, 0x02, 0x20, 0xe0, 0x40, 0x08, 0x60, 0xf0, 0x70, 0x00,
+    0x20, 0xf0, 0x60, 0x08, 0xf0, 0x70, 0x02, 0x70, 0xc0, 0x0b, 0xf1, 0x40,
+    0x0c, 0xf1, 0x40, 0x0f, 0x00, 0x20, 0x40, 0x0f, 0x08, 0x60, 0x0f, 0x04,
+    0x30, 0xf0, 0x50, 0x07, 0x70, 0xd0, 0x02, 0x90, 0xa0, 0x09, 0x20, 0x01,
+    0xf0, 0x70, 0x0e, 0x50, 0xf0, 0x40, 0x0c, 0xb1, 0x0a, 0x20, 0xd0, 0x90,
+    0xf0, 0x0a, 0xb0, 0x70, 0x0c, 0x60, 0xd0, 0x0f, 0x03, 0x70, 0xc0, 0x08,
+    0x70, 0xf0, 0x02, 0xb1, 0x08, 0xc0, 0x90, 0x02, 0xa0, 0x90, 0x0f, 0x4a,
+    0x70, 0x03, 0xb1, 0x07, 0x10, 0xe0, 0x70, 0x00, 0x40, 0xf0, 0x40, 0x09,
+    0xd1, 0x90, 0xf0, 0x70, 0x0a, 0x70, 0x30, 0x00, 0x20, 0xc0, 0xd0, 0x09,
+    0x60, 0x20, 0x00, 0x40, 0xf0, 0x70, 0x0b, 0x60, 0xf1, 0x0a, 0xb1, 0x72,
+    0x20, 0x09, 0xb0, 0x90, 0x20, 0x00, 0x30, 0x40, 0x09, 0x73, 0x80, 0xf0,
+    0x70, 0x07, 0x20, 0xf0, 0x60, 0x00, 0x40, 0xf0, 0x90, 0x08, 0x50, 0xf0,
+    0x40, 0x00, 0x70, 0xf0, 0x20, 0x0f, 0x4a, 0xf0, 0x20, 0x01, 0x60, 0xf0,
+    0x80, 0x08, 0x30, 0xc0, 0xf0, 0xd0, 0x60, 0x0b, 0x30, 0x70, 0xa0, 0x70,
+    0x0a, 0x70, 0xc0, 0xf1, 0xa0, 0x20, 0x09, 0xb0, 0xf1, 0xe0, 0x80, 0x0d,
+    0x80, 0xb0, 0x0a, 0x80, 0xb3, 0x30, 0x09, 0x10, 0x70, 0xe0, 0xf0, 0xd0,
+    0x60, 0x09, 0xb5, 0x60, 0x08, 0x50, 0xd0, 0xf1, 0xa0, 0x10, 0x09, 0x60,
+    0xd0, 0xf0, 0xc0, 0x50, 0x0f, 0x4b, 0xa0, 0xd0, 0xf1, 0xd0, 0x70, 0x10,
+    0x0f, 0xff, 0x0f, 0xff, 0x0f, 0x60, 0x10, 0x20, 0x07, 0x30, 0x0f, 0x22,
+    0x30, 0x0f, 0x1c, 0x40, 0x0f, 0x83, 0x10, 0x90, 0xf0, 0x60, 0x07, 0xd1,
+    0x50, 0x0f, 0x20, 0xa0, 0x80, 0x0f, 0x1b, 0x90, 0x60, 0x0f, 0x42, 0xf0,
+    0x09, 0x40, 0x10, 0x0f, 0x22, 0x20, 0xe0, 0x90, 0x10, 0x09, 0x40, 0xe0,
+    0x80, 0x0f, 0x1f, 0x10, 0xf0, 0x20, 0x0f, 0x1a, 0x30, 0xd0, 0x0f, 0x11,
+    0xf0, 0xb0, 0x0f, 0x0b, 0x20, 0xd0, 0x00, 0x60, 0x90, 0x0b, 0x90, 0xd0,
+    0xf1, 0xe0, 0x70, 0x07, 0x70, 0x90, 0x02, 0x80, 0xc1, 0x30, 0x08, 0x70,
+    0xd0, 0xf0, 0xd0, 0x70, 0x80, 0xf0, 0x60, 0x0f, 0x0a, 0xc0, 0xa0, 0x0c,
+    0x30, 0xf0, 0x50, 0x0f, 0x0e, 0xb0, 0x40, 0x0d, 0xf1, 0x40, 0x0f, 0x0d,
+    0xf1, 0x40, 0x0a, 0xb0, 0x60, 0x0f, 0x10, 0x70, 0x60, 0x0f, 0x0c, 0xc0,
+    0x30, 0x10, 0xe0, 0x0b, 0x80, 0x40, 0x00, 0xf0, 0x30, 0xf0, 0x60, 0x07,
+    0xb0, 0x50, 0x00, 0x50, 0xb0, 0x00, 0x40, 0xc0, 0x07, 0x70, 0xf0, 0x70,
+    0x00, 0x20, 0xb0, 0xf0, 0x70, 0x0f, 0x0a, 0x60, 0xf0, 0x20, 0x0d, 0x90,
+    0xd0, 0x0f, 0x0e, 0xb0, 0x40, 0x0d, 0xf1, 0x40, 0x0f, 0x0d, 0xf1, 0x40,
+    0x0a, 0x40, 0xd0, 0x0f, 0x2e, 0x80, 0x70, 0x00, 0xc0, 0x30, 0x0d, 0xf0,
+    0x00, 0xb1, 0x07, 0x20, 0xd0, 0x10, 0x71, 0x01, 0xf0, 0x07, 0xd0, 0xb0,
+    0x01, 0x10, 0xe0, 0xc0, 0xe0, 0x10, 0x0f, 0x09, 0xa0, 0xc0, 0x0e, 0x50,
+    0xf0, 0x30, 0x0f, 0x0d, 0xb0, 0x40, 0x0d, 0x41, 0x10, 0x0f, 0x0d, 0x41,
+    0x10, 0x0b, 0xb0, 0x60, 0x0f, 0x0f, 0x60, 0x30, 0x0f, 0x0b, 0xa0, 0xc0,
+    0xe0, 0xb0, 0xe0, 0xc0, 0xb0, 0x50, 0x0b, 0xf0, 0x30, 0xe0, 0x90, 0x08,
+    0x60, 0xb0, 0x50, 0xb0, 0x00, 0x40, 0xc0, 0x07, 0xf0, 0x70, 0x01, 0xb0,
+    0xe0, 0x10, 0xd0, 0x60, 0x0f, 0x09, 0xe0, 0x80, 0x0e, 0x10, 0xf0, 0x70,
+    0x0f, 0x0a, 0xb2, 0xe0, 0xc0, 0xb1, 0x60, 0x0f, 0x2a, 0x40, 0xd0, 0x0f,
+    0x0f, 0x70, 0x40, 0x0f, 0x0b, 0x30, 0x40, 0xf0, 0x40, 0x70, 0xc0, 0x40,
+    0x20, 0x0b, 0xf0, 0xe1, 0x30, 0x09, 0xa0, 0x70, 0x80, 0xc1, 0x30, 0x07,
+    0xb1, 0x00, 0x60, 0xf0, 0x40, 0x00, 0xb0, 0x90, 0x0f, 0x09, 0xf0, 0x70,
+    0x0f, 0x00, 0xf0, 0x70, 0x0b, 0x20, 0x01, 0x20, 0x09, 0x42, 0xc0, 0x70,
+    0x41, 0x20, 0x0f, 0x09, 0xf5, 0x0f, 0x0c, 0xb0, 0x60, 0x0f, 0x0e, 0x70,
+    0x40, 0x0f, 0x0d, 0xa0, 0x50, 0x00, 0xe0, 0x10, 0x0a, 0x30, 0xd0, 0xf0,
+    0x90, 0x10, 0x08, 0x20, 0x40, 0x10, 0xd0, 0x30, 0x0a, 0x30, 0xd0, 0xa0,
+    0xd0, 0xb0, 0x01, 0x81, 0x0f, 0x09, 0xf0, 0x70, 0x0f, 0x00, 0xf0, 0x70,
+    0x0b, 0xe0, 0x60, 0x20, 0xf0, 0x30, 0x0b, 0xb0, 0x40, 0x0f, 0x2e, 0x40,
+    0xd0, 0x0f, 0x0e, 0xb0, 0x70, 0x0f, 0x0b, 0x20, 0x70, 0xb1, 0x70, 0xd0,
+    0x90, 0x70, 0x08, 0x30, 0xe0, 0xc0, 0xf0, 0x09, 0x60, 0xc0, 0x80, 0xc0,
+    0x50, 0xc0, 0x0b, 0x10, 0xa0, 0xf0, 0xd0, 0x30, 0x0f, 0x0c, 0xb1, 0x0e,
+    0x40, 0xf0, 0x40, 0x0b, 0x60, 0xc0, 0x80, 0x90, 0x0c, 0xb0, 0x40, 0x0f,
+    0x2f, 0xb0, 0x60, 0x0f, 0x0d, 0xb0, 0x70, 0x0b, 0x60, 0x20, 0x00, 0x41,
+    0x09, 0x20, 0x71, 0xf0, 0x70, 0xa0, 0xc0, 0x70, 0x20, 0x07, 0xa0, 0xd0,
+    0x10, 0xf0, 0x09, 0xd0, 0x20, 0x00, 0x90, 0x60, 0x81, 0x0b, 0xc1, 0x70,
+    0xe0, 0x20, 0x0b, 0x71, 0x0c, 0x70, 0xf0, 0x10, 0x0d, 0x80, 0xe0, 0x0b,
+    0x20, 0x50, 0x40, 0x20, 0x60, 0x30, 0x0b, 0x60, 0x20, 0x0f, 0x2f, 0x40,
+    0xd0, 0x0f, 0x0d, 0xb0, 0x70, 0x0b, 0xb0, 0x40, 0x00, 0x71, 0x0c, 0xd0,
+    0x21, 0xd0, 0x09, 0xa0, 0xc0, 0x00, 0xf0, 0x09, 0xf0, 0x01, 0x71, 0x00,
+    0xc0, 0x40, 0x0a, 0xf0, 0x70, 0x10, 0xf0, 0x70, 0x0b, 0xb1, 0x0c, 0x10,
+    0xe0, 0x70, 0x0c, 0x10, 0xe0, 0x70, 0x0b, 0xb0, 0x70, 0x40, 0x61, 0xd0,
+    0x10, 0x0f, 0x3d, 0xb0, 0x60, 0x0f, 0x0c, 0xb0, 0x70, 0x0b, 0xd0, 0x60,
+    0x00, 0x91, 0x0c, 0x90, 0x60, 0x00, 0xd0, 0x20, 0x08, 0x50, 0xf0, 0x70,
+    0xf0, 0x40, 0x70, 0x60, 0x06, 0xa0, 0x70, 0x10, 0xd0, 0x30, 0x00, 0x30,
+    0xd0, 0x10, 0x09, 0xd0, 0xa0, 0x30, 0xf0, 0x70, 0x0b, 0xb1, 0x0d, 0x40,
+    0xf0, 0x60, 0x0a, 0x10, 0xc1, 0x0e, 0x60, 0x90, 0x0f, 0x40, 0x40, 0xd0,
+    0x0f, 0x0c, 0x80, 0x60, 0x0b, 0xf0, 0x70, 0x00, 0xb1, 0x0c, 0x40, 0x70,
+    0x00, 0x70, 0x50, 0x09, 0x40, 0xa0, 0xf0, 0xb0, 0x80, 0x30, 0x06, 0x10,
+    0x90, 0xb0, 0x50, 0x02, 0x70, 0xa0, 0x09, 0x30, 0xd0, 0xf0, 0x90, 0x10,
+    0x0b, 0xe1, 0x0e, 0x40, 0xd0, 0xc0, 0x40, 0x07, 0x90, 0xe0, 0x80, 0x10,
+    0x0e, 0x60, 0x80, 0x0f, 0x41, 0xb0, 0x60, 0x0f, 0x19, 0x70, 0x40, 0x00,
+    0x61, 0x0f, 0x0e, 0xb0, 0x0f, 0x1e, 0x71, 0x0f, 0x01, 0x50, 0x40, 0x07,
+    0x70, 0x20, 0x0f, 0x54, 0x30, 0x60, 0x0f, 0xf3,
+};
+
+// Unpack the font into one byte of alpha per pixel, font_width by
+// font_height, scaling each 4 bit value up to the full range of a byte.
+void font_unpack(unsigned char * pixels)
+{
+    const unsigned char * in = font_packed;
+    const unsigned char * in_end = font_packed + font_packed_size;
+    unsigned char * end = pixels + font_width * font_height;
+
+    while (in < in_end && pixels < end) {
+        unsigned char value = (*in >> 4) * 17;
+        unsigned int count = (*in & 15) + 1;
+        ++in;
+        if (count == 16 && in < in_end) {
+            count += *in++;
+        }
+        if (count > end - pixels) {
+            count = end - pixels;
+        }
+        memset(pixels, value, count);
+        pixels += count;
+    }
+    // Anything the packed data does not cover is left clear.
+    memset(pixels, 0, end - pixels);
+}
@@ -0,0 +1,224 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+// Generation of the blocks scattered over the ground, one chunk at a time.
+// The ground of each tier is an endless grid of cells, each half of the
+// tier's factor across, and each cell draws from its own random stream.
+// A block belongs to the chunk its position falls in, so chunks can be
+// generated in any order, on any thread, and always give the same blocks
+// for the same seed, with every block in exactly one chunk.
+
+#include "generate.h"
+#include "jobs.h"
+#include "rng.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <assert.h>
+
+// Start the stream for one cell of a tier. The tier picks the seed, and the
+// cell the stream, so no two cells of any tier share numbers.
+static void seed_cell(Rng * rng, unsigned long long seed, unsigned int tier,
+                      int i, int j)
+{
+    rng_seed(rng, seed + tier * 0x9e3779b97f4a7c15ull,
+             ((unsigned long long)(unsigned int)i << 32) | (unsigned int)j);
+}
+
+// The layout of the cells one chunk is generated from, worked out once and
+// shared by every row.
+typedef struct generate_rows {
+    GeneratedBlock * out;
+    float factor;
+    float min_size;
+    float size_range;
+    float side_x;
+    float side_y;
+    int chunk_x;
+    int chunk_y;
+    int i0;
+    int j0;
+    int rows;
+    int columns;
+    unsigned long long seed;
+    unsigned int tier;
+    // Room for the numbers drawn for one row, and its streams, for each
+    // row which may be generated at the same time.
+    float * jitter;
+    Rng * streams;
+    unsigned int * counts;
+} GenerateRows;
+
+static void generate_rows_init(GenerateRows * g, GeneratedBlock * out,
+                               float factor, float min_size, float max_size,
+                               int half_width, int half_height,
+                               int chunk_x, int chunk_y,
+                               unsigned long long seed, unsigned int tier)
+{
+    assert(min_size > 0.f);
+    assert(max_size > 0.f);
+
+    g->out = out;
+    g->factor = factor;
+    g->min_size = min_size;
+    g->size_range = log2f(max_size / min_size);
+    g->side_x = half_width * factor;
+    g->side_y = half_height * factor;
+    g->chunk_x = chunk_x;
+    g->chunk_y = chunk_y;
+
+    // A block is up to one cell from the corner of its own cell, so the
+    // blocks in this chunk come from the cells it covers and the ring of
+    // cells around it, which may round onto the edge.
+    g->i0 = (2 * chunk_x - 1) * half_width - 1;
+    g->j0 = (2 * chunk_y - 1) * half_height - 1;
+    g->rows = 2 * half_width + 3;
+    g->columns = 2 * half_height + 3;
+    g->seed = seed;
+    g->tier = tier;
+}
+
+// Generate the blocks from one row of cells into out, using the numbers
+// and streams of the given scratch row, and return the number made.
+static unsigned int generate_row(const GenerateRows * g, int r,
+                                 GeneratedBlock * out, int scratch)
+{
+    const int columns = g->columns;
+    const int i = g->i0 + r;
+    const int j0 = g->j0;
+    const float factor = g->factor;
+    const float centre = factor / 2;
+    float * jitter_x = g->jitter + 3 * columns * scratch;
+    float * jitter_y = jitter_x + columns;
+    float * sizes = jitter_x + 2 * columns;
+    Rng * streams = g->streams + columns * scratch;
+    unsigned int count = 0;
+    int c;
+
+    // Draw all the numbers for the position and size of every cell in
+    // the row first, and work out the sizes in one pass, so the loops
+    // are simple enough for the compiler to vectorise.
+    for (c = 0; c < columns; ++c) {
+        Rng * rng = &streams[c];
+        seed_cell(rng, g->seed, g->tier, i, j0 + c);
+        jitter_x[c] = rng_uniform(rng, -0.5f, 0.5f);
+        jitter_y[c] = rng_uniform(rng, -0.5f, 0.5f);
+        sizes[c] = rng_uniform(rng, 0.f, g->size_range);
+    }
+    for (c = 0; c < columns; ++c) {
+        sizes[c] = g->min_size * exp2f(sizes[c]);
+    }
+
+    // Blocks in another chunk, or in the middle, are rejected before
+    // drawing anything else for them.
+    for (c = 0; c < columns; ++c) {
+        float x = (i / 2.f + jitter_x[c]) * factor;
+        float y = ((j0 + c) / 2.f + jitter_y[c]) * factor;
+        float size = sizes[c];
+        if (generate_chunk_coord(x, g->side_x) != g->chunk_x ||
+            generate_chunk_coord(y, g->side_y) != g->chunk_y) {
+            continue;
+        }
+        if ((x + size) > -centre && x < centre &&
+            (y + size) > -centre && y < centre) {
+            continue;
+        }
+        Rng * rng = &streams[c];
+        GeneratedBlock * block = &out[count++];
+        block->x = x;
+        block->y = y;
+        block->size = size;
+        block->diffuse[0] = rng_uniform(rng, 0.f, 1.f);
+        block->diffuse[1] = rng_uniform(rng, 0.f, 1.f);
+        block->diffuse[2] = rng_uniform(rng, 0.f, 1.f);
+        block->diffuse[3] = 1.f;
+    }
+    return count;
+}
+
+// Generate the blocks in one chunk of a tier into out, which must have room
+// for generate_chunk_capacity() blocks, and return the number made. Sizes
+// are distributed logarithmically between min_size and max_size. Each chunk
+// is 2 * half_width cells by 2 * half_height cells, and chunk 0, 0 is
+// centred on the origin. Blocks in the middle of chunk 0, 0, where the
+// calamari starts, are left out.
+unsigned int generate_chunk(GeneratedBlock * out, float factor,
+                            float min_size, float max_size,
+                            int half_width, int half_height,
+                            int chunk_x, int chunk_y,
+                            unsigned long long seed, unsigned int tier)
+{
+    GenerateRows g;
+    generate_rows_init(&g, out, factor, min_size, max_size,
+                       half_width, half_height, chunk_x, chunk_y, seed, tier);
+    g.jitter = malloc(3 * g.columns * sizeof(float));
+    g.streams = malloc(g.columns * sizeof(Rng));
+    g.counts = 0;
+    assert(g.jitter != 0 && g.streams != 0);
+
+    unsigned int count = 0;
+    int r;
+    for (r = 0; r < g.rows; ++r) {
+        count += generate_row(&g, r, out + count, 0);
+    }
+
+    free(g.jitter);
+    free(g.streams);
+    assert(count <= generate_chunk_capacity(half_width, half_height));
+    return count;
+}
+
+// Each row of cells is a task. A row can make at most one block per
+// column, so it is generated into its own part of out, and the rows are
+// moved together once they are all done.
+static void row_task(void * context, unsigned int task)
+{
+    GenerateRows * g = context;
+    g->counts[task] = generate_row(g, task, g->out + task * g->columns,
+                                   task);
+}
+
+// Generate the same blocks as generate_chunk(), in the same order, with the
+// rows of cells split between the threads of the job pool. This must only
+// be called from the thread which runs jobs, and is for chunks which are
+// needed straight away.
+unsigned int generate_chunk_parallel(GeneratedBlock * out, float factor,
+                                     float min_size, float max_size,
+                                     int half_width, int half_height,
+                                     int chunk_x, int chunk_y,
+                                     unsigned long long seed,
+                                     unsigned int tier)
+{
+    if (jobs_thread_count() < 2) {
+        return generate_chunk(out, factor, min_size, max_size, half_width,
+                              half_height, chunk_x, chunk_y, seed, tier);
+    }
+
+    GenerateRows g;
+    generate_rows_init(&g, out, factor, min_size, max_size,
+                       half_width, half_height, chunk_x, chunk_y, seed, tier);
+    g.jitter = malloc(3 * g.rows * g.columns * sizeof(float));
+    g.streams = malloc(g.rows * g.columns * sizeof(Rng));
+    g.counts = malloc(g.rows * sizeof(unsigned int));
+    assert(g.jitter != 0 && g.streams != 0 && g.counts != 0);
+
+    jobs_run(g.rows, row_task, &g);
+
+    // Each row only ever moves down, to before where it was made.
+    unsigned int count = g.counts[0];
+    int r;
+    for (r = 1; r < g.rows; ++r) {
+        memmove(out + count, out + r * g.columns,
+                g.counts[r] * sizeof(GeneratedBlock));
+        count += g.counts[r];
+    }
+
+    free(g.jitter);
+    free(g.streams);
+    free(g.counts);
+    assert(count <= generate_chunk_capacity(half_width, half_height));
+    return count;
+}
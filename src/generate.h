@@ -0,0 +1,44 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#ifndef GENERATE_H
+#define GENERATE_H
+
+#include <math.h>
+
+// A block as generated, before it is added to a store.
+typedef struct generated_block {
+    float x;
+    float y;
+    float size;
+    float diffuse[4];
+} GeneratedBlock;
+
+// Return the chunk a position falls in, along an axis where each chunk is
+// side across. Chunk 0 is centred on the origin.
+static inline int generate_chunk_coord(float p, float side)
+{
+    return (int)floorf(p / side + 0.5f);
+}
+
+// Return the most blocks generate_chunk() can make for one chunk.
+static inline unsigned int generate_chunk_capacity(int half_width,
+                                                   int half_height)
+{
+    return (2 * half_width + 3) * (2 * half_height + 3);
+}
+
+unsigned int generate_chunk(GeneratedBlock * out, float factor,
+                            float min_size, float max_size,
+                            int half_width, int half_height,
+                            int chunk_x, int chunk_y,
+                            unsigned long long seed, unsigned int tier);
+unsigned int generate_chunk_parallel(GeneratedBlock * out, float factor,
+                                     float min_size, float max_size,
+                                     int half_width, int half_height,
+                                     int chunk_x, int chunk_y,
+                                     unsigned long long seed,
+                                     unsigned int tier);
+
+#endif // GENERATE_H
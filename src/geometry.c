@@ -0,0 +1,189 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#include "geometry.h"
+
+#include "extensions.h"
+#include "glstate.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265f
+#endif
+
+// Tessellations of the sphere, from coarsest to finest. Each is used when
+// the sphere is up to sphere_pixels_per_slice times its slice count in
+// radius on screen.
+#define sphere_levels 5
+static const int sphere_slices[sphere_levels] = { 6, 8, 12, 16, 24 };
+static const float sphere_pixels_per_slice = 6.f;
+
+static int use_buffers = 0;
+
+static Mesh cube;
+static Mesh grid;
+static Mesh spheres[sphere_levels];
+
+// The unit cube, as 6 quads, with the normal of each face.
+const float geometry_cube_vertices[GEOMETRY_CUBE_VERTICES][MESH_VERTEX_FLOATS] = {
+    { 0.f, 0.f, 1.f,  0.f, 0.f, 1.f }, { 1.f, 0.f, 1.f,  0.f, 0.f, 1.f },
+    { 1.f, 1.f, 1.f,  0.f, 0.f, 1.f }, { 0.f, 1.f, 1.f,  0.f, 0.f, 1.f },
+    { 0.f, 0.f, 0.f,  0.f, 0.f,-1.f }, { 1.f, 0.f, 0.f,  0.f, 0.f,-1.f },
+    { 1.f, 1.f, 0.f,  0.f, 0.f,-1.f }, { 0.f, 1.f, 0.f,  0.f, 0.f,-1.f },
+    { 0.f, 0.f, 0.f, -1.f, 0.f, 0.f }, { 0.f, 0.f, 1.f, -1.f, 0.f, 0.f },
+    { 0.f, 1.f, 1.f, -1.f, 0.f, 0.f }, { 0.f, 1.f, 0.f, -1.f, 0.f, 0.f },
+    { 1.f, 0.f, 1.f,  1.f, 0.f, 0.f }, { 1.f, 0.f, 0.f,  1.f, 0.f, 0.f },
+    { 1.f, 1.f, 0.f,  1.f, 0.f, 0.f }, { 1.f, 1.f, 1.f,  1.f, 0.f, 0.f },
+    { 0.f, 1.f, 1.f,  0.f, 1.f, 0.f }, { 1.f, 1.f, 1.f,  0.f, 1.f, 0.f },
+    { 1.f, 1.f, 0.f,  0.f, 1.f, 0.f }, { 0.f, 1.f, 0.f,  0.f, 1.f, 0.f },
+    { 0.f, 0.f, 0.f,  0.f,-1.f, 0.f }, { 1.f, 0.f, 0.f,  0.f,-1.f, 0.f },
+    { 1.f, 0.f, 1.f,  0.f,-1.f, 0.f }, { 0.f, 0.f, 1.f,  0.f,-1.f, 0.f },
+};
+
+static float * mesh_alloc(Mesh * mesh, GLenum mode, GLsizei count)
+{
+    mesh->mode = mode;
+    mesh->count = count;
+    mesh->buffer = 0;
+    mesh->vertices = malloc(count * MESH_VERTEX_FLOATS * sizeof(float));
+    assert(mesh->vertices != 0);
+    return mesh->vertices;
+}
+
+static inline float * put_vertex(float * v, float x, float y, float z,
+                                 float nx, float ny, float nz)
+{
+    v[0] = x; v[1] = y; v[2] = z;
+    v[3] = nx; v[4] = ny; v[5] = nz;
+    return v + MESH_VERTEX_FLOATS;
+}
+
+// Move the vertices of a mesh into a buffer object, if we can.
+static void mesh_upload(Mesh * mesh)
+{
+    if (!use_buffers) {
+        return;
+    }
+    glGenBuffers(1, &mesh->buffer);
+    glstate_bind_array_buffer(mesh->buffer);
+    glBufferData(GL_ARRAY_BUFFER,
+                 mesh->count * MESH_VERTEX_FLOATS * sizeof(float),
+                 mesh->vertices, GL_STATIC_DRAW);
+    free(mesh->vertices);
+    mesh->vertices = 0;
+}
+
+static void build_cube()
+{
+    float * v = mesh_alloc(&cube, GL_QUADS, GEOMETRY_CUBE_VERTICES);
+    memcpy(v, geometry_cube_vertices, sizeof(geometry_cube_vertices));
+    mesh_upload(&cube);
+}
+
+static void build_grid(int width, int height)
+{
+    float * v = mesh_alloc(&grid, GL_LINES, (width + 1 + height + 1) * 2);
+    int i;
+    for (i = 0; i <= width; ++i) {
+        v = put_vertex(v, i, 0.f, 0.f, 0.f, 0.f, 1.f);
+        v = put_vertex(v, i, height, 0.f, 0.f, 0.f, 1.f);
+    }
+    for (i = 0; i <= height; ++i) {
+        v = put_vertex(v, 0.f, i, 0.f, 0.f, 0.f, 1.f);
+        v = put_vertex(v, width, i, 0.f, 0.f, 0.f, 1.f);
+    }
+    mesh_upload(&grid);
+}
+
+// Build a unit sphere around the Z axis, with the same number of stacks
+// as slices, as a list of triangles.
+static void build_sphere(Mesh * mesh, int slices)
+{
+    int stacks = slices;
+    float * v = mesh_alloc(mesh, GL_TRIANGLES, stacks * slices * 6);
+    int i, j, k;
+    for (i = 0; i < stacks; ++i) {
+        for (j = 0; j < slices; ++j) {
+            // Corners of this quad, in the order the triangles use them.
+            static const int corner[6][2] = {
+                { 0, 0 }, { 1, 0 }, { 1, 1 }, { 0, 0 }, { 1, 1 }, { 0, 1 }
+            };
+            for (k = 0; k < 6; ++k) {
+                float theta = M_PI * (i + corner[k][0]) / stacks;
+                float phi = 2.f * M_PI * (j + corner[k][1]) / slices;
+                float x = sinf(theta) * cosf(phi);
+                float y = sinf(theta) * sinf(phi);
+                float z = cosf(theta);
+                v = put_vertex(v, x, y, z, x, y, z);
+            }
+        }
+    }
+    mesh_upload(mesh);
+}
+
+// Build all the static meshes. If buffers is true, buffer objects are
+// available and the meshes are stored in them.
+void geometry_init(int buffers, int grid_width, int grid_height)
+{
+    use_buffers = buffers;
+
+    build_cube();
+    build_grid(grid_width, grid_height);
+    int i;
+    for (i = 0; i < sphere_levels; ++i) {
+        build_sphere(&spheres[i], sphere_slices[i]);
+    }
+}
+
+// Return true if the meshes are held in buffer objects.
+int geometry_buffers()
+{
+    return use_buffers;
+}
+
+const Mesh * geometry_cube()
+{
+    return &cube;
+}
+
+static void mesh_draw(const Mesh * mesh)
+{
+    const GLsizei stride = MESH_VERTEX_FLOATS * sizeof(float);
+    const float * base = mesh->vertices;
+
+    glstate_bind_array_buffer(mesh->buffer);
+    glstate_enable_client(GL_NORMAL_ARRAY);
+    glstate_disable_client(GL_COLOR_ARRAY);
+    glstate_vertex_pointer(3, GL_FLOAT, stride, base);
+    glstate_normal_pointer(GL_FLOAT, stride, base + 3);
+    glDrawArrays(mesh->mode, 0, mesh->count);
+}
+
+void geometry_draw_cube()
+{
+    mesh_draw(&cube);
+}
+
+// Draw the grid lines, with the origin at one corner.
+void geometry_draw_grid()
+{
+    mesh_draw(&grid);
+}
+
+// Draw a unit sphere, tessellated to suit the radius it will have on
+// screen in pixels.
+void geometry_draw_sphere(float screen_radius)
+{
+    int level;
+    for (level = 0; level < sphere_levels - 1; ++level) {
+        if (screen_radius <= sphere_slices[level] * sphere_pixels_per_slice) {
+            break;
+        }
+    }
+    mesh_draw(&spheres[level]);
+}
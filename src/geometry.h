@@ -0,0 +1,35 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#ifndef GEOMETRY_H
+#define GEOMETRY_H
+
+#include <SDL_opengl.h>
+
+// A static mesh built once at startup. Vertices are interleaved position
+// and normal. If buffer objects are available the vertices are held in a
+// buffer, otherwise they are drawn from client memory.
+typedef struct mesh {
+    GLuint buffer;
+    float * vertices;
+    GLsizei count;
+    GLenum mode;
+} Mesh;
+
+// Number of floats in each vertex of a mesh.
+#define MESH_VERTEX_FLOATS 6
+
+// Number of vertices in the unit cube, drawn as quads.
+#define GEOMETRY_CUBE_VERTICES 24
+
+extern const float geometry_cube_vertices[GEOMETRY_CUBE_VERTICES][MESH_VERTEX_FLOATS];
+
+void geometry_init(int buffers, int width, int height);
+int geometry_buffers();
+const Mesh * geometry_cube();
+void geometry_draw_cube();
+void geometry_draw_grid();
+void geometry_draw_sphere(float screen_radius);
+
+#endif // GEOMETRY_H
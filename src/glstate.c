@@ -0,0 +1,255 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#include "glstate.h"
+
+#include "extensions.h"
+
+#include <string.h>
+
+GLStateStats glstate_stats;
+GLStateStats glstate_last_frame;
+
+// Capabilities tracked by glstate_enable() and glstate_disable(). All of
+// these are disabled when a context is created.
+static const GLenum tracked_caps[] = {
+    GL_TEXTURE_2D, GL_BLEND, GL_DEPTH_TEST, GL_LIGHTING, GL_LIGHT1,
+    GL_NORMALIZE, GL_COLOR_MATERIAL
+};
+#define cap_count (sizeof(tracked_caps) / sizeof(GLenum))
+
+static const GLenum tracked_arrays[] = {
+    GL_VERTEX_ARRAY, GL_NORMAL_ARRAY, GL_COLOR_ARRAY, GL_TEXTURE_COORD_ARRAY
+};
+#define array_count (sizeof(tracked_arrays) / sizeof(GLenum))
+
+// Arguments of the last call to set one of the array pointers, along with
+// the buffer bound at the time, which the pointer is relative to.
+typedef struct array_pointer {
+    int valid;
+    GLint size;
+    GLenum type;
+    GLsizei stride;
+    const GLvoid * pointer;
+    GLuint buffer;
+} ArrayPointer;
+
+static struct {
+    unsigned char caps[cap_count];
+    unsigned char arrays[array_count];
+    GLuint texture;
+    GLuint array_buffer;
+    GLenum blend_src;
+    GLenum blend_dst;
+    int material_valid;
+    GLfloat material[4];
+    GLenum matrix_mode;
+    ArrayPointer vertex;
+    ArrayPointer normal;
+    ArrayPointer colour;
+    ArrayPointer tex_coord;
+} state;
+
+// Reset the record to the state of a newly created context. Material and
+// array pointers are not known, so the first call to set them always goes
+// through.
+void glstate_init()
+{
+    memset(&state, 0, sizeof(state));
+    state.blend_src = GL_ONE;
+    state.blend_dst = GL_ZERO;
+    state.matrix_mode = GL_MODELVIEW;
+    memset(&glstate_stats, 0, sizeof(GLStateStats));
+    memset(&glstate_last_frame, 0, sizeof(GLStateStats));
+}
+
+// Called at the start of each frame to keep the counts for the last one.
+void glstate_frame()
+{
+    glstate_last_frame = glstate_stats;
+    memset(&glstate_stats, 0, sizeof(GLStateStats));
+}
+
+// Return true, and count the call as issued, if the state needs to change.
+static inline int changed(int differs)
+{
+    if (differs) {
+        ++glstate_stats.issued;
+    } else {
+        ++glstate_stats.elided;
+    }
+    return differs;
+}
+
+static unsigned char * find(unsigned char * flags, const GLenum * names,
+                            unsigned int count, GLenum name)
+{
+    unsigned int i;
+    for (i = 0; i < count; ++i) {
+        if (names[i] == name) {
+            return &flags[i];
+        }
+    }
+    return 0;
+}
+
+static void set_cap(GLenum cap, unsigned char on)
+{
+    unsigned char * flag = find(state.caps, tracked_caps, cap_count, cap);
+    if (flag != 0 && !changed(*flag != on)) {
+        return;
+    }
+    if (flag == 0) {
+        ++glstate_stats.issued;
+    } else {
+        *flag = on;
+    }
+    if (cap == GL_COLOR_MATERIAL) {
+        // The material follows the current colour while this is enabled.
+        state.material_valid = 0;
+    }
+    if (on) {
+        glEnable(cap);
+    } else {
+        glDisable(cap);
+    }
+}
+
+void glstate_enable(GLenum cap)
+{
+    set_cap(cap, 1);
+}
+
+void glstate_disable(GLenum cap)
+{
+    set_cap(cap, 0);
+}
+
+static void set_array(GLenum array, unsigned char on)
+{
+    unsigned char * flag = find(state.arrays, tracked_arrays, array_count,
+                                array);
+    if (flag != 0 && !changed(*flag != on)) {
+        return;
+    }
+    if (flag == 0) {
+        ++glstate_stats.issued;
+    } else {
+        *flag = on;
+    }
+    if (on) {
+        glEnableClientState(array);
+    } else {
+        glDisableClientState(array);
+    }
+}
+
+void glstate_enable_client(GLenum array)
+{
+    set_array(array, 1);
+}
+
+void glstate_disable_client(GLenum array)
+{
+    set_array(array, 0);
+}
+
+// Bind a texture to GL_TEXTURE_2D.
+void glstate_bind_texture(GLuint texture)
+{
+    if (changed(state.texture != texture)) {
+        state.texture = texture;
+        glBindTexture(GL_TEXTURE_2D, texture);
+    }
+}
+
+// Bind a buffer to GL_ARRAY_BUFFER. Buffer 0 is bound when a context is
+// created, so this can be used to make sure client side arrays are in use
+// even if buffers are not available.
+void glstate_bind_array_buffer(GLuint buffer)
+{
+    if (changed(state.array_buffer != buffer)) {
+        state.array_buffer = buffer;
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    }
+}
+
+void glstate_blend_func(GLenum sfactor, GLenum dfactor)
+{
+    if (changed(state.blend_src != sfactor || state.blend_dst != dfactor)) {
+        state.blend_src = sfactor;
+        state.blend_dst = dfactor;
+        glBlendFunc(sfactor, dfactor);
+    }
+}
+
+// Set the ambient and diffuse colour of front faces.
+void glstate_material(const GLfloat colour[4])
+{
+    if (changed(!state.material_valid ||
+                memcmp(state.material, colour, sizeof(state.material)))) {
+        state.material_valid = 1;
+        memcpy(state.material, colour, sizeof(state.material));
+        glMaterialfv(GL_FRONT, GL_AMBIENT_AND_DIFFUSE, colour);
+    }
+}
+
+void glstate_matrix_mode(GLenum mode)
+{
+    if (changed(state.matrix_mode != mode)) {
+        state.matrix_mode = mode;
+        glMatrixMode(mode);
+    }
+}
+
+// Record a new array pointer, returning true if it is different.
+static int set_pointer(ArrayPointer * current, GLint size, GLenum type,
+                       GLsizei stride, const GLvoid * pointer)
+{
+    if (!changed(!current->valid || current->size != size ||
+                 current->type != type || current->stride != stride ||
+                 current->pointer != pointer ||
+                 current->buffer != state.array_buffer)) {
+        return 0;
+    }
+    current->valid = 1;
+    current->size = size;
+    current->type = type;
+    current->stride = stride;
+    current->pointer = pointer;
+    current->buffer = state.array_buffer;
+    return 1;
+}
+
+void glstate_vertex_pointer(GLint size, GLenum type, GLsizei stride,
+                            const GLvoid * pointer)
+{
+    if (set_pointer(&state.vertex, size, type, stride, pointer)) {
+        glVertexPointer(size, type, stride, pointer);
+    }
+}
+
+void glstate_normal_pointer(GLenum type, GLsizei stride,
+                            const GLvoid * pointer)
+{
+    if (set_pointer(&state.normal, 3, type, stride, pointer)) {
+        glNormalPointer(type, stride, pointer);
+    }
+}
+
+void glstate_color_pointer(GLint size, GLenum type, GLsizei stride,
+                           const GLvoid * pointer)
+{
+    if (set_pointer(&state.colour, size, type, stride, pointer)) {
+        glColorPointer(size, type, stride, pointer);
+    }
+}
+
+void glstate_tex_coord_pointer(GLint size, GLenum type, GLsizei stride,
+                               const GLvoid * pointer)
+{
+    if (set_pointer(&state.tex_coord, size, type, stride, pointer)) {
+        glTexCoordPointer(size, type, stride, pointer);
+    }
+}
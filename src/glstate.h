@@ -0,0 +1,48 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#ifndef GLSTATE_H
+#define GLSTATE_H
+
+#include <SDL_opengl.h>
+
+// Record of the OpenGL state most often set while drawing, so calls which
+// would not change anything can be skipped. Any code which changes the
+// state tracked here must do so through these functions, or the record
+// will no longer match the real state.
+
+// Number of calls passed on to OpenGL and skipped.
+typedef struct glstate_stats {
+    unsigned int issued;
+    unsigned int elided;
+} GLStateStats;
+
+// Counts for the frame in progress, and the last complete frame.
+extern GLStateStats glstate_stats;
+extern GLStateStats glstate_last_frame;
+
+void glstate_init();
+void glstate_frame();
+
+void glstate_enable(GLenum cap);
+void glstate_disable(GLenum cap);
+void glstate_enable_client(GLenum array);
+void glstate_disable_client(GLenum array);
+
+void glstate_bind_texture(GLuint texture);
+void glstate_bind_array_buffer(GLuint buffer);
+void glstate_blend_func(GLenum sfactor, GLenum dfactor);
+void glstate_material(const GLfloat colour[4]);
+void glstate_matrix_mode(GLenum mode);
+
+void glstate_vertex_pointer(GLint size, GLenum type, GLsizei stride,
+                            const GLvoid * pointer);
+void glstate_normal_pointer(GLenum type, GLsizei stride,
+                            const GLvoid * pointer);
+void glstate_color_pointer(GLint size, GLenum type, GLsizei stride,
+                           const GLvoid * pointer);
+void glstate_tex_coord_pointer(GLint size, GLenum type, GLsizei stride,
+                               const GLvoid * pointer);
+
+#endif // GLSTATE_H
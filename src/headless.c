@@ -0,0 +1,259 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+// Run the world simulation without a display, driven by a script of
+// control changes or an input trace recorded by the game, and report how
+// fast it ran. This needs neither SDL nor
+// OpenGL, so it can be run on build machines.
+
+#include "world.h"
+#include "chunk.h"
+#include "collide.h"
+#include "jobs.h"
+#include "logger.h"
+#include "replay.h"
+#include "snapshot.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <assert.h>
+
+// A change to the controls held down, made at the start of a step.
+typedef struct script_entry {
+    unsigned long step;
+    Controls controls;
+} ScriptEntry;
+
+static ScriptEntry * script = 0;
+static unsigned int script_length = 0;
+
+static const unsigned long default_steps = 10000;
+// The same step as the default simulation rate of the game.
+static const float default_delta = 1.f / 120.f;
+
+// Steps between turns, and the length of each turn, when no script is
+// given.
+static const unsigned long default_leg = 600;
+static const unsigned long default_turn = 60;
+
+static void usage(const char * prog)
+{
+    fprintf(stderr, "usage: %s [-n steps] [-d delta] [-s script] "
+                    "[-k kernel] [-j threads]\n"
+                    "       [--seed seed] [--record input_trace] "
+                    "[--replay input_trace]\n"
+                    "       [--load snapshot] [--save snapshot]\n", prog);
+    fprintf(stderr, "Script lines are a step number followed by the "
+                    "controls held from that step on,\n"
+                    "using the game keys d, c, k and m, f for flip, "
+                    "or - for none.\n"
+                    "A replayed trace runs every step it holds, in the world "
+                    "it was recorded in.\n"
+                    "A loaded snapshot replaces setting up the world, and "
+                    "one is saved after the\nlast step if asked for.\n"
+                    "Log messages go to stdout, and the results to "
+                    "stderr. Per-step messages are\nonly logged when "
+                    "built with -DLOG_LEVEL_MIN=LOG_DEBUG.\n");
+}
+
+static void parse_controls(const char * keys, Controls * out)
+{
+    memset(out, 0, sizeof(Controls));
+    for (; *keys != 0; ++keys) {
+        switch (*keys) {
+            case 'd':
+                out->left_forward = true;
+                break;
+            case 'c':
+                out->left_back = true;
+                break;
+            case 'k':
+                out->right_forward = true;
+                break;
+            case 'm':
+                out->right_back = true;
+                break;
+            case 'f':
+                out->flip = true;
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+static int load_script(const char * filename)
+{
+    FILE * fp = fopen(filename, "r");
+    if (fp == NULL) {
+        perror(filename);
+        return 0;
+    }
+
+    char line[256];
+    unsigned int capacity = 0;
+    while (fgets(line, sizeof(line), fp) != NULL) {
+        unsigned long step;
+        char keys[64];
+        if (line[0] == '#' || sscanf(line, "%lu %63s", &step, keys) != 2) {
+            continue;
+        }
+        if (script_length == capacity) {
+            capacity = capacity ? capacity * 2 : 64;
+            script = realloc(script, capacity * sizeof(ScriptEntry));
+            assert(script != 0);
+        }
+        script[script_length].step = step;
+        parse_controls(keys, &script[script_length].controls);
+        ++script_length;
+    }
+    fclose(fp);
+    return 1;
+}
+
+// Set the controls for the given step. Without a script the calamari
+// rolls forwards, turning alternately left and right now and then, so it
+// covers some ground.
+static void script_controls(unsigned long step, unsigned int * next)
+{
+    if (script != 0) {
+        while (*next < script_length && script[*next].step <= step) {
+            controls = script[(*next)++].controls;
+        }
+        return;
+    }
+    unsigned long leg = step % (default_leg * 2);
+    bool turning_left = leg < default_turn;
+    bool turning_right = leg >= default_leg && leg < default_leg + default_turn;
+    controls.left_forward = !turning_left;
+    controls.right_forward = !turning_right;
+}
+
+static double now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char ** argv)
+{
+    unsigned long steps = default_steps;
+    float delta = default_delta;
+    // Zero gives one thread for each processor.
+    int threads = 0;
+    const char * record_filename = NULL;
+    const char * replay_filename = NULL;
+    const char * load_filename = NULL;
+    const char * save_filename = NULL;
+    int i;
+
+    for (i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            steps = strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "-d") == 0 && i + 1 < argc) {
+            delta = strtof(argv[++i], NULL);
+        } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            if (!load_script(argv[++i])) {
+                return 1;
+            }
+        } else if (strcmp(argv[i], "-k") == 0 && i + 1 < argc) {
+            if (!collide_kernel_select(argv[++i])) {
+                fprintf(stderr, "Collision kernel %s is not available\n",
+                        argv[i]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            world_seed = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            record_filename = argv[++i];
+        } else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            replay_filename = argv[++i];
+        } else if (strcmp(argv[i], "--load") == 0 && i + 1 < argc) {
+            load_filename = argv[++i];
+        } else if (strcmp(argv[i], "--save") == 0 && i + 1 < argc) {
+            save_filename = argv[++i];
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    // Replaying a trace sets the seed to the one it was recorded with.
+    if (replay_filename != NULL && !replay_open(replay_filename)) {
+        return 1;
+    }
+    if (record_filename != NULL &&
+        !replay_record_open(record_filename, delta)) {
+        return 1;
+    }
+
+    logger_init();
+    chunk_stream_init();
+    threads = jobs_init(threads);
+
+    double start = now();
+    if (load_filename != NULL) {
+        if (!snapshot_load(load_filename)) {
+            return 1;
+        }
+    } else {
+        setup();
+    }
+    double setup_time = now() - start;
+
+    unsigned int next = 0;
+    unsigned long step;
+    start = now();
+    if (replay_filename != NULL) {
+        ReplayFrame frame;
+        ReplayEvent event;
+        step = 0;
+        while ((event = replay_next(&delta, &frame)) != REPLAY_END) {
+            if (event == REPLAY_STEP) {
+                replay_record_step(delta);
+                update(delta);
+                ++step;
+            } else {
+                replay_record_frame(frame.microseconds, frame.fraction);
+            }
+        }
+        steps = step;
+    } else {
+        for (step = 0; step < steps; ++step) {
+            script_controls(step, &next);
+            replay_record_step(delta);
+            update(delta);
+            // There is no display, but a frame is recorded after each
+            // step so the trace replays in the game at the speed it
+            // simulates.
+            replay_record_frame(delta * 1e6f, 1.f);
+        }
+    }
+    double elapsed = now() - start;
+    replay_record_close();
+    replay_close();
+    int saved = save_filename == NULL || snapshot_save(save_filename);
+
+    jobs_shutdown();
+    chunk_stream_shutdown();
+    logger_shutdown();
+
+    fprintf(stderr, "Setup: %.3f ms\n", setup_time * 1000.);
+    fprintf(stderr, "Steps: %lu of %g s in %.3f s\n", steps, delta, elapsed);
+    fprintf(stderr, "Throughput: %.0f steps/s, %.0f blocks/s\n",
+            steps / elapsed, blocks_tested / elapsed);
+    fprintf(stderr, "Collision kernel: %s, %d threads\n",
+            collide_kernel_name(), threads);
+    fprintf(stderr, "Chunks: %lu loaded, %lu unloaded, %lu waited for\n",
+            chunks_loaded, chunks_unloaded, chunks_waited);
+    fprintf(stderr, "Final: scale %f, %d tiers, position (%f, %f)\n",
+            scale, tier_count, pos_x, pos_y);
+    return saved ? 0 : 1;
+}
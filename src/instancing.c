@@ -0,0 +1,275 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#include "instancing.h"
+
+#include "extensions.h"
+#include "geometry.h"
+#include "glstate.h"
+#include "logger.h"
+#include "matrix.h"
+
+#include <stdlib.h>
+#include <assert.h>
+
+// Number of floats stored for each instance.
+#define INSTANCE_FLOATS 8
+
+enum { position_attrib = 0, normal_attrib = 1 };
+
+static const char * vertex_shader_source =
+    "#version 140\n"
+    "uniform mat4 modelview_projection;\n"
+    "uniform samplerBuffer instances;\n"
+    "uniform usamplerBuffer visible;\n"
+    "uniform vec3 light_direction;\n"
+    "uniform float ambient;\n"
+    "in vec3 position;\n"
+    "in vec3 normal;\n"
+    "out vec4 colour;\n"
+    "void main()\n"
+    "{\n"
+    "    int instance = int(texelFetch(visible, gl_InstanceID).r);\n"
+    "    vec4 place = texelFetch(instances, instance * 2);\n"
+    "    vec4 diffuse = texelFetch(instances, instance * 2 + 1);\n"
+    "    vec3 world = vec3(place.xy, 0.0) + position * place.z;\n"
+    "    gl_Position = modelview_projection * vec4(world, 1.0);\n"
+    "    float light = ambient + max(dot(normal, light_direction), 0.0);\n"
+    "    colour = vec4(min(diffuse.rgb * light, 1.0), diffuse.a);\n"
+    "}\n";
+
+static const char * fragment_shader_source =
+    "#version 140\n"
+    "in vec4 colour;\n"
+    "out vec4 fragment;\n"
+    "void main()\n"
+    "{\n"
+    "    fragment = colour;\n"
+    "}\n";
+
+static GLuint program = 0;
+static GLint modelview_projection_uniform;
+static GLint instances_uniform;
+static GLint visible_uniform;
+static GLint light_direction_uniform;
+static GLint ambient_uniform;
+
+// Scratch space used to interleave the store when uploading every block.
+static float * staging = 0;
+static unsigned int staging_capacity = 0;
+
+static GLuint compile_shader(GLenum type, const char * source)
+{
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, NULL);
+    glCompileShader(shader);
+
+    GLint status;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+    if (status != GL_TRUE) {
+        char log[1024];
+        glGetShaderInfoLog(shader, sizeof(log), NULL, log);
+        log_error(LOG_GRAPHICS, "Shader compile failed: %s", log);
+        glDeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+// Build the shader used to draw instanced blocks. Returns false if the
+// instanced path cannot be used, in which case blocks must be drawn one
+// at a time. The extensions must have been loaded, and the geometry built
+// into buffers.
+int instancing_init()
+{
+    GLuint vertex_shader = compile_shader(GL_VERTEX_SHADER,
+                                          vertex_shader_source);
+    GLuint fragment_shader = compile_shader(GL_FRAGMENT_SHADER,
+                                            fragment_shader_source);
+    if (vertex_shader == 0 || fragment_shader == 0) {
+        return 0;
+    }
+
+    program = glCreateProgram();
+    glAttachShader(program, vertex_shader);
+    glAttachShader(program, fragment_shader);
+    glBindAttribLocation(program, position_attrib, "position");
+    glBindAttribLocation(program, normal_attrib, "normal");
+    glLinkProgram(program);
+    glDeleteShader(vertex_shader);
+    glDeleteShader(fragment_shader);
+
+    GLint status;
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+    if (status != GL_TRUE) {
+        char log[1024];
+        glGetProgramInfoLog(program, sizeof(log), NULL, log);
+        log_error(LOG_GRAPHICS, "Shader link failed: %s", log);
+        program = 0;
+        return 0;
+    }
+
+    modelview_projection_uniform = glGetUniformLocation(program,
+                                                        "modelview_projection");
+    instances_uniform = glGetUniformLocation(program, "instances");
+    visible_uniform = glGetUniformLocation(program, "visible");
+    light_direction_uniform = glGetUniformLocation(program, "light_direction");
+    ambient_uniform = glGetUniformLocation(program, "ambient");
+
+    return 1;
+}
+
+void instancing_batch_init(InstanceBatch * batch)
+{
+    glGenBuffers(1, &batch->buffer);
+    glGenTextures(1, &batch->texture);
+    glGenBuffers(1, &batch->visible_buffer);
+    glGenTextures(1, &batch->visible_texture);
+    batch->capacity = 0;
+    batch->count = 0;
+    batch->visible_capacity = 0;
+}
+
+void instancing_batch_clear(InstanceBatch * batch)
+{
+    glDeleteTextures(1, &batch->texture);
+    glDeleteBuffers(1, &batch->buffer);
+    glDeleteTextures(1, &batch->visible_texture);
+    glDeleteBuffers(1, &batch->visible_buffer);
+    batch->buffer = 0;
+    batch->texture = 0;
+    batch->visible_buffer = 0;
+    batch->visible_texture = 0;
+    batch->capacity = 0;
+    batch->count = 0;
+    batch->visible_capacity = 0;
+}
+
+static void pack_instance(const BlockStore * blocks, unsigned int i,
+                          float * out)
+{
+    out[0] = blocks->x[i];
+    out[1] = blocks->y[i];
+    out[2] = blocks->scale[i];
+    out[3] = 0.f;
+    out[4] = blocks->diffuse[i][0];
+    out[5] = blocks->diffuse[i][1];
+    out[6] = blocks->diffuse[i][2];
+    out[7] = blocks->diffuse[i][3];
+}
+
+// Bring the batch up to date with the ground blocks in the store. Only the
+// blocks the store has recorded as changed are uploaded, unless too many
+// have changed, or the buffer is too small.
+void instancing_batch_update(InstanceBatch * batch, BlockStore * blocks)
+{
+    const size_t instance_size = INSTANCE_FLOATS * sizeof(float);
+    unsigned int i;
+
+    glBindBuffer(GL_TEXTURE_BUFFER, batch->buffer);
+
+    if (blocks->dirty_count > BLOCK_DIRTY_MAX ||
+        blocks->ground > batch->capacity) {
+        if (blocks->ground > staging_capacity) {
+            staging_capacity = blocks->ground * 2;
+            staging = realloc(staging, staging_capacity * instance_size);
+            assert(staging != 0);
+        }
+        for (i = 0; i < blocks->ground; ++i) {
+            pack_instance(blocks, i, &staging[i * INSTANCE_FLOATS]);
+        }
+        if (blocks->ground > batch->capacity) {
+            batch->capacity = blocks->ground * 2;
+            glBufferData(GL_TEXTURE_BUFFER, batch->capacity * instance_size,
+                         NULL, GL_DYNAMIC_DRAW);
+            glBindTexture(GL_TEXTURE_BUFFER, batch->texture);
+            glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, batch->buffer);
+        }
+        glBufferSubData(GL_TEXTURE_BUFFER, 0, blocks->ground * instance_size,
+                        staging);
+    } else {
+        for (i = 0; i < blocks->dirty_count; ++i) {
+            unsigned int index = blocks->dirty[i];
+            if (index >= blocks->ground) {
+                continue;
+            }
+            float instance[INSTANCE_FLOATS];
+            pack_instance(blocks, index, instance);
+            glBufferSubData(GL_TEXTURE_BUFFER, index * instance_size,
+                            instance_size, instance);
+        }
+    }
+
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+    batch->count = blocks->ground;
+    block_store_clean(blocks);
+}
+
+// Set up to draw batches with the given transform. The direction of the
+// light is given in the same coordinates as the blocks.
+void instancing_begin(const float modelview_projection[16],
+                      const float light_direction[3], float ambient)
+{
+    glUseProgram(program);
+    glUniformMatrix4fv(modelview_projection_uniform, 1, GL_FALSE,
+                       modelview_projection);
+    glUniform1i(instances_uniform, 0);
+    glUniform1i(visible_uniform, 1);
+    glUniform3fv(light_direction_uniform, 1, light_direction);
+    glUniform1f(ambient_uniform, ambient);
+
+    const Mesh * cube = geometry_cube();
+    const GLsizei stride = MESH_VERTEX_FLOATS * sizeof(float);
+    glstate_bind_array_buffer(cube->buffer);
+    glEnableVertexAttribArray(position_attrib);
+    glEnableVertexAttribArray(normal_attrib);
+    glVertexAttribPointer(position_attrib, 3, GL_FLOAT, GL_FALSE, stride,
+                          (const GLvoid *)0);
+    glVertexAttribPointer(normal_attrib, 3, GL_FLOAT, GL_FALSE, stride,
+                          (const GLvoid *)(3 * sizeof(float)));
+}
+
+// Draw the blocks in the batch at the given packed indices.
+void instancing_draw(InstanceBatch * batch, const unsigned int * indices,
+                     unsigned int count)
+{
+    if (count == 0) {
+        return;
+    }
+    assert(count <= batch->count);
+
+    glBindBuffer(GL_TEXTURE_BUFFER, batch->visible_buffer);
+    if (count > batch->visible_capacity) {
+        batch->visible_capacity = batch->count;
+        glBufferData(GL_TEXTURE_BUFFER,
+                     batch->visible_capacity * sizeof(unsigned int),
+                     NULL, GL_STREAM_DRAW);
+        glActiveTexture(GL_TEXTURE1);
+        glBindTexture(GL_TEXTURE_BUFFER, batch->visible_texture);
+        glTexBuffer(GL_TEXTURE_BUFFER, GL_R32UI, batch->visible_buffer);
+        glActiveTexture(GL_TEXTURE0);
+    }
+    glBufferSubData(GL_TEXTURE_BUFFER, 0, count * sizeof(unsigned int),
+                    indices);
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_BUFFER, batch->visible_texture);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_BUFFER, batch->texture);
+
+    const Mesh * cube = geometry_cube();
+    glDrawArraysInstanced(cube->mode, 0, cube->count, count);
+}
+
+void instancing_end()
+{
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+    glDisableVertexAttribArray(position_attrib);
+    glDisableVertexAttribArray(normal_attrib);
+    glUseProgram(0);
+}
@@ -0,0 +1,39 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#ifndef INSTANCING_H
+#define INSTANCING_H
+
+#include "blocks.h"
+
+#include <SDL_opengl.h>
+
+// Copy of the position, size and colour of the ground blocks in a store,
+// kept in a buffer object so they can all be drawn with a single instanced
+// draw call. The instances are read by the vertex shader through a buffer
+// texture, two RGBA texels per block. The packed indices of the blocks to
+// draw are passed through a second buffer texture, so only the blocks in
+// view are drawn.
+typedef struct instance_batch {
+    GLuint buffer;
+    GLuint texture;
+    unsigned int capacity;
+    unsigned int count;
+
+    GLuint visible_buffer;
+    GLuint visible_texture;
+    unsigned int visible_capacity;
+} InstanceBatch;
+
+int instancing_init();
+void instancing_batch_init(InstanceBatch * batch);
+void instancing_batch_clear(InstanceBatch * batch);
+void instancing_batch_update(InstanceBatch * batch, BlockStore * blocks);
+void instancing_begin(const float modelview_projection[16],
+                      const float light_direction[3], float ambient);
+void instancing_draw(InstanceBatch * batch, const unsigned int * indices,
+                     unsigned int count);
+void instancing_end();
+
+#endif // INSTANCING_H
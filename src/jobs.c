@@ -0,0 +1,215 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+// A small pool of worker threads for splitting the work of a step into
+// tasks. Each thread, including the one running the job, is given an even
+// share of the tasks, and takes them from the front of its own share. A
+// thread which runs out steals from the back of the shares of the others,
+// so the work evens out when some tasks take longer than others. Tasks are
+// claimed with compare and exchange, so taking one never waits on a lock.
+// Idle workers sleep until the next job is run.
+
+#include "jobs.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <unistd.h>
+
+#define max_threads 64
+
+// The tasks one thread has left, with the first in the low 32 bits and
+// one past the last in the high 32 bits. Each share has a cache line to
+// itself, so threads taking from their own shares do not slow each other.
+typedef struct job_share {
+    atomic_ullong range;
+    char padding[64 - sizeof(atomic_ullong)];
+} JobShare;
+
+static JobShare shares[max_threads];
+static pthread_t workers[max_threads];
+static int thread_count = 1;
+
+// Workers wait for generation to change, or for stopping to be set.
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t wake = PTHREAD_COND_INITIALIZER;
+static unsigned int generation = 0;
+static int stopping = 0;
+
+// The job being run. These are written before the shares are filled in,
+// and only read by a thread once it has taken a task from a share.
+static JobTask job_func;
+static void * job_context;
+static atomic_uint remaining;
+
+static inline unsigned long long pack(unsigned int begin, unsigned int end)
+{
+    return ((unsigned long long)end << 32) | begin;
+}
+
+static int take_front(JobShare * share)
+{
+    unsigned long long range = atomic_load_explicit(&share->range,
+                                                    memory_order_acquire);
+    for (;;) {
+        unsigned int begin = (unsigned int)range;
+        unsigned int end = (unsigned int)(range >> 32);
+        if (begin >= end) {
+            return -1;
+        }
+        if (atomic_compare_exchange_weak_explicit(&share->range, &range,
+                                                  pack(begin + 1, end),
+                                                  memory_order_acquire,
+                                                  memory_order_acquire)) {
+            return begin;
+        }
+    }
+}
+
+static int take_back(JobShare * share)
+{
+    unsigned long long range = atomic_load_explicit(&share->range,
+                                                    memory_order_acquire);
+    for (;;) {
+        unsigned int begin = (unsigned int)range;
+        unsigned int end = (unsigned int)(range >> 32);
+        if (begin >= end) {
+            return -1;
+        }
+        if (atomic_compare_exchange_weak_explicit(&share->range, &range,
+                                                  pack(begin, end - 1),
+                                                  memory_order_acquire,
+                                                  memory_order_acquire)) {
+            return end - 1;
+        }
+    }
+}
+
+// Take the next task for a thread, from its own share if it has any left,
+// and otherwise from one of the others.
+static int take(int self)
+{
+    int task = take_front(&shares[self]);
+    int i;
+    for (i = 1; task < 0 && i < thread_count; ++i) {
+        task = take_back(&shares[(self + i) % thread_count]);
+    }
+    return task;
+}
+
+static void work(int self)
+{
+    int task;
+    while ((task = take(self)) >= 0) {
+        job_func(job_context, task);
+        atomic_fetch_sub_explicit(&remaining, 1, memory_order_release);
+    }
+}
+
+static void * worker_main(void * arg)
+{
+    int self = (int)(long)arg;
+    unsigned int seen = 0;
+
+    pthread_mutex_lock(&lock);
+    for (;;) {
+        while (!stopping && generation == seen) {
+            pthread_cond_wait(&wake, &lock);
+        }
+        if (stopping) {
+            break;
+        }
+        seen = generation;
+        pthread_mutex_unlock(&lock);
+        work(self);
+        pthread_mutex_lock(&lock);
+    }
+    pthread_mutex_unlock(&lock);
+    return NULL;
+}
+
+// Start the pool with the given number of threads, counting the one which
+// runs jobs, or one for each processor if threads is zero. Returns the
+// number of threads jobs are split between. Until this is called, and
+// after jobs_shutdown(), jobs are run one task at a time on the calling
+// thread.
+int jobs_init(int threads)
+{
+    if (threads <= 0) {
+        threads = 1;
+#ifdef _SC_NPROCESSORS_ONLN
+        threads = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    }
+    if (threads > max_threads) {
+        threads = max_threads;
+    }
+    generation = 0;
+    stopping = 0;
+    thread_count = 1;
+    while (thread_count < threads) {
+        if (pthread_create(&workers[thread_count], NULL, worker_main,
+                           (void *)(long)thread_count) != 0) {
+            break;
+        }
+        ++thread_count;
+    }
+    return thread_count;
+}
+
+void jobs_shutdown()
+{
+    pthread_mutex_lock(&lock);
+    stopping = 1;
+    pthread_cond_broadcast(&wake);
+    pthread_mutex_unlock(&lock);
+
+    int i;
+    for (i = 1; i < thread_count; ++i) {
+        pthread_join(workers[i], NULL);
+    }
+    thread_count = 1;
+}
+
+int jobs_thread_count()
+{
+    return thread_count;
+}
+
+// Run func for every task from 0 to tasks - 1, split between the threads
+// of the pool, and return once they have all finished. The tasks may run
+// in any order, and at the same time, so each must only write to memory
+// of its own.
+void jobs_run(unsigned int tasks, JobTask func, void * context)
+{
+    unsigned int t;
+    if (thread_count == 1 || tasks < 2) {
+        for (t = 0; t < tasks; ++t) {
+            func(context, t);
+        }
+        return;
+    }
+
+    job_func = func;
+    job_context = context;
+    atomic_store_explicit(&remaining, tasks, memory_order_relaxed);
+    int i;
+    for (i = 0; i < thread_count; ++i) {
+        unsigned int begin = (unsigned long long)tasks * i / thread_count;
+        unsigned int end = (unsigned long long)tasks * (i + 1) /
+                           thread_count;
+        atomic_store_explicit(&shares[i].range, pack(begin, end),
+                              memory_order_release);
+    }
+
+    pthread_mutex_lock(&lock);
+    ++generation;
+    pthread_cond_broadcast(&wake);
+    pthread_mutex_unlock(&lock);
+
+    work(0);
+    while (atomic_load_explicit(&remaining, memory_order_acquire) != 0) {
+        sched_yield();
+    }
+}
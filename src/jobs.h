@@ -0,0 +1,16 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#ifndef JOBS_H
+#define JOBS_H
+
+// Function run for each task of a job, with the number of the task.
+typedef void (*JobTask)(void * context, unsigned int task);
+
+int jobs_init(int threads);
+void jobs_shutdown();
+int jobs_thread_count();
+void jobs_run(unsigned int tasks, JobTask func, void * context);
+
+#endif // JOBS_H
@@ -0,0 +1,169 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+// Messages are formatted by the thread logging them into a slot of a ring
+// buffer, and written to stdout by a background thread, so logging never
+// waits on the terminal. Slots are claimed without locks, using a sequence
+// number in each slot to tell whether it is free, filled or being written,
+// so any thread can log. If the ring is full the message is dropped and
+// counted rather than waiting for space.
+
+#include "logger.h"
+
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+// Number of slots in the ring, which must be a power of two, and the
+// longest message that can be logged. Longer messages are cut short.
+#define ring_size 4096
+#define message_size 256
+
+// How long the writer sleeps when it finds the ring empty.
+static const long idle_nanoseconds = 1000000;
+
+typedef struct log_slot {
+    // Equal to the position being claimed while the slot is free, one more
+    // once the message is in place, and advanced by ring_size once it has
+    // been written out.
+    atomic_uint sequence;
+    char text[message_size];
+} LogSlot;
+
+static LogSlot ring[ring_size];
+static atomic_uint claim_position;
+static unsigned int write_position;
+static atomic_uint dropped;
+
+// Put in front of messages at each level.
+static const char * const level_prefixes[] = {
+    "", "", "Warning: ", "Error: "
+};
+
+static pthread_t writer;
+static atomic_int running = 0;
+static atomic_int stopping = 0;
+
+// Write out every message in the ring, returning the number written.
+static unsigned int drain()
+{
+    unsigned int count = 0;
+    for (;;) {
+        LogSlot * slot = &ring[write_position & (ring_size - 1)];
+        unsigned int sequence = atomic_load_explicit(&slot->sequence,
+                                                     memory_order_acquire);
+        if (sequence != write_position + 1) {
+            break;
+        }
+        fputs(slot->text, stdout);
+        fputc('\n', stdout);
+        atomic_store_explicit(&slot->sequence, write_position + ring_size,
+                              memory_order_release);
+        ++write_position;
+        ++count;
+    }
+    unsigned int lost = atomic_exchange(&dropped, 0);
+    if (lost > 0) {
+        printf("Log full, dropped %u messages\n", lost);
+    }
+    return count;
+}
+
+static void * writer_main(void * arg)
+{
+    for (;;) {
+        int stop = atomic_load(&stopping);
+        if (drain() > 0) {
+            continue;
+        }
+        fflush(stdout);
+        if (stop) {
+            break;
+        }
+        struct timespec idle = { 0, idle_nanoseconds };
+        nanosleep(&idle, NULL);
+    }
+    return NULL;
+}
+
+// Start the background thread which writes out messages. Until this is
+// called, and after logger_shutdown(), messages are written straight to
+// stdout.
+int logger_init()
+{
+    unsigned int i;
+    for (i = 0; i < ring_size; ++i) {
+        atomic_init(&ring[i].sequence, i);
+    }
+    atomic_init(&claim_position, 0);
+    atomic_init(&dropped, 0);
+    write_position = 0;
+    atomic_store(&stopping, 0);
+    if (pthread_create(&writer, NULL, writer_main, NULL) != 0) {
+        return 0;
+    }
+    atomic_store(&running, 1);
+    return 1;
+}
+
+// Write out any messages still in the ring, and stop the thread.
+void logger_shutdown()
+{
+    if (!atomic_load(&running)) {
+        return;
+    }
+    atomic_store(&stopping, 1);
+    pthread_join(writer, NULL);
+    atomic_store(&running, 0);
+}
+
+void logger_write(LogLevel level, const char * format, ...)
+{
+    va_list args;
+    va_start(args, format);
+
+    if (!atomic_load_explicit(&running, memory_order_relaxed)) {
+        fputs(level_prefixes[level], stdout);
+        vprintf(format, args);
+        putchar('\n');
+        va_end(args);
+        return;
+    }
+
+    LogSlot * slot;
+    unsigned int position = atomic_load_explicit(&claim_position,
+                                                 memory_order_relaxed);
+    for (;;) {
+        slot = &ring[position & (ring_size - 1)];
+        unsigned int sequence = atomic_load_explicit(&slot->sequence,
+                                                     memory_order_acquire);
+        int difference = (int)(sequence - position);
+        if (difference == 0) {
+            if (atomic_compare_exchange_weak_explicit(&claim_position,
+                                                      &position, position + 1,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            // The writer has not caught up with this slot yet.
+            atomic_fetch_add_explicit(&dropped, 1, memory_order_relaxed);
+            va_end(args);
+            return;
+        } else {
+            position = atomic_load_explicit(&claim_position,
+                                            memory_order_relaxed);
+        }
+    }
+
+    size_t prefix = strlen(level_prefixes[level]);
+    memcpy(slot->text, level_prefixes[level], prefix);
+    vsnprintf(slot->text + prefix, message_size - prefix, format, args);
+    va_end(args);
+    atomic_store_explicit(&slot->sequence, position + 1,
+                          memory_order_release);
+}
@@ -0,0 +1,58 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#ifndef LOGGER_H
+#define LOGGER_H
+
+// How important a message is.
+typedef enum log_level {
+    LOG_DEBUG,
+    LOG_INFO,
+    LOG_WARNING,
+    LOG_ERROR
+} LogLevel;
+
+// What part of the program a message comes from, as a set of flags.
+#define LOG_GENERATE  (1 << 0)
+#define LOG_TIERS     (1 << 1)
+#define LOG_MOTION    (1 << 2)
+#define LOG_COLLIDE   (1 << 3)
+#define LOG_GRAPHICS  (1 << 4)
+#define LOG_ALL       (~0)
+
+// Messages below this level, or from categories not in this set, are
+// removed at compile time, along with the work of computing their
+// arguments. The per-step debug messages would fill the ring faster than
+// it is written out, so they are left out unless asked for in CPPFLAGS
+// with -DLOG_LEVEL_MIN=LOG_DEBUG.
+#ifndef LOG_LEVEL_MIN
+#define LOG_LEVEL_MIN LOG_INFO
+#endif
+
+#ifndef LOG_CATEGORIES
+#define LOG_CATEGORIES LOG_ALL
+#endif
+
+#define log_message(level, category, ...) \
+    do { \
+        if ((level) >= LOG_LEVEL_MIN && ((category) & LOG_CATEGORIES)) { \
+            logger_write((level), __VA_ARGS__); \
+        } \
+    } while (0)
+
+#define log_debug(category, ...) log_message(LOG_DEBUG, category, __VA_ARGS__)
+#define log_info(category, ...) log_message(LOG_INFO, category, __VA_ARGS__)
+#define log_warning(category, ...) \
+    log_message(LOG_WARNING, category, __VA_ARGS__)
+#define log_error(category, ...) log_message(LOG_ERROR, category, __VA_ARGS__)
+
+int logger_init();
+void logger_shutdown();
+void logger_write(LogLevel level, const char * format, ...)
+#ifdef __GNUC__
+    __attribute__((format(printf, 2, 3)))
+#endif
+    ;
+
+#endif // LOGGER_H
@@ -0,0 +1,16 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#ifndef MATRIX_H
+#define MATRIX_H
+
+// Matrices are 4x4, stored in column major order as used by OpenGL.
+
+void matrix_mult(const float lhs[16], const float rhs[16], float res[16]);
+void matrix_modelview_projection(float res[16]);
+int matrix_invert(const float m[16], float res[16]);
+void matrix_unproject(const float inverse[16], float x, float y, float z,
+                      float res[3]);
+
+#endif // MATRIX_H
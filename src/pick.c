@@ -0,0 +1,187 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+// Find what is under a ray through the world, such as one cast from the
+// camera through the mouse pointer. Blocks are tested by walking the cells
+// of each tier's index that the ray passes over on its way down to the
+// ground, so only the blocks near the ray are ever looked at.
+
+#include "pick.h"
+
+#include <math.h>
+
+// Most cells of one tier's index visited for a single ray. The part of a
+// ray which is low enough to hit blocks only crosses a few cells, unless
+// it is almost flat.
+static const int max_cells = 4096;
+
+// Intersect the ray from start along direction with the box from lo to hi,
+// and return true if it enters the box between near and the fraction
+// already in *fraction, which is then set to where it enters.
+static bool ray_box(const float start[3], const float direction[3],
+                    const float lo[3], const float hi[3],
+                    float near, float * fraction)
+{
+    float enter = near, leave = *fraction;
+    int a;
+    for (a = 0; a < 3; ++a) {
+        if (direction[a] == 0.f) {
+            if (start[a] < lo[a] || start[a] > hi[a]) {
+                return false;
+            }
+            continue;
+        }
+        float t0 = (lo[a] - start[a]) / direction[a];
+        float t1 = (hi[a] - start[a]) / direction[a];
+        if (t0 > t1) {
+            float t = t0; t0 = t1; t1 = t;
+        }
+        enter = t0 > enter ? t0 : enter;
+        leave = t1 < leave ? t1 : leave;
+        if (enter > leave) {
+            return false;
+        }
+    }
+    *fraction = enter;
+    return true;
+}
+
+// Find the part of the ray low enough to hit a block of a tier, between
+// the ground and the top of its biggest block, as fractions along the ray.
+// Returns false if the ray never passes through that slab.
+static bool ray_slab(const float start[3], const float direction[3],
+                     float top, float * near, float * far)
+{
+    if (direction[2] == 0.f) {
+        return start[2] >= 0.f && start[2] <= top;
+    }
+    float t0 = (top - start[2]) / direction[2];
+    float t1 = -start[2] / direction[2];
+    if (t0 > t1) {
+        float t = t0; t0 = t1; t1 = t;
+    }
+    *near = t0 > *near ? t0 : *near;
+    *far = t1 < *far ? t1 : *far;
+    return *near <= *far;
+}
+
+// Test every block in one cell of a tier's index against the ray, keeping
+// the nearest hit in result.
+static void pick_cell(Tier * tier, int t, int cx, int cy,
+                      const float start[3], const float direction[3],
+                      float near, PickResult * result)
+{
+    SpatialHash * index = &tier->index;
+    BlockStore * blocks = &tier->blocks;
+    float centre_x = (cx + 0.5f) * index->cell_size;
+    float centre_y = (cy + 0.5f) * index->cell_size;
+    unsigned int count = spatial_hash_query(index, centre_x, centre_y,
+                                            centre_x, centre_y);
+    unsigned int r;
+    for (r = 0; r < count; ++r) {
+        int i = block_store_index(blocks, index->results[r]);
+        if (i < 0 || (unsigned int)i >= blocks->ground) {
+            continue;
+        }
+        float size = blocks->scale[i];
+        float lo[3] = { blocks->x[i], blocks->y[i], 0.f };
+        float hi[3] = { lo[0] + size, lo[1] + size, size };
+        if (ray_box(start, direction, lo, hi, near, &result->fraction)) {
+            result->tier = t;
+            result->block = index->results[r];
+        }
+    }
+}
+
+// Walk the cells of a tier's index under the part of the ray from near to
+// far, in order along the ray, stopping once a hit has been found closer
+// than the next cell.
+static void pick_tier(int t, const float start[3], const float direction[3],
+                      float near, float far, PickResult * result)
+{
+    Tier * tier = &tiers[t];
+    float cell_size = tier->index.cell_size;
+    float x = start[0] + direction[0] * near;
+    float y = start[1] + direction[1] * near;
+    int cx = (int)floorf(x / cell_size);
+    int cy = (int)floorf(y / cell_size);
+    int end_x = (int)floorf((start[0] + direction[0] * far) / cell_size);
+    int end_y = (int)floorf((start[1] + direction[1] * far) / cell_size);
+
+    // Fractions along the ray at which it next crosses a cell boundary in
+    // x and y, and how far apart those crossings are.
+    int step_x = direction[0] > 0.f ? 1 : -1;
+    int step_y = direction[1] > 0.f ? 1 : -1;
+    float next_x = INFINITY, next_y = INFINITY;
+    float delta_x = INFINITY, delta_y = INFINITY;
+    if (direction[0] != 0.f) {
+        float edge = (cx + (step_x > 0)) * cell_size;
+        next_x = (edge - start[0]) / direction[0];
+        delta_x = cell_size / fabsf(direction[0]);
+    }
+    if (direction[1] != 0.f) {
+        float edge = (cy + (step_y > 0)) * cell_size;
+        next_y = (edge - start[1]) / direction[1];
+        delta_y = cell_size / fabsf(direction[1]);
+    }
+
+    int n;
+    float entered = near;
+    for (n = 0; n < max_cells; ++n) {
+        if (entered > far || entered > result->fraction) {
+            break;
+        }
+        pick_cell(tier, t, cx, cy, start, direction, near, result);
+        if (cx == end_x && cy == end_y) {
+            break;
+        }
+        if (next_x < next_y) {
+            entered = next_x;
+            next_x += delta_x;
+            cx += step_x;
+        } else {
+            entered = next_y;
+            next_y += delta_y;
+            cy += step_y;
+        }
+    }
+}
+
+// Find the nearest block or point on the ground along the ray from start
+// to end. Returns true and fills in result if anything was hit. The ground
+// is an infinite plane, so any ray which goes down far enough hits it.
+bool pick_ray(const float start[3], const float end[3], PickResult * result)
+{
+    float direction[3] = { end[0] - start[0], end[1] - start[1],
+                           end[2] - start[2] };
+
+    result->tier = -1;
+    result->block = BLOCK_HANDLE_NONE;
+    result->fraction = INFINITY;
+    if (direction[2] < 0.f && start[2] >= 0.f) {
+        float ground = -start[2] / direction[2];
+        if (ground <= 1.f) {
+            result->fraction = ground;
+        }
+    }
+
+    int t;
+    for (t = 0; t < tier_count; ++t) {
+        float near = 0.f, far = 1.f;
+        if (!tier_live(&tiers[t]) ||
+            !ray_slab(start, direction, tiers[t].max_size, &near, &far)) {
+            continue;
+        }
+        pick_tier(t, start, direction, near, far, result);
+    }
+
+    if (result->fraction > 1.f) {
+        return false;
+    }
+    int a;
+    for (a = 0; a < 3; ++a) {
+        result->point[a] = start[a] + direction[a] * result->fraction;
+    }
+    return true;
+}
@@ -0,0 +1,23 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#ifndef PICK_H
+#define PICK_H
+
+#include "world.h"
+
+// The nearest thing along a ray. If a ground block was hit, tier and
+// block say which, otherwise tier is -1 and the ray hit the ground plane.
+// Fraction is how far along the ray the hit is, from 0 at its start to 1
+// at its end, and point is where it is.
+typedef struct pick_result {
+    int tier;
+    BlockHandle block;
+    float fraction;
+    float point[3];
+} PickResult;
+
+bool pick_ray(const float start[3], const float end[3], PickResult * result);
+
+#endif // PICK_H
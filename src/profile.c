@@ -0,0 +1,147 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#ifdef WIN32
+#include <Windows.h>
+#endif
+
+#include "profile.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Number of frames of timings kept for working out percentiles.
+#define history_length 256
+
+int profile_enabled = 0;
+
+static const char * const phase_names[PROFILE_PHASES] = {
+    "Events", "Update", "Collide", "Scene", "Interface", "Swap"
+};
+
+// Time each phase was last entered, and the total time spent in each phase
+// so far this frame, in nanoseconds.
+static unsigned long long phase_start[PROFILE_PHASES];
+static unsigned long long phase_total[PROFILE_PHASES];
+
+// Time spent in each phase over the last history_length frames, in
+// milliseconds.
+static float history[PROFILE_PHASES][history_length];
+static unsigned int history_next = 0;
+static unsigned int history_count = 0;
+
+// File trace events are written to, if any, and the time the trace
+// started, which event times are relative to.
+static FILE * trace = NULL;
+static unsigned long long trace_start;
+static int trace_events = 0;
+
+static unsigned long long profile_now()
+{
+#ifdef WIN32
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return counter.QuadPart * 1000000000ull / frequency.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ull + ts.tv_nsec;
+#endif
+}
+
+// Start timing phases. If a filename is given, every phase is also
+// written to it as a Chrome trace event, which can be loaded into
+// chrome://tracing or Perfetto.
+int profile_init(const char * trace_filename)
+{
+    memset(phase_total, 0, sizeof(phase_total));
+    history_next = 0;
+    history_count = 0;
+    if (trace_filename != NULL) {
+        trace = fopen(trace_filename, "w");
+        if (trace == NULL) {
+            perror(trace_filename);
+            return 0;
+        }
+        fprintf(trace, "{\"traceEvents\":[\n");
+        trace_start = profile_now();
+        trace_events = 0;
+    }
+    profile_enabled = 1;
+    return 1;
+}
+
+// Stop timing, and finish off the trace file.
+void profile_shutdown()
+{
+    if (trace != NULL) {
+        fprintf(trace, "\n]}\n");
+        fclose(trace);
+        trace = NULL;
+    }
+    profile_enabled = 0;
+}
+
+void profile_begin_phase(ProfilePhase phase)
+{
+    phase_start[phase] = profile_now();
+}
+
+void profile_end_phase(ProfilePhase phase)
+{
+    unsigned long long end = profile_now();
+    unsigned long long duration = end - phase_start[phase];
+    phase_total[phase] += duration;
+    if (trace != NULL) {
+        fprintf(trace, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":1,"
+                       "\"ts\":%.3f,\"dur\":%.3f}",
+                trace_events++ ? ",\n" : "", phase_names[phase],
+                (phase_start[phase] - trace_start) / 1000.,
+                duration / 1000.);
+    }
+}
+
+// Called at the end of each frame to add the time spent in each phase to
+// the history.
+void profile_frame()
+{
+    int p;
+    for (p = 0; p < PROFILE_PHASES; ++p) {
+        history[p][history_next] = phase_total[p] / 1e6f;
+        phase_total[p] = 0;
+    }
+    history_next = (history_next + 1) % history_length;
+    if (history_count < history_length) {
+        ++history_count;
+    }
+}
+
+static int compare_floats(const void * lhs, const void * rhs)
+{
+    float l = *(const float *)lhs, r = *(const float *)rhs;
+    return (l > r) - (l < r);
+}
+
+// Get the median and 99th percentile time in milliseconds spent in a phase
+// per frame, over recent frames.
+void profile_percentiles(ProfilePhase phase, float * p50, float * p99)
+{
+    if (history_count == 0) {
+        *p50 = *p99 = 0.f;
+        return;
+    }
+    float sorted[history_length];
+    memcpy(sorted, history[phase], history_count * sizeof(float));
+    qsort(sorted, history_count, sizeof(float), compare_floats);
+    *p50 = sorted[(history_count - 1) / 2];
+    *p99 = sorted[(history_count - 1) * 99 / 100];
+}
+
+const char * profile_phase_name(ProfilePhase phase)
+{
+    return phase_names[phase];
+}
@@ -0,0 +1,47 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+// The phases each frame is split into for timing. Collision is timed
+// within update, so its time is also counted there.
+typedef enum profile_phase {
+    PROFILE_EVENTS,
+    PROFILE_UPDATE,
+    PROFILE_COLLIDE,
+    PROFILE_RENDER_SCENE,
+    PROFILE_RENDER_INTERFACE,
+    PROFILE_SWAP,
+    PROFILE_PHASES
+} ProfilePhase;
+
+// True if phases are being timed. Nothing is timed until profile_init()
+// is called, so code which does not use the profiler pays only for the
+// test of this flag.
+extern int profile_enabled;
+
+int profile_init(const char * trace_filename);
+void profile_shutdown();
+void profile_begin_phase(ProfilePhase phase);
+void profile_end_phase(ProfilePhase phase);
+void profile_frame();
+void profile_percentiles(ProfilePhase phase, float * p50, float * p99);
+const char * profile_phase_name(ProfilePhase phase);
+
+static inline void profile_begin(ProfilePhase phase)
+{
+    if (profile_enabled) {
+        profile_begin_phase(phase);
+    }
+}
+
+static inline void profile_end(ProfilePhase phase)
+{
+    if (profile_enabled) {
+        profile_end_phase(phase);
+    }
+}
+
+#endif // PROFILE_H
@@ -6,8 +6,14 @@
 
 #include <math.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
+#if defined(__GNUC__) && defined(__x86_64__)
+#define QUATERNION_X86
+#include <immintrin.h>
+#endif
+
 static inline float square(float f)
 {
     return f * f;
@@ -71,18 +77,24 @@ Quaternion quaternion_mult(const Quaternion * const lhs, const Quaternion * cons
   return res;
 }
 
-Quaternion quaternion_rotate(Quaternion * const self, const float axis[], float angle)
+// Calcalate a quaternion giving the rotation of angle about axis.
+static inline Quaternion rotation(const float axis[], float angle)
 {
   Quaternion other;
   float half_angle = angle / 2;
 
-  // Calcalate other, a quaternion giving the rotation of angle about axis.
   other.w = cos(half_angle);
 
   other.vec[0] = axis[0]; other.vec[1] = axis[1]; other.vec[2] = axis[2];
   vector_mult(other.vec, sin(half_angle) / vector_mag(axis));
 
   // m_vec = axis * (CoordType) (sin(half_angle) / axis.mag());
+  return other;
+}
+
+Quaternion quaternion_rotate(Quaternion * const self, const float axis[], float angle)
+{
+  Quaternion other = rotation(axis, angle);
 
   // Multiply this quaternion by other to rotate it by the desired ammount
   
@@ -141,6 +153,438 @@ void quaternion_invert(Quaternion * q)
     q->vec[2] = -q->vec[2];
 }
 
+// Blend between two orientations, taking the shorter way round. This is
+// close enough to a true slerp for the small rotations between two
+// simulation steps, and much cheaper.
+Quaternion quaternion_nlerp(const Quaternion * from, const Quaternion * to,
+                            float t)
+{
+    float dot = from->vec[0] * to->vec[0] + from->vec[1] * to->vec[1] +
+                from->vec[2] * to->vec[2] + from->w * to->w;
+    float sign = dot < 0.f ? -1.f : 1.f;
+    Quaternion res;
+
+    res.vec[0] = from->vec[0] + (sign * to->vec[0] - from->vec[0]) * t;
+    res.vec[1] = from->vec[1] + (sign * to->vec[1] - from->vec[1]) * t;
+    res.vec[2] = from->vec[2] + (sign * to->vec[2] - from->vec[2]) * t;
+    res.w = from->w + (sign * to->w - from->w) * t;
+
+    float mag = sqrt(square(res.vec[0]) + square(res.vec[1]) +
+                     square(res.vec[2]) + square(res.w));
+    vector_mult(res.vec, 1.f / mag);
+    res.w /= mag;
+    return res;
+}
+
+// Batched operations on arrays of quaternions. Where the processor allows,
+// kernels transpose four or eight quaternions at a time so each SSE2 or
+// AVX register holds one component of all of them, then do the same float
+// arithmetic in the same order as the scalar functions, so the results are
+// the same. The best kernel the processor supports is picked the first
+// time one is needed.
+
+typedef struct quaternion_kernel {
+    const char * name;
+    void (*mult)(const Quaternion * lhs, const Quaternion * rhs,
+                 Quaternion * res, unsigned int count);
+    void (*normalise)(Quaternion * q, unsigned int count);
+    void (*rotmatrix)(const Quaternion * q, float (*matrices)[16],
+                      unsigned int count);
+    // Returns true if the processor can run the kernel.
+    int (*supported)();
+} QuaternionKernel;
+
+static const QuaternionKernel * current = 0;
+
+// Number of rotations quaternion_rotate_batch() works out at a time.
+#define rotate_chunk 64
+
+// Allocate an array of quaternions aligned for the batched functions, so
+// no load of a kernel straddles a cache line. Free it with free().
+Quaternion * quaternion_array_alloc(unsigned int count)
+{
+    void * p = 0;
+    if (posix_memalign(&p, 32, count * sizeof(Quaternion)) != 0) {
+        return 0;
+    }
+    return p;
+}
+
+static void mult_scalar(const Quaternion * lhs, const Quaternion * rhs,
+                        Quaternion * res, unsigned int count)
+{
+    unsigned int i;
+    for (i = 0; i < count; ++i) {
+        res[i] = quaternion_mult(&lhs[i], &rhs[i]);
+    }
+}
+
+static void normalise_scalar(Quaternion * q, unsigned int count)
+{
+    unsigned int i;
+    for (i = 0; i < count; ++i) {
+        quaternion_normalise(&q[i]);
+    }
+}
+
+static void rotmatrix_scalar(const Quaternion * q, float (*matrices)[16],
+                             unsigned int count)
+{
+    unsigned int i;
+    for (i = 0; i < count; ++i) {
+        quaternion_rotmatrix(&q[i], matrices[i]);
+    }
+}
+
+#ifdef QUATERNION_X86
+
+static int has_sse2()
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse2");
+}
+
+// Load four quaternions, one component of each into each register.
+static inline void load_sse2(const Quaternion * q, __m128 * x, __m128 * y,
+                             __m128 * z, __m128 * w)
+{
+    __m128 a = _mm_loadu_ps(q[0].vec);
+    __m128 b = _mm_loadu_ps(q[1].vec);
+    __m128 c = _mm_loadu_ps(q[2].vec);
+    __m128 d = _mm_loadu_ps(q[3].vec);
+    _MM_TRANSPOSE4_PS(a, b, c, d);
+    *x = a; *y = b; *z = c; *w = d;
+}
+
+// Store four rows of four floats, transposed from four registers.
+static inline void store_sse2(float * out, unsigned int stride,
+                              __m128 a, __m128 b, __m128 c, __m128 d)
+{
+    _MM_TRANSPOSE4_PS(a, b, c, d);
+    _mm_storeu_ps(out, a);
+    _mm_storeu_ps(out + stride, b);
+    _mm_storeu_ps(out + stride * 2, c);
+    _mm_storeu_ps(out + stride * 3, d);
+}
+
+__attribute__((target("sse2")))
+static void mult_sse2(const Quaternion * lhs, const Quaternion * rhs,
+                      Quaternion * res, unsigned int count)
+{
+    unsigned int i;
+    for (i = 0; i + 4 <= count; i += 4) {
+        __m128 ax, ay, az, aw, bx, by, bz, bw;
+        load_sse2(lhs + i, &ax, &ay, &az, &aw);
+        load_sse2(rhs + i, &bx, &by, &bz, &bw);
+
+        __m128 w = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(
+            _mm_mul_ps(aw, bw), _mm_mul_ps(ax, bx)),
+            _mm_mul_ps(ay, by)), _mm_mul_ps(az, bz));
+        __m128 x = _mm_sub_ps(_mm_add_ps(_mm_add_ps(
+            _mm_mul_ps(aw, bx), _mm_mul_ps(ax, bw)),
+            _mm_mul_ps(ay, bz)), _mm_mul_ps(az, by));
+        __m128 y = _mm_sub_ps(_mm_add_ps(_mm_add_ps(
+            _mm_mul_ps(aw, by), _mm_mul_ps(ay, bw)),
+            _mm_mul_ps(az, bx)), _mm_mul_ps(ax, bz));
+        __m128 z = _mm_sub_ps(_mm_add_ps(_mm_add_ps(
+            _mm_mul_ps(aw, bz), _mm_mul_ps(az, bw)),
+            _mm_mul_ps(ax, by)), _mm_mul_ps(ay, bx));
+
+        store_sse2(res[i].vec, 4, x, y, z, w);
+    }
+    mult_scalar(lhs + i, rhs + i, res + i, count - i);
+}
+
+__attribute__((target("sse2")))
+static void normalise_sse2(Quaternion * q, unsigned int count)
+{
+    unsigned int i;
+    for (i = 0; i + 4 <= count; i += 4) {
+        __m128 x, y, z, w;
+        load_sse2(q + i, &x, &y, &z, &w);
+        __m128 mag = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(
+            _mm_mul_ps(x, x), _mm_mul_ps(y, y)),
+            _mm_mul_ps(z, z)), _mm_mul_ps(w, w)));
+        store_sse2(q[i].vec, 4, _mm_div_ps(x, mag), _mm_div_ps(y, mag),
+                   _mm_div_ps(z, mag), _mm_div_ps(w, mag));
+    }
+    normalise_scalar(q + i, count - i);
+}
+
+__attribute__((target("sse2")))
+static void rotmatrix_sse2(const Quaternion * q, float (*matrices)[16],
+                           unsigned int count)
+{
+    const __m128 one = _mm_set1_ps(1.f);
+    const __m128 two = _mm_set1_ps(2.f);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 last = _mm_set_ps(1.f, 0.f, 0.f, 0.f);
+    unsigned int i;
+    for (i = 0; i + 4 <= count; i += 4) {
+        __m128 x, y, z, w;
+        load_sse2(q + i, &x, &y, &z, &w);
+
+        __m128 m0 = _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(
+            _mm_mul_ps(y, y), _mm_mul_ps(z, z))));
+        __m128 m1 = _mm_mul_ps(two, _mm_add_ps(_mm_mul_ps(x, y),
+                                               _mm_mul_ps(z, w)));
+        __m128 m2 = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(x, z),
+                                               _mm_mul_ps(y, w)));
+        __m128 m4 = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(x, y),
+                                               _mm_mul_ps(z, w)));
+        __m128 m5 = _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(
+            _mm_mul_ps(x, x), _mm_mul_ps(z, z))));
+        __m128 m6 = _mm_mul_ps(two, _mm_add_ps(_mm_mul_ps(z, y),
+                                               _mm_mul_ps(x, w)));
+        __m128 m8 = _mm_mul_ps(two, _mm_add_ps(_mm_mul_ps(x, z),
+                                               _mm_mul_ps(y, w)));
+        __m128 m9 = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(y, z),
+                                               _mm_mul_ps(x, w)));
+        __m128 m10 = _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(
+            _mm_mul_ps(x, x), _mm_mul_ps(y, y))));
+
+        float * out = matrices[i];
+        store_sse2(out, 16, m0, m1, m2, zero);
+        store_sse2(out + 4, 16, m4, m5, m6, zero);
+        store_sse2(out + 8, 16, m8, m9, m10, zero);
+        int j;
+        for (j = 0; j < 4; ++j) {
+            _mm_storeu_ps(out + 16 * j + 12, last);
+        }
+    }
+    rotmatrix_scalar(q + i, matrices + i, count - i);
+}
+
+static int has_avx()
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx");
+}
+
+// Transpose the 4 by 4 block in each half of four registers.
+__attribute__((target("avx")))
+static inline void transpose_avx(__m256 * a, __m256 * b, __m256 * c,
+                                 __m256 * d)
+{
+    __m256 t0 = _mm256_unpacklo_ps(*a, *b);
+    __m256 t1 = _mm256_unpacklo_ps(*c, *d);
+    __m256 t2 = _mm256_unpackhi_ps(*a, *b);
+    __m256 t3 = _mm256_unpackhi_ps(*c, *d);
+    *a = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+    *b = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+    *c = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    *d = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+// Load rows i and i + 4 of eight rows of four floats into each register.
+__attribute__((target("avx")))
+static inline __m256 load_pair(const float * in, unsigned int stride)
+{
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(in)),
+                                _mm_loadu_ps(in + stride * 4), 1);
+}
+
+// Load eight quaternions, one component of each into each register.
+__attribute__((target("avx")))
+static inline void load_avx(const Quaternion * q, __m256 * x, __m256 * y,
+                            __m256 * z, __m256 * w)
+{
+    *x = load_pair(q[0].vec, 4);
+    *y = load_pair(q[1].vec, 4);
+    *z = load_pair(q[2].vec, 4);
+    *w = load_pair(q[3].vec, 4);
+    transpose_avx(x, y, z, w);
+}
+
+// Store eight rows of four floats, transposed from four registers.
+__attribute__((target("avx")))
+static inline void store_avx(float * out, unsigned int stride,
+                             __m256 a, __m256 b, __m256 c, __m256 d)
+{
+    transpose_avx(&a, &b, &c, &d);
+    _mm_storeu_ps(out, _mm256_castps256_ps128(a));
+    _mm_storeu_ps(out + stride, _mm256_castps256_ps128(b));
+    _mm_storeu_ps(out + stride * 2, _mm256_castps256_ps128(c));
+    _mm_storeu_ps(out + stride * 3, _mm256_castps256_ps128(d));
+    _mm_storeu_ps(out + stride * 4, _mm256_extractf128_ps(a, 1));
+    _mm_storeu_ps(out + stride * 5, _mm256_extractf128_ps(b, 1));
+    _mm_storeu_ps(out + stride * 6, _mm256_extractf128_ps(c, 1));
+    _mm_storeu_ps(out + stride * 7, _mm256_extractf128_ps(d, 1));
+}
+
+__attribute__((target("avx")))
+static void mult_avx(const Quaternion * lhs, const Quaternion * rhs,
+                     Quaternion * res, unsigned int count)
+{
+    unsigned int i;
+    for (i = 0; i + 8 <= count; i += 8) {
+        __m256 ax, ay, az, aw, bx, by, bz, bw;
+        load_avx(lhs + i, &ax, &ay, &az, &aw);
+        load_avx(rhs + i, &bx, &by, &bz, &bw);
+
+        __m256 w = _mm256_sub_ps(_mm256_sub_ps(_mm256_sub_ps(
+            _mm256_mul_ps(aw, bw), _mm256_mul_ps(ax, bx)),
+            _mm256_mul_ps(ay, by)), _mm256_mul_ps(az, bz));
+        __m256 x = _mm256_sub_ps(_mm256_add_ps(_mm256_add_ps(
+            _mm256_mul_ps(aw, bx), _mm256_mul_ps(ax, bw)),
+            _mm256_mul_ps(ay, bz)), _mm256_mul_ps(az, by));
+        __m256 y = _mm256_sub_ps(_mm256_add_ps(_mm256_add_ps(
+            _mm256_mul_ps(aw, by), _mm256_mul_ps(ay, bw)),
+            _mm256_mul_ps(az, bx)), _mm256_mul_ps(ax, bz));
+        __m256 z = _mm256_sub_ps(_mm256_add_ps(_mm256_add_ps(
+            _mm256_mul_ps(aw, bz), _mm256_mul_ps(az, bw)),
+            _mm256_mul_ps(ax, by)), _mm256_mul_ps(ay, bx));
+
+        store_avx(res[i].vec, 4, x, y, z, w);
+    }
+    // The rest is done with SSE, which stalls while the upper halves of
+    // the registers are dirty, and the compiler does not clear them before
+    // a tail call. Nor would it before any SSE code the caller runs next.
+    _mm256_zeroupper();
+    mult_sse2(lhs + i, rhs + i, res + i, count - i);
+}
+
+__attribute__((target("avx")))
+static void normalise_avx(Quaternion * q, unsigned int count)
+{
+    unsigned int i;
+    for (i = 0; i + 8 <= count; i += 8) {
+        __m256 x, y, z, w;
+        load_avx(q + i, &x, &y, &z, &w);
+        __m256 mag = _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(
+            _mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)),
+            _mm256_mul_ps(z, z)), _mm256_mul_ps(w, w)));
+        store_avx(q[i].vec, 4, _mm256_div_ps(x, mag), _mm256_div_ps(y, mag),
+                  _mm256_div_ps(z, mag), _mm256_div_ps(w, mag));
+    }
+    _mm256_zeroupper();
+    normalise_sse2(q + i, count - i);
+}
+
+__attribute__((target("avx")))
+static void rotmatrix_avx(const Quaternion * q, float (*matrices)[16],
+                          unsigned int count)
+{
+    const __m256 one = _mm256_set1_ps(1.f);
+    const __m256 two = _mm256_set1_ps(2.f);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m128 last = _mm_set_ps(1.f, 0.f, 0.f, 0.f);
+    unsigned int i;
+    for (i = 0; i + 8 <= count; i += 8) {
+        __m256 x, y, z, w;
+        load_avx(q + i, &x, &y, &z, &w);
+
+        __m256 m0 = _mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(
+            _mm256_mul_ps(y, y), _mm256_mul_ps(z, z))));
+        __m256 m1 = _mm256_mul_ps(two, _mm256_add_ps(_mm256_mul_ps(x, y),
+                                                     _mm256_mul_ps(z, w)));
+        __m256 m2 = _mm256_mul_ps(two, _mm256_sub_ps(_mm256_mul_ps(x, z),
+                                                     _mm256_mul_ps(y, w)));
+        __m256 m4 = _mm256_mul_ps(two, _mm256_sub_ps(_mm256_mul_ps(x, y),
+                                                     _mm256_mul_ps(z, w)));
+        __m256 m5 = _mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(
+            _mm256_mul_ps(x, x), _mm256_mul_ps(z, z))));
+        __m256 m6 = _mm256_mul_ps(two, _mm256_add_ps(_mm256_mul_ps(z, y),
+                                                     _mm256_mul_ps(x, w)));
+        __m256 m8 = _mm256_mul_ps(two, _mm256_add_ps(_mm256_mul_ps(x, z),
+                                                     _mm256_mul_ps(y, w)));
+        __m256 m9 = _mm256_mul_ps(two, _mm256_sub_ps(_mm256_mul_ps(y, z),
+                                                     _mm256_mul_ps(x, w)));
+        __m256 m10 = _mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(
+            _mm256_mul_ps(x, x), _mm256_mul_ps(y, y))));
+
+        float * out = matrices[i];
+        store_avx(out, 16, m0, m1, m2, zero);
+        store_avx(out + 4, 16, m4, m5, m6, zero);
+        store_avx(out + 8, 16, m8, m9, m10, zero);
+        int j;
+        for (j = 0; j < 8; ++j) {
+            _mm_storeu_ps(out + 16 * j + 12, last);
+        }
+    }
+    _mm256_zeroupper();
+    rotmatrix_sse2(q + i, matrices + i, count - i);
+}
+
+#endif // QUATERNION_X86
+
+// Every kernel, best first. The last is always supported.
+static const QuaternionKernel kernels[] = {
+#ifdef QUATERNION_X86
+    { "avx", mult_avx, normalise_avx, rotmatrix_avx, has_avx },
+    { "sse2", mult_sse2, normalise_sse2, rotmatrix_sse2, has_sse2 },
+#endif
+    { "scalar", mult_scalar, normalise_scalar, rotmatrix_scalar, 0 }
+};
+#define kernel_count (sizeof(kernels) / sizeof(kernels[0]))
+
+static const QuaternionKernel * kernel()
+{
+    if (current == 0) {
+        unsigned int k;
+        for (k = 0; k < kernel_count - 1; ++k) {
+            if (kernels[k].supported()) {
+                break;
+            }
+        }
+        current = &kernels[k];
+    }
+    return current;
+}
+
+void quaternion_mult_batch(const Quaternion * lhs, const Quaternion * rhs,
+                           Quaternion * res, unsigned int count)
+{
+    kernel()->mult(lhs, rhs, res, count);
+}
+
+void quaternion_rotate_batch(Quaternion * q, const float (*axes)[3],
+                             const float * angles, unsigned int count)
+{
+    Quaternion others[rotate_chunk];
+    unsigned int i, j;
+    for (i = 0; i < count; i += rotate_chunk) {
+        unsigned int n = count - i < rotate_chunk ? count - i : rotate_chunk;
+        for (j = 0; j < n; ++j) {
+            others[j] = rotation(axes[i + j], angles[i + j]);
+        }
+        kernel()->mult(others, q + i, q + i, n);
+    }
+}
+
+void quaternion_normalise_batch(Quaternion * q, unsigned int count)
+{
+    kernel()->normalise(q, count);
+}
+
+void quaternion_rotmatrix_batch(const Quaternion * q, float (*matrices)[16],
+                                unsigned int count)
+{
+    kernel()->rotmatrix(q, matrices, count);
+}
+
+const char * quaternion_kernel_name()
+{
+    return kernel()->name;
+}
+
+// Use the named kernel from now on, returning false if there is no such
+// kernel or the processor cannot run it.
+int quaternion_kernel_select(const char * name)
+{
+    unsigned int k;
+    for (k = 0; k < kernel_count; ++k) {
+        if (strcmp(kernels[k].name, name) == 0) {
+            if (kernels[k].supported != 0 && !kernels[k].supported()) {
+                return 0;
+            }
+            current = &kernels[k];
+            return 1;
+        }
+    }
+    return 0;
+}
+
 #if 0
 // The arguments to this function have been swapped over because in
 // the form provided in the example code, the result appeared to be
@@ -7,15 +7,109 @@
 
 // #include "Vector3D.h"
 
+#include <math.h>
+
 typedef struct quaternion {
     float vec[3];
     float w;
 } Quaternion;
 
+// Arrays shorter than this are handled one quaternion at a time by the
+// inline functions below, as a kernel would gain nothing on so few.
+#define quaternion_batch_min 4
+
 void quaternion_init(Quaternion * const self);
+Quaternion quaternion_mult(const Quaternion * const lhs,
+                           const Quaternion * const rhs);
 Quaternion quaternion_rotate(Quaternion * const self, const float axis[], float angle);
 void quaternion_rotmatrix(const Quaternion * q, float matrix[]);
 void quaternion_invert(Quaternion * q);
+Quaternion quaternion_nlerp(const Quaternion * from, const Quaternion * to,
+                            float t);
+
+Quaternion * quaternion_array_alloc(unsigned int count);
+void quaternion_mult_batch(const Quaternion * lhs, const Quaternion * rhs,
+                           Quaternion * res, unsigned int count);
+void quaternion_rotate_batch(Quaternion * q, const float (*axes)[3],
+                             const float * angles, unsigned int count);
+void quaternion_normalise_batch(Quaternion * q, unsigned int count);
+void quaternion_rotmatrix_batch(const Quaternion * q, float (*matrices)[16],
+                                unsigned int count);
+const char * quaternion_kernel_name();
+int quaternion_kernel_select(const char * name);
+
+// Scale a quaternion to unit length.
+static inline void quaternion_normalise(Quaternion * q)
+{
+    float mag = sqrtf(q->vec[0] * q->vec[0] + q->vec[1] * q->vec[1] +
+                      q->vec[2] * q->vec[2] + q->w * q->w);
+    q->vec[0] /= mag;
+    q->vec[1] /= mag;
+    q->vec[2] /= mag;
+    q->w /= mag;
+}
+
+// Multiply each quaternion in lhs by the one at the same place in rhs.
+// res may be the same array as either.
+static inline void quaternion_mult_array(const Quaternion * lhs,
+                                         const Quaternion * rhs,
+                                         Quaternion * res, unsigned int count)
+{
+    if (count >= quaternion_batch_min) {
+        quaternion_mult_batch(lhs, rhs, res, count);
+        return;
+    }
+    unsigned int i;
+    for (i = 0; i < count; ++i) {
+        res[i] = quaternion_mult(&lhs[i], &rhs[i]);
+    }
+}
+
+// Rotate each quaternion by the angle about the axis at the same place, as
+// quaternion_rotate() does.
+static inline void quaternion_rotate_array(Quaternion * q,
+                                           const float (*axes)[3],
+                                           const float * angles,
+                                           unsigned int count)
+{
+    if (count >= quaternion_batch_min) {
+        quaternion_rotate_batch(q, axes, angles, count);
+        return;
+    }
+    unsigned int i;
+    for (i = 0; i < count; ++i) {
+        q[i] = quaternion_rotate(&q[i], axes[i], angles[i]);
+    }
+}
+
+static inline void quaternion_normalise_array(Quaternion * q,
+                                              unsigned int count)
+{
+    if (count >= quaternion_batch_min) {
+        quaternion_normalise_batch(q, count);
+        return;
+    }
+    unsigned int i;
+    for (i = 0; i < count; ++i) {
+        quaternion_normalise(&q[i]);
+    }
+}
+
+// Write the rotation matrix of each quaternion, as quaternion_rotmatrix()
+// does.
+static inline void quaternion_rotmatrix_array(const Quaternion * q,
+                                              float (*matrices)[16],
+                                              unsigned int count)
+{
+    if (count >= quaternion_batch_min) {
+        quaternion_rotmatrix_batch(q, matrices, count);
+        return;
+    }
+    unsigned int i;
+    for (i = 0; i < count; ++i) {
+        quaternion_rotmatrix(&q[i], matrices[i]);
+    }
+}
 
 #if 0
   public:
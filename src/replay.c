@@ -0,0 +1,358 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+// Recording and replaying the input to a run of the game, so the same run
+// can be played back as often as needed, for example to profile it.
+//
+// A trace starts with a header holding the world seed and the delta of the
+// first step, so replaying it builds the same world. After that it is a
+// stream of records, each starting with a byte whose top three bits say
+// what it is, and whose low five bits hold a small value:
+//
+//   steps     Run the number of steps in the low bits, of the current
+//             delta with the current controls.
+//   controls  The controls held from now on, one bit each.
+//   delta     The delta of steps from now on, as the 4 byte float which
+//             follows.
+//   frame     Run the number of steps in the low bits, then draw a frame.
+//             The microseconds since the last frame follow, 7 bits to a
+//             byte with the top bit set on all but the last, and then one
+//             byte of the fraction between steps it was drawn at.
+//
+// Multi-byte values are little endian. A typical frame takes five bytes,
+// and a key pressed or let go one more.
+
+#include "replay.h"
+
+#include "world.h"
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <assert.h>
+
+static const unsigned char replay_magic[4] = { 'C', 'A', 'L', 'R' };
+
+// Size of the header, which is the magic, the version, the seed and the
+// delta of the first step.
+#define replay_header_size 20
+
+enum replay_record {
+    RECORD_STEPS,
+    RECORD_CONTROLS,
+    RECORD_DELTA,
+    RECORD_FRAME
+};
+
+// Most steps that fit in one record.
+static const unsigned int record_max_steps = 31;
+
+// Trace being written, with the controls and delta the last records left
+// in force, and the steps run since the last record was written.
+static FILE * record_file = NULL;
+static unsigned int record_controls;
+static float record_delta;
+static unsigned int record_pending;
+
+// Trace being replayed, held in memory, with the position of the next
+// record, the state the records read so far have left, and the steps left
+// to run before the frame or record that follows them.
+static unsigned char * replay_data = NULL;
+static size_t replay_size;
+static size_t replay_next_record;
+static float replay_delta;
+static unsigned int replay_steps;
+static int replay_frame_pending;
+static ReplayFrame replay_pending_frame;
+
+static unsigned int controls_bits(const Controls * c)
+{
+    return (c->left_forward ? 1 : 0) |
+           (c->left_back ? 2 : 0) |
+           (c->right_forward ? 4 : 0) |
+           (c->right_back ? 8 : 0) |
+           (c->flip ? 16 : 0);
+}
+
+static void controls_set(Controls * c, unsigned int bits)
+{
+    c->left_forward = (bits & 1) != 0;
+    c->left_back = (bits & 2) != 0;
+    c->right_forward = (bits & 4) != 0;
+    c->right_back = (bits & 8) != 0;
+    c->flip = (bits & 16) != 0;
+}
+
+static void put_uint(unsigned char * out, unsigned long long value,
+                     int bytes)
+{
+    int i;
+    for (i = 0; i < bytes; ++i) {
+        out[i] = (unsigned char)(value >> (i * 8));
+    }
+}
+
+static unsigned long long get_uint(const unsigned char * in, int bytes)
+{
+    unsigned long long value = 0;
+    int i;
+    for (i = 0; i < bytes; ++i) {
+        value |= (unsigned long long)in[i] << (i * 8);
+    }
+    return value;
+}
+
+static unsigned int float_bits(float f)
+{
+    unsigned int bits;
+    assert(sizeof(bits) == sizeof(f));
+    memcpy(&bits, &f, sizeof(bits));
+    return bits;
+}
+
+static float bits_float(unsigned int bits)
+{
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+static void write_tag(int record, unsigned int value)
+{
+    fputc(record << 5 | value, record_file);
+}
+
+// Write out the steps run since the last record, if there are any.
+static void record_flush_steps()
+{
+    if (record_pending > 0) {
+        write_tag(RECORD_STEPS, record_pending);
+        record_pending = 0;
+    }
+}
+
+// Start recording the input to this run into a new trace. The world seed
+// must already be set, and delta is the step the run will start with.
+int replay_record_open(const char * filename, float delta)
+{
+    record_file = fopen(filename, "wb");
+    if (record_file == NULL) {
+        perror(filename);
+        return 0;
+    }
+    unsigned char header[replay_header_size];
+    memcpy(header, replay_magic, sizeof(replay_magic));
+    put_uint(header + 4, REPLAY_VERSION, 4);
+    put_uint(header + 8, world_seed, 8);
+    put_uint(header + 16, float_bits(delta), 4);
+    fwrite(header, sizeof(header), 1, record_file);
+
+    record_controls = controls_bits(&controls);
+    write_tag(RECORD_CONTROLS, record_controls);
+    record_delta = delta;
+    record_pending = 0;
+    return 1;
+}
+
+// Record a step about to be run with the current controls. Nothing is
+// written unless the controls or delta have changed since the last step,
+// or enough steps have built up to fill a record.
+void replay_record_step(float delta)
+{
+    if (record_file == NULL) {
+        return;
+    }
+    unsigned int bits = controls_bits(&controls);
+    if (bits != record_controls) {
+        record_flush_steps();
+        write_tag(RECORD_CONTROLS, bits);
+        record_controls = bits;
+    }
+    if (float_bits(delta) != float_bits(record_delta)) {
+        record_flush_steps();
+        unsigned char value[4];
+        put_uint(value, float_bits(delta), 4);
+        write_tag(RECORD_DELTA, 0);
+        fwrite(value, sizeof(value), 1, record_file);
+        record_delta = delta;
+    }
+    if (++record_pending == record_max_steps) {
+        record_flush_steps();
+    }
+}
+
+// Record a frame drawn after the steps recorded since the last one.
+void replay_record_frame(unsigned long microseconds, float fraction)
+{
+    if (record_file == NULL) {
+        return;
+    }
+    write_tag(RECORD_FRAME, record_pending);
+    record_pending = 0;
+    while (microseconds >= 0x80) {
+        fputc((microseconds & 0x7f) | 0x80, record_file);
+        microseconds >>= 7;
+    }
+    fputc(microseconds, record_file);
+    fraction = fraction < 0.f ? 0.f : (fraction > 1.f ? 1.f : fraction);
+    fputc((int)(fraction * 255.f + .5f), record_file);
+}
+
+void replay_record_close()
+{
+    if (record_file == NULL) {
+        return;
+    }
+    record_flush_steps();
+    if (fclose(record_file) != 0) {
+        perror("Writing input trace");
+    }
+    record_file = NULL;
+}
+
+// Load a trace to replay, and set the world seed to the one it was
+// recorded with. This must be called before setup().
+int replay_open(const char * filename)
+{
+    FILE * fp = fopen(filename, "rb");
+    if (fp == NULL) {
+        perror(filename);
+        return 0;
+    }
+    size_t capacity = 0;
+    replay_size = 0;
+    for (;;) {
+        if (replay_size == capacity) {
+            capacity = capacity ? capacity * 2 : 64 * 1024;
+            replay_data = realloc(replay_data, capacity);
+            assert(replay_data != 0);
+        }
+        size_t got = fread(replay_data + replay_size, 1,
+                           capacity - replay_size, fp);
+        if (got == 0) {
+            break;
+        }
+        replay_size += got;
+    }
+    int failed = ferror(fp);
+    fclose(fp);
+    if (failed) {
+        perror(filename);
+        replay_close();
+        return 0;
+    }
+
+    if (replay_size < replay_header_size ||
+        memcmp(replay_data, replay_magic, sizeof(replay_magic)) != 0) {
+        fprintf(stderr, "%s: Not an input trace\n", filename);
+        replay_close();
+        return 0;
+    }
+    unsigned int version = get_uint(replay_data + 4, 4);
+    if (version != REPLAY_VERSION) {
+        fprintf(stderr, "%s: Input trace is version %u, not %u\n",
+                filename, version, REPLAY_VERSION);
+        replay_close();
+        return 0;
+    }
+    world_seed = get_uint(replay_data + 8, 8);
+    replay_delta = bits_float(get_uint(replay_data + 16, 4));
+    replay_next_record = replay_header_size;
+    replay_steps = 0;
+    replay_frame_pending = 0;
+    return 1;
+}
+
+// Read the microseconds and fraction of a frame record. Returns false if
+// the trace ends part way through, or has more bytes of microseconds than
+// an unsigned long can hold, which only a damaged trace can.
+static int read_frame(ReplayFrame * frame)
+{
+    unsigned long microseconds = 0;
+    int shift = 0;
+    for (;;) {
+        if (replay_next_record >= replay_size ||
+            shift >= (int)(sizeof(microseconds) * CHAR_BIT)) {
+            return 0;
+        }
+        unsigned char byte = replay_data[replay_next_record++];
+        microseconds |= (unsigned long)(byte & 0x7f) << shift;
+        shift += 7;
+        if ((byte & 0x80) == 0) {
+            break;
+        }
+    }
+    if (replay_next_record >= replay_size) {
+        return 0;
+    }
+    frame->microseconds = microseconds;
+    frame->fraction = replay_data[replay_next_record++] / 255.f;
+    return 1;
+}
+
+// Move on to the next step or frame of the trace. Records which change
+// the controls are applied as they are read, so they are in force for the
+// step returned. A trace which ends part way through a record, because
+// the run that wrote it did not finish cleanly, ends at the last whole
+// record.
+ReplayEvent replay_next(float * delta, ReplayFrame * frame)
+{
+    while (replay_data != NULL) {
+        if (replay_steps > 0) {
+            --replay_steps;
+            *delta = replay_delta;
+            return REPLAY_STEP;
+        }
+        if (replay_frame_pending) {
+            replay_frame_pending = 0;
+            *frame = replay_pending_frame;
+            return REPLAY_FRAME;
+        }
+        if (replay_next_record >= replay_size) {
+            break;
+        }
+        unsigned char tag = replay_data[replay_next_record++];
+        unsigned int value = tag & 0x1f;
+        switch (tag >> 5) {
+            case RECORD_STEPS:
+                replay_steps = value;
+                break;
+            case RECORD_CONTROLS:
+                controls_set(&controls, value);
+                break;
+            case RECORD_DELTA:
+                if (replay_size - replay_next_record < 4) {
+                    replay_next_record = replay_size;
+                    break;
+                }
+                replay_delta = bits_float(get_uint(replay_data +
+                                                   replay_next_record, 4));
+                replay_next_record += 4;
+                break;
+            case RECORD_FRAME:
+                if (!read_frame(&replay_pending_frame)) {
+                    replay_next_record = replay_size;
+                    break;
+                }
+                replay_steps = value;
+                replay_frame_pending = 1;
+                break;
+            default:
+                fprintf(stderr, "Unknown record %d in input trace\n",
+                        tag >> 5);
+                replay_next_record = replay_size;
+                break;
+        }
+    }
+    return REPLAY_END;
+}
+
+void replay_close()
+{
+    free(replay_data);
+    replay_data = NULL;
+    replay_size = 0;
+}
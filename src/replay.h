@@ -0,0 +1,40 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+// Version of the input trace format written by replay_record_open().
+// Traces written by any other version are refused.
+#define REPLAY_VERSION 1
+
+// What comes next in a trace being replayed.
+typedef enum replay_event {
+    // Call update() with the delta given. The controls have already been
+    // set to the ones held during the step.
+    REPLAY_STEP,
+    // A frame was drawn after the steps before it.
+    REPLAY_FRAME,
+    // There is nothing more in the trace.
+    REPLAY_END
+} ReplayEvent;
+
+// A frame drawn in a recorded run. Microseconds is the real time since the
+// frame before, and fraction is how far between the last two steps the
+// calamari was drawn.
+typedef struct replay_frame {
+    unsigned long microseconds;
+    float fraction;
+} ReplayFrame;
+
+int replay_record_open(const char * filename, float delta);
+void replay_record_step(float delta);
+void replay_record_frame(unsigned long microseconds, float fraction);
+void replay_record_close();
+
+int replay_open(const char * filename);
+ReplayEvent replay_next(float * delta, ReplayFrame * frame);
+void replay_close();
+
+#endif // REPLAY_H
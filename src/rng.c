@@ -0,0 +1,30 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#include "rng.h"
+
+static uint64_t splitmix64(uint64_t * x)
+{
+    uint64_t z = (*x += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+// Start a stream from a seed and a stream number. The same seed and stream
+// always give the same numbers, on any platform. The state is filled using
+// splitmix64, so nearby seeds and streams still give unrelated numbers,
+// and the state is never all zero.
+void rng_seed(Rng * rng, uint64_t seed, uint64_t stream)
+{
+    uint64_t x = seed;
+    uint64_t mixed = splitmix64(&x) ^ stream;
+    x = mixed;
+    uint64_t a = splitmix64(&x);
+    uint64_t b = splitmix64(&x);
+    rng->state[0] = (uint32_t)a;
+    rng->state[1] = (uint32_t)(a >> 32);
+    rng->state[2] = (uint32_t)b;
+    rng->state[3] = (uint32_t)(b >> 32);
+}
@@ -0,0 +1,48 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#ifndef RNG_H
+#define RNG_H
+
+#include <stdint.h>
+
+// State of one stream of pseudo random numbers, using xoshiro128**. Each
+// stream is independent, so streams can be used from different threads,
+// and the numbers drawn from one do not depend on how many have been drawn
+// from any other.
+typedef struct rng {
+    uint32_t state[4];
+} Rng;
+
+void rng_seed(Rng * rng, uint64_t seed, uint64_t stream);
+
+static inline uint32_t rng_rotl(uint32_t x, int k)
+{
+    return (x << k) | (x >> (32 - k));
+}
+
+static inline uint32_t rng_next(Rng * rng)
+{
+    uint32_t * s = rng->state;
+    const uint32_t result = rng_rotl(s[1] * 5, 7) * 9;
+    const uint32_t t = s[1] << 9;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rng_rotl(s[3], 11);
+
+    return result;
+}
+
+// Return a number evenly distributed in [min, max), using the top 24 bits
+// so every value is exactly representable as a float.
+static inline float rng_uniform(Rng * rng, float min, float max)
+{
+    return (rng_next(rng) >> 8) * (1.f / 16777216.f) * (max - min) + min;
+}
+
+#endif // RNG_H
@@ -0,0 +1,522 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+// Snapshots of the whole state of the simulation, so a run can be started
+// again from any point, such as late in the game, without rolling through
+// every tier to get there.
+//
+// A snapshot is laid out just as the data is in memory, so loading it is
+// a matter of mapping the file and pointing each block store and index at
+// its arrays, with nothing copied. The handles and the chains through the
+// slot tables and indices are walked once to check them, as a damaged
+// file would otherwise send the stores outside their arrays, but the
+// blocks themselves are not read until they are used. The mapping is
+// private, so the blocks can be changed without changing the file, and a
+// store or index copies its arrays out of the mapping the first time it
+// needs to resize them.
+//
+// The file starts with a header giving the offsets of the state of the
+// calamari, a table with one entry for each tier, and the state of chunk
+// streaming. Each tier's entry gives the offset of every array of its
+// block store and index. Arrays are aligned to snapshot_alignment, and
+// only the part of each array in use is kept. The data is in the byte
+// order of the machine that wrote it, which is checked when it is loaded.
+
+#include "snapshot.h"
+
+#include "world.h"
+#include "chunk.h"
+#include "logger.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <assert.h>
+
+// The snapshot last loaded, which is kept mapped until the next one is
+// loaded, as the tiers may still be using it.
+static void * mapping = NULL;
+static size_t mapping_size = 0;
+
+static const char snapshot_magic[8] = "CALSNAP";
+
+// Written as a number, so it reads back the same only on a machine with
+// the same byte order.
+static const unsigned int snapshot_byte_order = 0x01020304;
+
+typedef struct snapshot_header {
+    char magic[8];
+    unsigned int version;
+    unsigned int byte_order;
+    // Sizes of the structures in the file, so a snapshot written by a
+    // build which lays them out differently is refused.
+    unsigned int header_size;
+    unsigned int world_size;
+    unsigned int tier_size;
+    unsigned int tier_count;
+    unsigned long long file_size;
+    unsigned long long world;
+    unsigned long long tiers;
+    unsigned long long chunks;
+} SnapshotHeader;
+
+// One tier of blocks, with the offsets of the arrays of its store and
+// index.
+typedef struct snapshot_tier {
+    float factor;
+    float min_size;
+    float max_size;
+    float trim_size;
+    int state;
+
+    unsigned int ground;
+    unsigned int count;
+    unsigned int slots;
+    unsigned int free_slot;
+    unsigned long long x;
+    unsigned long long y;
+    unsigned long long z;
+    unsigned long long scale;
+    unsigned long long present;
+    unsigned long long diffuse;
+    unsigned long long orientation;
+    unsigned long long handle;
+    unsigned long long slot_index;
+    unsigned long long slot_generation;
+
+    float cell_size;
+    unsigned int bucket_count;
+    unsigned int entries;
+    unsigned int used;
+    unsigned int free_entry;
+    int min_x;
+    int min_y;
+    int max_x;
+    int max_y;
+    unsigned long long buckets;
+    unsigned long long cell_x;
+    unsigned long long cell_y;
+    unsigned long long first_x;
+    unsigned long long first_y;
+    unsigned long long entry_handle;
+    unsigned long long next;
+} SnapshotTier;
+
+// Append an array to a snapshot, starting at the next aligned offset, and
+// return the offset it was written at. Any error is recorded in the
+// writer, to be reported once the whole snapshot has been written.
+unsigned long long snapshot_write(SnapshotWriter * out, const void * data,
+                                  size_t bytes)
+{
+    static const unsigned char padding[snapshot_alignment] = { 0 };
+    size_t pad = (snapshot_alignment - out->offset % snapshot_alignment) %
+                 snapshot_alignment;
+    if (pad > 0 && fwrite(padding, pad, 1, out->file) != 1) {
+        out->failed = 1;
+    }
+    out->offset += pad;
+    unsigned long long offset = out->offset;
+    if (bytes > 0 && fwrite(data, bytes, 1, out->file) != 1) {
+        out->failed = 1;
+    }
+    out->offset += bytes;
+    return offset;
+}
+
+// Find an array in a snapshot being loaded. Returns null if any of it
+// lies outside the file, or it is not aligned.
+const void * snapshot_read(const SnapshotReader * in,
+                           unsigned long long offset, size_t bytes)
+{
+    if (offset % snapshot_alignment != 0 || offset > in->size ||
+        bytes > in->size - offset) {
+        return 0;
+    }
+    return in->data + offset;
+}
+
+static void save_tier(SnapshotWriter * out, const Tier * tier,
+                      SnapshotTier * saved)
+{
+    const BlockStore * blocks = &tier->blocks;
+    const SpatialHash * index = &tier->index;
+    const unsigned int count = blocks->count;
+    const unsigned int used = index->used;
+
+    saved->factor = tier->factor;
+    saved->min_size = tier->min_size;
+    saved->max_size = tier->max_size;
+    saved->trim_size = tier->trim_size;
+    saved->state = tier->state;
+
+    saved->ground = blocks->ground;
+    saved->count = count;
+    saved->slots = blocks->slots;
+    saved->free_slot = blocks->free_slot;
+    saved->x = snapshot_write(out, blocks->x, count * sizeof(float));
+    saved->y = snapshot_write(out, blocks->y, count * sizeof(float));
+    saved->z = snapshot_write(out, blocks->z, count * sizeof(float));
+    saved->scale = snapshot_write(out, blocks->scale, count * sizeof(float));
+    saved->present = snapshot_write(out, blocks->present, count);
+    saved->diffuse = snapshot_write(out, blocks->diffuse,
+                                    count * sizeof(float[4]));
+    saved->orientation = snapshot_write(out, blocks->orientation,
+                                        count * sizeof(Quaternion));
+    saved->handle = snapshot_write(out, blocks->handle,
+                                   count * sizeof(BlockHandle));
+    saved->slot_index = snapshot_write(out, blocks->slot_index,
+                                       blocks->slots * sizeof(unsigned int));
+    saved->slot_generation = snapshot_write(out, blocks->slot_generation,
+                                            blocks->slots);
+
+    saved->cell_size = index->cell_size;
+    saved->bucket_count = index->bucket_count;
+    saved->entries = index->entries;
+    saved->used = used;
+    saved->free_entry = index->free_entry;
+    saved->min_x = index->min_x;
+    saved->min_y = index->min_y;
+    saved->max_x = index->max_x;
+    saved->max_y = index->max_y;
+    saved->buckets = snapshot_write(out, index->buckets,
+                                    index->bucket_count *
+                                    sizeof(unsigned int));
+    saved->cell_x = snapshot_write(out, index->cell_x, used * sizeof(int));
+    saved->cell_y = snapshot_write(out, index->cell_y, used * sizeof(int));
+    saved->first_x = snapshot_write(out, index->first_x, used * sizeof(int));
+    saved->first_y = snapshot_write(out, index->first_y, used * sizeof(int));
+    saved->entry_handle = snapshot_write(out, index->handle,
+                                         used * sizeof(BlockHandle));
+    saved->next = snapshot_write(out, index->next,
+                                 used * sizeof(unsigned int));
+}
+
+// Write the whole state of the simulation to a snapshot. This should be
+// called between steps.
+int snapshot_save(const char * filename)
+{
+    SnapshotWriter out = { fopen(filename, "wb"), 0, 0 };
+    if (out.file == NULL) {
+        perror(filename);
+        return 0;
+    }
+
+    // The header is written again at the end, once the offsets of
+    // everything else are known.
+    SnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    snapshot_write(&out, &header, sizeof(header));
+
+    WorldState world;
+    world_get_state(&world);
+    header.world = snapshot_write(&out, &world, sizeof(world));
+
+    SnapshotTier * saved = calloc(max_tiers, sizeof(SnapshotTier));
+    assert(saved != 0);
+    int t;
+    for (t = 0; t < tier_count; ++t) {
+        save_tier(&out, &tiers[t], &saved[t]);
+    }
+    header.tiers = snapshot_write(&out, saved,
+                                  tier_count * sizeof(SnapshotTier));
+    free(saved);
+    header.chunks = chunk_stream_save(&out);
+
+    memcpy(header.magic, snapshot_magic, sizeof(header.magic));
+    header.version = SNAPSHOT_VERSION;
+    header.byte_order = snapshot_byte_order;
+    header.header_size = sizeof(SnapshotHeader);
+    header.world_size = sizeof(WorldState);
+    header.tier_size = sizeof(SnapshotTier);
+    header.tier_count = tier_count;
+    header.file_size = out.offset;
+    if (fseek(out.file, 0, SEEK_SET) != 0 ||
+        fwrite(&header, sizeof(header), 1, out.file) != 1) {
+        out.failed = 1;
+    }
+    if (fclose(out.file) != 0 || out.failed) {
+        perror(filename);
+        return 0;
+    }
+    log_info(LOG_TIERS, "Saved snapshot of %d tiers, %llu bytes",
+             tier_count, header.file_size);
+    return 1;
+}
+
+// Find an array in the mapped snapshot, which the stores are allowed to
+// write to. Sets failed if the array is not all in the file.
+static void * map_array(const SnapshotReader * in,
+                        unsigned long long offset, size_t bytes,
+                        int * failed)
+{
+    const void * data = snapshot_read(in, offset, bytes);
+    if (data == 0) {
+        *failed = 1;
+    }
+    return (void *)data;
+}
+
+// Check the handles and slot table of a store loaded from a snapshot.
+// Every block must have a slot of its own which points back at it, with
+// the same generation as its handle, and the rest of the slots must be
+// chained together from free_slot.
+static int check_blocks(const BlockStore * blocks)
+{
+    unsigned char * seen = calloc(blocks->slots + 1, 1);
+    assert(seen != 0);
+    int valid = 1;
+    unsigned int i;
+    for (i = 0; valid && i < blocks->count; ++i) {
+        BlockHandle handle = blocks->handle[i];
+        unsigned int slot = handle & BLOCK_SLOT_MASK;
+        if (handle == BLOCK_HANDLE_NONE || slot >= blocks->slots ||
+            blocks->slot_index[slot] != i ||
+            blocks->slot_generation[slot] != handle >> BLOCK_SLOT_BITS) {
+            valid = 0;
+            break;
+        }
+        seen[slot] = 1;
+    }
+    unsigned int free_count = 0, slot = blocks->free_slot;
+    for (; valid && slot != BLOCK_HANDLE_NONE;
+         slot = blocks->slot_index[slot]) {
+        if (slot >= blocks->slots || seen[slot]) {
+            valid = 0;
+            break;
+        }
+        seen[slot] = 1;
+        ++free_count;
+    }
+    free(seen);
+    return valid && blocks->count + free_count == blocks->slots;
+}
+
+// Check the chains of an index loaded from a snapshot. Every entry in use
+// must be in exactly one chain, either of a bucket or of free entries, and
+// the entries in buckets must be of ground blocks in the store.
+static int check_index(const SpatialHash * index, const BlockStore * blocks)
+{
+    unsigned char * seen = calloc(index->used + 1, 1);
+    assert(seen != 0);
+    int valid = 1;
+    unsigned int live = 0, free_count = 0, b, e;
+    for (b = 0; valid && b < index->bucket_count; ++b) {
+        for (e = index->buckets[b]; e != SPATIAL_NONE; e = index->next[e]) {
+            if (e >= index->used || seen[e]) {
+                valid = 0;
+                break;
+            }
+            seen[e] = 1;
+            int i = block_store_index(blocks, index->handle[e]);
+            if (i < 0 || (unsigned int)i >= blocks->ground) {
+                valid = 0;
+                break;
+            }
+            ++live;
+        }
+    }
+    for (e = index->free_entry; valid && e != SPATIAL_NONE;
+         e = index->next[e]) {
+        if (e >= index->used || seen[e]) {
+            valid = 0;
+            break;
+        }
+        seen[e] = 1;
+        ++free_count;
+    }
+    free(seen);
+    return valid && live == index->entries &&
+           live + free_count == index->used;
+}
+
+// Restore a tier from its entry in a snapshot, pointing its store and
+// index into the mapped file. Each array holds just what is in use, so
+// it is copied out as soon as anything is added. Returns false if the
+// entry does not make sense.
+static int load_tier(const SnapshotReader * in, const SnapshotTier * saved,
+                     Tier * tier)
+{
+    if (saved->state < TIER_ACTIVE || saved->state > TIER_EVICTED ||
+        saved->ground > saved->count || saved->slots > BLOCK_SLOT_MASK + 1 ||
+        (saved->bucket_count & (saved->bucket_count - 1)) != 0) {
+        return 0;
+    }
+    // Only a tier which is frozen or evicted has no index, and then it
+    // has no entries either.
+    if (saved->bucket_count == 0 &&
+        (saved->state == TIER_ACTIVE || saved->state == TIER_DISTANT ||
+         saved->used != 0 || saved->entries != 0)) {
+        return 0;
+    }
+
+    tier_init(tier, saved->factor, saved->min_size, saved->max_size);
+    tier->state = saved->state;
+    tier->trim_size = saved->trim_size;
+
+    BlockStore * blocks = &tier->blocks;
+    const unsigned int count = saved->count;
+    int failed = 0;
+    blocks->x = map_array(in, saved->x, count * sizeof(float), &failed);
+    blocks->y = map_array(in, saved->y, count * sizeof(float), &failed);
+    blocks->z = map_array(in, saved->z, count * sizeof(float), &failed);
+    blocks->scale = map_array(in, saved->scale, count * sizeof(float),
+                              &failed);
+    blocks->present = map_array(in, saved->present, count, &failed);
+    blocks->diffuse = map_array(in, saved->diffuse,
+                                count * sizeof(float[4]), &failed);
+    blocks->orientation = map_array(in, saved->orientation,
+                                    count * sizeof(Quaternion), &failed);
+    blocks->handle = map_array(in, saved->handle,
+                               count * sizeof(BlockHandle), &failed);
+    blocks->slot_index = map_array(in, saved->slot_index,
+                                   saved->slots * sizeof(unsigned int),
+                                   &failed);
+    blocks->slot_generation = map_array(in, saved->slot_generation,
+                                        saved->slots, &failed);
+    blocks->ground = saved->ground;
+    blocks->count = count;
+    blocks->capacity = count;
+    blocks->slots = saved->slots;
+    blocks->slot_capacity = saved->slots;
+    blocks->free_slot = saved->free_slot;
+    blocks->mapped = 1;
+    // Anything keeping its own copy of the blocks must fetch them all.
+    blocks->dirty_count = BLOCK_DIRTY_MAX + 1;
+
+    // A tier which is frozen or evicted has no index.
+    SpatialHash * index = &tier->index;
+    const unsigned int used = saved->used;
+    spatial_hash_clear(index);
+    index->cell_size = saved->cell_size;
+    index->buckets = map_array(in, saved->buckets,
+                               saved->bucket_count * sizeof(unsigned int),
+                               &failed);
+    index->bucket_count = saved->bucket_count;
+    index->cell_x = map_array(in, saved->cell_x, used * sizeof(int),
+                              &failed);
+    index->cell_y = map_array(in, saved->cell_y, used * sizeof(int),
+                              &failed);
+    index->first_x = map_array(in, saved->first_x, used * sizeof(int),
+                               &failed);
+    index->first_y = map_array(in, saved->first_y, used * sizeof(int),
+                               &failed);
+    index->handle = map_array(in, saved->entry_handle,
+                              used * sizeof(BlockHandle), &failed);
+    index->next = map_array(in, saved->next, used * sizeof(unsigned int),
+                            &failed);
+    index->entries = saved->entries;
+    index->capacity = used;
+    index->used = used;
+    index->free_entry = saved->free_entry;
+    index->min_x = saved->min_x;
+    index->min_y = saved->min_y;
+    index->max_x = saved->max_x;
+    index->max_y = saved->max_y;
+    index->mapped = 1;
+    return !failed && check_blocks(blocks) &&
+           (saved->bucket_count == 0 || check_index(index, blocks));
+}
+
+// Check the header of a snapshot, and restore the state of the calamari
+// and every tier from it.
+static int load_state(const SnapshotReader * in, const char * filename)
+{
+    const SnapshotHeader * header = snapshot_read(in, 0,
+                                                  sizeof(SnapshotHeader));
+    if (header == 0 ||
+        memcmp(header->magic, snapshot_magic, sizeof(header->magic)) != 0) {
+        fprintf(stderr, "%s: Not a snapshot\n", filename);
+        return 0;
+    }
+    if (header->version != SNAPSHOT_VERSION) {
+        fprintf(stderr, "%s: Snapshot is version %u, not %u\n",
+                filename, header->version, SNAPSHOT_VERSION);
+        return 0;
+    }
+    if (header->byte_order != snapshot_byte_order ||
+        header->header_size != sizeof(SnapshotHeader) ||
+        header->world_size != sizeof(WorldState) ||
+        header->tier_size != sizeof(SnapshotTier)) {
+        fprintf(stderr, "%s: Snapshot was written by a different kind of "
+                        "machine\n", filename);
+        return 0;
+    }
+    const WorldState * world = snapshot_read(in, header->world,
+                                             sizeof(WorldState));
+    const SnapshotTier * saved = snapshot_read(in, header->tiers,
+                                               header->tier_count *
+                                               sizeof(SnapshotTier));
+    if (header->file_size != in->size || header->tier_count > max_tiers ||
+        world == 0 || saved == 0) {
+        fprintf(stderr, "%s: Snapshot is damaged\n", filename);
+        return 0;
+    }
+
+    world_set_state(world);
+    unsigned int t;
+    for (t = 0; t < header->tier_count; ++t) {
+        ++tier_count;
+        if (!load_tier(in, &saved[t], &tiers[t])) {
+            fprintf(stderr, "%s: Tier %u of snapshot is damaged\n",
+                    filename, t);
+            return 0;
+        }
+    }
+    if (!chunk_stream_load(in, header->chunks)) {
+        fprintf(stderr, "%s: Chunks in snapshot are damaged\n", filename);
+        return 0;
+    }
+    return 1;
+}
+
+// Replace the world with the one in a snapshot. If the snapshot cannot be
+// loaded, the world is left empty, and false is returned.
+int snapshot_load(const char * filename)
+{
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        perror(filename);
+        return 0;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        perror(filename);
+        close(fd);
+        return 0;
+    }
+    SnapshotReader in = { 0, st.st_size };
+    if (in.size < sizeof(SnapshotHeader)) {
+        fprintf(stderr, "%s: Not a snapshot\n", filename);
+        close(fd);
+        return 0;
+    }
+    void * mapped = mmap(NULL, in.size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+                         fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        perror(filename);
+        return 0;
+    }
+    in.data = mapped;
+
+    // Nothing is using the last snapshot once the world is cleared.
+    world_clear();
+    if (mapping != NULL) {
+        munmap(mapping, mapping_size);
+    }
+    mapping = mapped;
+    mapping_size = in.size;
+
+    if (!load_state(&in, filename)) {
+        world_clear();
+        return 0;
+    }
+    log_info(LOG_TIERS, "Loaded snapshot of %d tiers", tier_count);
+    return 1;
+}
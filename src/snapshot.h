@@ -0,0 +1,40 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+// Version of the snapshot layout written by snapshot_save(). Snapshots
+// written by any other version are refused.
+#define SNAPSHOT_VERSION 1
+
+// Arrays in a snapshot start at a multiple of this many bytes, so they are
+// aligned for any use once the file is mapped.
+#define snapshot_alignment 64
+
+// Snapshot being written. Offsets are from the start of the file.
+typedef struct snapshot_writer {
+    FILE * file;
+    unsigned long long offset;
+    int failed;
+} SnapshotWriter;
+
+// Snapshot being loaded, mapped into memory.
+typedef struct snapshot_reader {
+    const unsigned char * data;
+    size_t size;
+} SnapshotReader;
+
+unsigned long long snapshot_write(SnapshotWriter * out, const void * data,
+                                  size_t bytes);
+const void * snapshot_read(const SnapshotReader * in,
+                           unsigned long long offset, size_t bytes);
+
+int snapshot_save(const char * filename);
+int snapshot_load(const char * filename);
+
+#endif // SNAPSHOT_H
@@ -0,0 +1,284 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#include "spatial.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <assert.h>
+
+static const unsigned int initial_buckets = 1024;
+
+static inline unsigned int cell_hash(const SpatialHash * hash, int cx, int cy)
+{
+    return (((unsigned int)cx * 73856093u) ^
+            ((unsigned int)cy * 19349663u)) & (hash->bucket_count - 1);
+}
+
+static inline int cell_coord(const SpatialHash * hash, float f)
+{
+    return (int)floorf(f / hash->cell_size);
+}
+
+static void reset_bounds(SpatialHash * hash)
+{
+    hash->min_x = hash->min_y = INT_MAX;
+    hash->max_x = hash->max_y = INT_MIN;
+}
+
+static void alloc_buckets(SpatialHash * hash, unsigned int count)
+{
+    free(hash->buckets);
+    hash->buckets = malloc(count * sizeof(unsigned int));
+    assert(hash->buckets != 0);
+    memset(hash->buckets, 0xff, count * sizeof(unsigned int));
+    hash->bucket_count = count;
+}
+
+// Return a copy of an array which points into a mapped snapshot.
+static void * copy_array(const void * data, size_t bytes)
+{
+    if (bytes == 0) {
+        return 0;
+    }
+    void * copy = malloc(bytes);
+    assert(copy != 0);
+    memcpy(copy, data, bytes);
+    return copy;
+}
+
+// Make sure the hash owns its buckets and entries, so they can be resized
+// or freed.
+static void own(SpatialHash * hash)
+{
+    if (!hash->mapped) {
+        return;
+    }
+    const unsigned int capacity = hash->capacity;
+    hash->buckets = copy_array(hash->buckets,
+                               hash->bucket_count * sizeof(unsigned int));
+    hash->cell_x = copy_array(hash->cell_x, capacity * sizeof(int));
+    hash->cell_y = copy_array(hash->cell_y, capacity * sizeof(int));
+    hash->first_x = copy_array(hash->first_x, capacity * sizeof(int));
+    hash->first_y = copy_array(hash->first_y, capacity * sizeof(int));
+    hash->handle = copy_array(hash->handle, capacity * sizeof(BlockHandle));
+    hash->next = copy_array(hash->next, capacity * sizeof(unsigned int));
+    hash->mapped = 0;
+}
+
+void spatial_hash_init(SpatialHash * hash, float cell_size)
+{
+    memset(hash, 0, sizeof(SpatialHash));
+    hash->cell_size = cell_size;
+    hash->free_entry = SPATIAL_NONE;
+    reset_bounds(hash);
+    alloc_buckets(hash, initial_buckets);
+}
+
+void spatial_hash_clear(SpatialHash * hash)
+{
+    if (!hash->mapped) {
+        free(hash->buckets);
+        free(hash->cell_x);
+        free(hash->cell_y);
+        free(hash->first_x);
+        free(hash->first_y);
+        free(hash->handle);
+        free(hash->next);
+    }
+    free(hash->results);
+    memset(hash, 0, sizeof(SpatialHash));
+}
+
+// Empty the hash, keeping its allocations, and start again with a new
+// cell size.
+void spatial_hash_reset(SpatialHash * hash, float cell_size)
+{
+    memset(hash->buckets, 0xff, hash->bucket_count * sizeof(unsigned int));
+    hash->cell_size = cell_size;
+    hash->entries = 0;
+    hash->used = 0;
+    hash->free_entry = SPATIAL_NONE;
+    reset_bounds(hash);
+}
+
+static void rehash(SpatialHash * hash, unsigned int bucket_count)
+{
+    own(hash);
+    alloc_buckets(hash, bucket_count);
+
+    // Free entries are chained through next as well, so mark the live ones
+    // first by walking the free list.
+    unsigned int e;
+    for (e = hash->free_entry; e != SPATIAL_NONE; e = hash->next[e]) {
+        hash->handle[e] = BLOCK_HANDLE_NONE;
+    }
+    for (e = 0; e < hash->used; ++e) {
+        if (hash->handle[e] == BLOCK_HANDLE_NONE) {
+            continue;
+        }
+        unsigned int b = cell_hash(hash, hash->cell_x[e], hash->cell_y[e]);
+        hash->next[e] = hash->buckets[b];
+        hash->buckets[b] = e;
+    }
+    // Rebuild the free list, which was destroyed above.
+    hash->free_entry = SPATIAL_NONE;
+    for (e = 0; e < hash->used; ++e) {
+        if (hash->handle[e] == BLOCK_HANDLE_NONE) {
+            hash->next[e] = hash->free_entry;
+            hash->free_entry = e;
+        }
+    }
+}
+
+static unsigned int alloc_entry(SpatialHash * hash)
+{
+    unsigned int e = hash->free_entry;
+    if (e != SPATIAL_NONE) {
+        hash->free_entry = hash->next[e];
+        return e;
+    }
+    if (hash->used == hash->capacity) {
+        own(hash);
+        unsigned int capacity = hash->capacity ? hash->capacity * 2
+                                               : initial_buckets;
+        hash->cell_x = realloc(hash->cell_x, capacity * sizeof(int));
+        hash->cell_y = realloc(hash->cell_y, capacity * sizeof(int));
+        hash->first_x = realloc(hash->first_x, capacity * sizeof(int));
+        hash->first_y = realloc(hash->first_y, capacity * sizeof(int));
+        hash->handle = realloc(hash->handle, capacity * sizeof(BlockHandle));
+        hash->next = realloc(hash->next, capacity * sizeof(unsigned int));
+        assert(hash->cell_x != 0 && hash->cell_y != 0 &&
+               hash->first_x != 0 && hash->first_y != 0 &&
+               hash->handle != 0 && hash->next != 0);
+        hash->capacity = capacity;
+    }
+    return hash->used++;
+}
+
+void spatial_hash_insert(SpatialHash * hash, BlockHandle handle,
+                         float x, float y, float size)
+{
+    int x0 = cell_coord(hash, x), x1 = cell_coord(hash, x + size);
+    int y0 = cell_coord(hash, y), y1 = cell_coord(hash, y + size);
+    int cx, cy;
+
+    hash->min_x = x0 < hash->min_x ? x0 : hash->min_x;
+    hash->min_y = y0 < hash->min_y ? y0 : hash->min_y;
+    hash->max_x = x0 > hash->max_x ? x0 : hash->max_x;
+    hash->max_y = y0 > hash->max_y ? y0 : hash->max_y;
+
+    for (cx = x0; cx <= x1; ++cx) {
+        for (cy = y0; cy <= y1; ++cy) {
+            unsigned int e = alloc_entry(hash);
+            unsigned int b = cell_hash(hash, cx, cy);
+            hash->cell_x[e] = cx;
+            hash->cell_y[e] = cy;
+            hash->first_x[e] = x0;
+            hash->first_y[e] = y0;
+            hash->handle[e] = handle;
+            hash->next[e] = hash->buckets[b];
+            hash->buckets[b] = e;
+            ++hash->entries;
+        }
+    }
+
+    if (hash->entries > hash->bucket_count * 2) {
+        rehash(hash, hash->bucket_count * 2);
+    }
+}
+
+void spatial_hash_remove(SpatialHash * hash, BlockHandle handle,
+                         float x, float y, float size)
+{
+    int x0 = cell_coord(hash, x), x1 = cell_coord(hash, x + size);
+    int y0 = cell_coord(hash, y), y1 = cell_coord(hash, y + size);
+    int cx, cy;
+
+    for (cx = x0; cx <= x1; ++cx) {
+        for (cy = y0; cy <= y1; ++cy) {
+            unsigned int * p = &hash->buckets[cell_hash(hash, cx, cy)];
+            for (; *p != SPATIAL_NONE; p = &hash->next[*p]) {
+                unsigned int e = *p;
+                if (hash->handle[e] == handle &&
+                    hash->cell_x[e] == cx && hash->cell_y[e] == cy) {
+                    *p = hash->next[e];
+                    hash->next[e] = hash->free_entry;
+                    hash->free_entry = e;
+                    --hash->entries;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+size_t spatial_hash_bytes(const SpatialHash * hash)
+{
+    return hash->bucket_count * sizeof(unsigned int) +
+           hash->capacity * (4 * sizeof(int) + sizeof(BlockHandle) +
+                             sizeof(unsigned int)) +
+           hash->result_capacity * sizeof(BlockHandle);
+}
+
+static inline void add_result(SpatialHash * hash, BlockHandle handle)
+{
+    if (hash->result_count == hash->result_capacity) {
+        hash->result_capacity = hash->result_capacity ?
+                                hash->result_capacity * 2 : 64;
+        hash->results = realloc(hash->results,
+                                hash->result_capacity * sizeof(BlockHandle));
+        assert(hash->results != 0);
+    }
+    hash->results[hash->result_count++] = handle;
+}
+
+// Find every block whose footprint may overlap the given rectangle. The
+// handles found are left in hash->results, and the number found returned.
+unsigned int spatial_hash_query(SpatialHash * hash,
+                                float min_x, float min_y,
+                                float max_x, float max_y)
+{
+    int x0 = cell_coord(hash, min_x), x1 = cell_coord(hash, max_x);
+    int y0 = cell_coord(hash, min_y), y1 = cell_coord(hash, max_y);
+    int cx, cy;
+
+    hash->result_count = 0;
+    for (cx = x0; cx <= x1; ++cx) {
+        for (cy = y0; cy <= y1; ++cy) {
+            unsigned int e = hash->buckets[cell_hash(hash, cx, cy)];
+            for (; e != SPATIAL_NONE; e = hash->next[e]) {
+                if (hash->cell_x[e] != cx || hash->cell_y[e] != cy) {
+                    continue;
+                }
+                // A block covering several of the cells visited is only
+                // reported from the first of them.
+                if (cx != (hash->first_x[e] > x0 ? hash->first_x[e] : x0) ||
+                    cy != (hash->first_y[e] > y0 ? hash->first_y[e] : y0)) {
+                    continue;
+                }
+                add_result(hash, hash->handle[e]);
+            }
+        }
+    }
+    return hash->result_count;
+}
+
+// Find every block whose footprint starts in the given cell. Visiting a
+// set of cells this way reports each block at most once. The handles found
+// are left in hash->results, and the number found returned.
+unsigned int spatial_hash_query_cell(SpatialHash * hash, int cx, int cy)
+{
+    hash->result_count = 0;
+    unsigned int e = hash->buckets[cell_hash(hash, cx, cy)];
+    for (; e != SPATIAL_NONE; e = hash->next[e]) {
+        if (hash->first_x[e] == cx && hash->first_y[e] == cy &&
+            hash->cell_x[e] == cx && hash->cell_y[e] == cy) {
+            add_result(hash, hash->handle[e]);
+        }
+    }
+    return hash->result_count;
+}
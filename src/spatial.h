@@ -0,0 +1,70 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#ifndef SPATIAL_H
+#define SPATIAL_H
+
+#include "blocks.h"
+
+// Ends a chain of entries.
+#define SPATIAL_NONE 0xffffffffu
+
+// Uniform grid over the ground plane, hashed into a fixed number of
+// buckets. Each block is entered into every cell its footprint covers, so
+// a query only needs to visit the cells covering the area of interest.
+typedef struct spatial_hash {
+    float cell_size;
+
+    // Head entry of each bucket. bucket_count is always a power of two.
+    // Entries in the same bucket, and entries which are free, are chained
+    // together through next.
+    unsigned int * buckets;
+    unsigned int bucket_count;
+
+    // Entry pool. Each entry records the cell it is in, and the first cell
+    // covered by its block, which is used to report each block only once.
+    int * cell_x;
+    int * cell_y;
+    int * first_x;
+    int * first_y;
+    BlockHandle * handle;
+    unsigned int * next;
+    unsigned int entries;
+    unsigned int capacity;
+    unsigned int used;
+    unsigned int free_entry;
+
+    // Range of cells containing the first cell of any block inserted
+    // since the hash was last reset. Blocks removed are not accounted
+    // for, so this may be larger than required.
+    int min_x;
+    int min_y;
+    int max_x;
+    int max_y;
+
+    // Results of the last query.
+    BlockHandle * results;
+    unsigned int result_count;
+    unsigned int result_capacity;
+
+    // True if the buckets and entries point into a snapshot mapped into
+    // memory. They are copied into memory of the hash's own before they
+    // are resized or freed.
+    int mapped;
+} SpatialHash;
+
+void spatial_hash_init(SpatialHash * hash, float cell_size);
+void spatial_hash_clear(SpatialHash * hash);
+void spatial_hash_reset(SpatialHash * hash, float cell_size);
+void spatial_hash_insert(SpatialHash * hash, BlockHandle handle,
+                         float x, float y, float size);
+void spatial_hash_remove(SpatialHash * hash, BlockHandle handle,
+                         float x, float y, float size);
+size_t spatial_hash_bytes(const SpatialHash * hash);
+unsigned int spatial_hash_query(SpatialHash * hash,
+                                float min_x, float min_y,
+                                float max_x, float max_y);
+unsigned int spatial_hash_query_cell(SpatialHash * hash, int cx, int cy);
+
+#endif // SPATIAL_H
@@ -0,0 +1,202 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+// Text drawn over the scene. Each line is laid out into glyph quads when
+// it changes, and the quads of every line are copied into one streaming
+// buffer, so all the text in a frame is drawn with a single call. If no
+// line has changed since the last frame, the buffer is drawn again as it
+// is. The font is only unpacked and loaded the first time text is drawn.
+
+#include "text.h"
+
+#include "extensions.h"
+#include "font.h"
+#include "glstate.h"
+#include "logger.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+// Size of a glyph on screen in pixels, and the distance from the start of
+// one glyph to the next.
+static const float glyph_size = 16.f;
+static const float glyph_advance = 10.f;
+
+// The font texture is a 16 by 16 grid of glyphs, starting at the space.
+static const int glyph_first = 32;
+static const int glyph_last = 127;
+static const float glyph_cell = 1.f / 16.f;
+
+// Texture holding the font, which is loaded by load_font(). If loading
+// it fails, no text is drawn.
+static GLuint font_texture = 0;
+static int font_failed = 0;
+
+// Quads of every line drawn last, with the buffer they were uploaded to if
+// buffer objects are available.
+static int use_buffers = 0;
+static GLuint stream_buffer = 0;
+static float * stream = 0;
+static unsigned int stream_capacity = 0;
+static GLsizei stream_vertices = 0;
+
+// The lines the stream was last filled from.
+static const TextLine * stream_lines = 0;
+static unsigned int stream_line_count = 0;
+
+// Set up for drawing text. If buffers is true, buffer objects are
+// available and text is streamed through one.
+void text_init(int buffers)
+{
+    use_buffers = buffers;
+    if (use_buffers) {
+        glGenBuffers(1, &stream_buffer);
+    }
+}
+
+// Unpack the font and load it into a texture. The font is only given the
+// 4 bits of alpha per pixel it is stored with.
+static int load_font()
+{
+    unsigned char * pixels = malloc(font_width * font_height);
+    assert(pixels != 0);
+    font_unpack(pixels);
+
+    // Clear any error left by drawing earlier in the frame, so only an
+    // error loading the texture is caught below.
+    while (glGetError() != GL_NO_ERROR) {
+    }
+    glGenTextures(1, &font_texture);
+    glstate_bind_texture(font_texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA4, font_width, font_height, 0,
+                 GL_ALPHA, GL_UNSIGNED_BYTE, pixels);
+    free(pixels);
+    if (glGetError() != 0) {
+        log_error(LOG_GRAPHICS, "Unable to load the font texture");
+        return 0;
+    }
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    return 1;
+}
+
+static inline float * put_vertex(float * v, float x, float y,
+                                 float s, float t)
+{
+    v[0] = x; v[1] = y; v[2] = s; v[3] = t;
+    return v + TEXT_VERTEX_FLOATS;
+}
+
+// Set the text of a line and the position of its bottom left corner in
+// pixels. The line is only laid out again if either has changed. Strings
+// longer than a line can hold are cut short, and characters the font
+// does not have are skipped.
+void text_line_set(TextLine * line, float x, float y, const char * str)
+{
+    if (line->x == x && line->y == y &&
+        strncmp(line->str, str, text_line_length) == 0) {
+        return;
+    }
+    line->x = x;
+    line->y = y;
+    strncpy(line->str, str, text_line_length);
+    line->str[text_line_length] = 0;
+
+    float * v = line->vertices;
+    unsigned int glyphs = 0;
+    const char * c;
+    for (c = line->str; *c != 0; ++c) {
+        int g = (unsigned char)*c;
+        if (g < glyph_first || g > glyph_last) {
+            continue;
+        }
+        g -= glyph_first;
+        float s = (g % 16) * glyph_cell;
+        float t = 1.f - (g / 16) * glyph_cell;
+        v = put_vertex(v, x, y, s, t - glyph_cell);
+        v = put_vertex(v, x + glyph_size, y, s + glyph_cell, t - glyph_cell);
+        v = put_vertex(v, x + glyph_size, y + glyph_size, s + glyph_cell, t);
+        v = put_vertex(v, x, y + glyph_size, s, t);
+        x += glyph_advance;
+        ++glyphs;
+    }
+    line->glyphs = glyphs;
+    line->changed = 1;
+}
+
+// Copy the quads of every line into the stream, and upload it.
+static void fill_stream(TextLine * lines, unsigned int count)
+{
+    unsigned int i, vertices = 0;
+    for (i = 0; i < count; ++i) {
+        vertices += lines[i].glyphs * 4;
+    }
+    if (vertices > stream_capacity) {
+        free(stream);
+        stream = malloc(vertices * TEXT_VERTEX_FLOATS * sizeof(float));
+        assert(stream != 0);
+        stream_capacity = vertices;
+    }
+
+    float * v = stream;
+    for (i = 0; i < count; ++i) {
+        size_t floats = lines[i].glyphs * 4 * TEXT_VERTEX_FLOATS;
+        memcpy(v, lines[i].vertices, floats * sizeof(float));
+        v += floats;
+        lines[i].changed = 0;
+    }
+    stream_vertices = vertices;
+    stream_lines = lines;
+    stream_line_count = count;
+
+    if (use_buffers) {
+        // Giving the whole buffer new storage each time lets the driver
+        // keep drawing from the old contents while the new are copied.
+        glstate_bind_array_buffer(stream_buffer);
+        glBufferData(GL_ARRAY_BUFFER,
+                     vertices * TEXT_VERTEX_FLOATS * sizeof(float),
+                     stream, GL_STREAM_DRAW);
+    }
+}
+
+// Draw a set of lines in pixel coordinates, with one call. The same array
+// of lines should be passed each frame, so the quads uploaded last time
+// can be reused if none of them has changed. Texturing and blending are
+// left enabled.
+void text_draw(TextLine * lines, unsigned int count)
+{
+    int changed = lines != stream_lines || count != stream_line_count;
+    unsigned int i;
+    for (i = 0; i < count && !changed; ++i) {
+        changed = lines[i].changed;
+    }
+    if (changed) {
+        fill_stream(lines, count);
+    }
+    if (stream_vertices == 0 || font_failed) {
+        return;
+    }
+    if (font_texture == 0 && !load_font()) {
+        font_failed = 1;
+        return;
+    }
+
+    const GLsizei stride = TEXT_VERTEX_FLOATS * sizeof(float);
+    const float * base = use_buffers ? 0 : stream;
+
+    glstate_blend_func(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glstate_bind_texture(font_texture);
+    glstate_enable(GL_TEXTURE_2D);
+    glstate_enable(GL_BLEND);
+
+    glstate_bind_array_buffer(stream_buffer);
+    glstate_disable_client(GL_NORMAL_ARRAY);
+    glstate_disable_client(GL_COLOR_ARRAY);
+    glstate_enable_client(GL_TEXTURE_COORD_ARRAY);
+    glstate_vertex_pointer(2, GL_FLOAT, stride, base);
+    glstate_tex_coord_pointer(2, GL_FLOAT, stride, base + 2);
+    glDrawArrays(GL_QUADS, 0, stream_vertices);
+    glstate_disable_client(GL_TEXTURE_COORD_ARRAY);
+}
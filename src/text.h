@@ -0,0 +1,33 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#ifndef TEXT_H
+#define TEXT_H
+
+#include <SDL_opengl.h>
+
+// Longest string a line of text can hold.
+#define text_line_length 64
+
+// Number of floats in each vertex of laid out text, the position on the
+// screen in pixels followed by the texture coordinate.
+#define TEXT_VERTEX_FLOATS 4
+
+// A string laid out as one quad per glyph, at a position on the screen.
+// Lines are kept from one frame to the next, and are only laid out again
+// when their text or position changes.
+typedef struct text_line {
+    float x;
+    float y;
+    char str[text_line_length + 1];
+    unsigned int glyphs;
+    float vertices[text_line_length * 4 * TEXT_VERTEX_FLOATS];
+    int changed;
+} TextLine;
+
+void text_init(int buffers);
+void text_line_set(TextLine * line, float x, float y, const char * str);
+void text_draw(TextLine * lines, unsigned int count);
+
+#endif // TEXT_H
@@ -0,0 +1,78 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#include "tier.h"
+
+#include <math.h>
+
+void tier_init(Tier * tier, float factor, float min_size, float max_size)
+{
+    tier->factor = factor;
+    tier->min_size = min_size;
+    tier->max_size = max_size;
+    tier->state = TIER_ACTIVE;
+    tier->trim_size = 0.f;
+    block_store_init(&tier->blocks);
+    spatial_hash_init(&tier->index, tier_cell_size(tier, 0.f));
+}
+
+// Free all the storage used by a tier, and return the number of bytes
+// reclaimed.
+size_t tier_evict(Tier * tier)
+{
+    size_t reclaimed = block_store_bytes(&tier->blocks) +
+                       spatial_hash_bytes(&tier->index);
+    block_store_clear(&tier->blocks);
+    spatial_hash_clear(&tier->index);
+    tier->state = TIER_EVICTED;
+    return reclaimed;
+}
+
+// Return the cell size the index of this tier should use for a calamari
+// of the given size. This is the smallest power of two that holds the
+// ball, so a collision query only visits a handful of cells, but never
+// so small that the largest block in the tier covers more than a few
+// cells across. For a tier far above the calamari the second term always
+// wins, so the tier never needs to be indexed again as the ball grows.
+float tier_cell_size(const Tier * tier, float ball_size)
+{
+    return exp2f(ceilf(log2f(fmaxf(2.f * ball_size, tier->max_size / 8.f))));
+}
+
+void tier_reindex(Tier * tier, float cell_size)
+{
+    BlockStore * blocks = &tier->blocks;
+
+    spatial_hash_reset(&tier->index, cell_size);
+    unsigned int i;
+    for (i = 0; i < blocks->ground; ++i) {
+        spatial_hash_insert(&tier->index, blocks->handle[i],
+                            blocks->x[i], blocks->y[i], blocks->scale[i]);
+    }
+}
+
+// Take a ground block out of the index, and move it to the attached range
+// of the store, returning its new index.
+unsigned int tier_attach_block(Tier * tier, unsigned int index)
+{
+    BlockStore * blocks = &tier->blocks;
+
+    spatial_hash_remove(&tier->index, blocks->handle[index],
+                        blocks->x[index], blocks->y[index],
+                        blocks->scale[index]);
+    return block_store_attach(blocks, index);
+}
+
+void tier_remove_block(Tier * tier, unsigned int index)
+{
+    BlockStore * blocks = &tier->blocks;
+
+    // A frozen tier no longer has an index.
+    if (index < blocks->ground && tier->state != TIER_FROZEN) {
+        spatial_hash_remove(&tier->index, blocks->handle[index],
+                            blocks->x[index], blocks->y[index],
+                            blocks->scale[index]);
+    }
+    block_store_remove(blocks, index);
+}
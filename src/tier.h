@@ -0,0 +1,52 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#ifndef TIER_H
+#define TIER_H
+
+#include "blocks.h"
+#include "spatial.h"
+
+// Where a tier is in its lifecycle, relative to the size of the calamari.
+typedef enum tier_state {
+    // Blocks are around the size of the calamari, and can be picked up.
+    TIER_ACTIVE,
+    // Every block is much bigger than the calamari. The blocks still need
+    // to be drawn and bounced off, but the tier is indexed at its own
+    // coarse cell size, and is never scanned by trim().
+    TIER_DISTANT,
+    // Every block is too small to matter. The tier is skipped by collision
+    // and rendering, but is kept until it is evicted.
+    TIER_FROZEN,
+    // The tier has been freed.
+    TIER_EVICTED
+} TierState;
+
+// All the blocks created by one call to level(), which covers one decade
+// of block sizes.
+typedef struct tier {
+    float factor;
+    float min_size;
+    float max_size;
+    TierState state;
+    // Size below which every block has already been removed by trim().
+    float trim_size;
+    BlockStore blocks;
+    SpatialHash index;
+} Tier;
+
+// Return true if the blocks in a tier are collided with and drawn.
+static inline int tier_live(const Tier * tier)
+{
+    return tier->state == TIER_ACTIVE || tier->state == TIER_DISTANT;
+}
+
+void tier_init(Tier * tier, float factor, float min_size, float max_size);
+size_t tier_evict(Tier * tier);
+float tier_cell_size(const Tier * tier, float ball_size);
+void tier_reindex(Tier * tier, float cell_size);
+unsigned int tier_attach_block(Tier * tier, unsigned int index);
+void tier_remove_block(Tier * tier, unsigned int index);
+
+#endif // TIER_H
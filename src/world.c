@@ -0,0 +1,860 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2000,2004 Alistair Riddoch
+
+#ifndef M_PI
+#define M_PI 3.14159265f
+#endif
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include "world.h"
+
+#include "vector.h"
+#include "profile.h"
+#include "chunk.h"
+#include "collide.h"
+#include "jobs.h"
+#include "logger.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <assert.h>
+
+// A tier is frozen once its largest block is this fraction of the size of
+// the calamari, and evicted once its largest block is below the size
+// trim() would remove.
+static const float freeze_ratio = 0.05f;
+static const float evict_ratio = 0.01f;
+
+// A tier is distant while its smallest block is this many times the size
+// of the calamari.
+static const float distant_ratio = 2.f;
+
+// Maximum number of blocks trim() examines each frame, and how much the
+// trim size must grow before a tier is swept again.
+static const unsigned int trim_budget = 4096;
+static const float trim_growth = 1.1f;
+
+// Every block in the world, on the ground or attached to the calamari,
+// grouped by the call to level() that created it.
+Tier tiers[max_tiers];
+int tier_count = 0;
+
+// Progress of trim() through the tiers, and the number of bytes reclaimed
+// so far in this sweep.
+static int trim_tier = 0;
+static unsigned int trim_index = 0;
+static size_t trim_reclaimed = 0;
+
+// Variables that store the game state
+
+float scale = 0.1f;
+static int next_level = 1;
+
+float pos_x = 0;
+float pos_y = -2;
+float pos_z = 0;
+
+float angle = 0;
+
+Quaternion orientation = { {0, 0, 0}, 1 };
+
+static float velocity[3] = { 0, 0, 0 };
+static float ang_vel = 0;
+
+// True while the flip control is held, so holding it only flips once.
+static bool flipped = false;
+
+Controls controls = { false, false, false, false, false };
+
+AttachHook attach_hook = 0;
+
+unsigned long blocks_tested = 0;
+
+unsigned long long world_seed = 1;
+
+// Blocks near the calamari, gathered up by collide() to be tested.
+static CollideBatch batch;
+
+// Candidates are tested across the job pool in tasks of collide_grain,
+// when there are at least parallel_min_candidates of them in all. Fewer
+// than that are quicker to test on one thread.
+static const unsigned int collide_grain = 256;
+static const unsigned int parallel_min_candidates = 1024;
+
+// A range of the candidates of one tier tested by one task, and the hits
+// it found.
+typedef struct collide_task {
+    int tier;
+    unsigned int first;
+    unsigned int count;
+    CollideBatch batch;
+} CollideTask;
+
+static CollideTask * collide_tasks = 0;
+static unsigned int collide_task_capacity = 0;
+
+// A block found touching the calamari, copied out of the batch it was
+// tested in, so that the hits from the tasks of a tier can be responded to
+// together in the order of the blocks in the store.
+typedef struct collide_hit {
+    unsigned int index;
+    float x;
+    float y;
+    float size;
+    unsigned char flags;
+} CollideHit;
+
+static CollideHit * collide_hits = 0;
+static unsigned int collide_hit_count = 0;
+static unsigned int collide_hit_capacity = 0;
+
+static const float max_velocity = 3.f;
+static const float max_accel = 1.f;
+static const float max_decel = 3.f;
+
+static inline float square(float f)
+{
+    return f * f;
+}
+
+static inline float cube(float f)
+{
+    return f * f * f;
+}
+
+// Work out where a tier should be in its lifecycle for the current size of
+// the calamari.
+static TierState tier_state(const Tier * tier)
+{
+    if (tier->max_size < scale * evict_ratio) {
+        return TIER_EVICTED;
+    }
+    if (tier->max_size < scale * freeze_ratio) {
+        return TIER_FROZEN;
+    }
+    if (tier->min_size > scale * distant_ratio) {
+        return TIER_DISTANT;
+    }
+    return TIER_ACTIVE;
+}
+
+// Move tiers through their lifecycle as the calamari grows, and rebuild
+// the index of any tier the calamari has outgrown.
+static void update_tiers()
+{
+    int t;
+    for (t = 0; t < tier_count; ++t) {
+        Tier * tier = &tiers[t];
+        if (tier->state == TIER_EVICTED) {
+            continue;
+        }
+        TierState state = tier_state(tier);
+        if (state == TIER_EVICTED) {
+            chunk_stream_forget(t);
+            size_t reclaimed = tier_evict(tier);
+            log_info(LOG_TIERS, "Evicting tier %f, reclaimed %lu bytes",
+                     tier->factor, (unsigned long)reclaimed);
+            continue;
+        }
+        if (state == TIER_FROZEN) {
+            if (tier->state != TIER_FROZEN) {
+                // Nothing will query the index again.
+                log_info(LOG_TIERS, "Freezing tier %f", tier->factor);
+                chunk_stream_forget(t);
+                spatial_hash_clear(&tier->index);
+                tier->state = TIER_FROZEN;
+            }
+            continue;
+        }
+        tier->state = state;
+        float cell_size = tier_cell_size(tier, scale);
+        if (cell_size != tier->index.cell_size) {
+            tier_reindex(tier, cell_size);
+        }
+    }
+}
+
+// Add a tier of blocks ten times the size of the last. The tier starts
+// empty, and its blocks are streamed in around the calamari a chunk at a
+// time by chunk_stream_update().
+void level(float factor)
+{
+    assert(tier_count < max_tiers);
+    Tier * tier = &tiers[tier_count++];
+    tier_init(tier, factor, 0.05f * factor, 0.5f * factor);
+    tier->state = tier_state(tier);
+    tier_reindex(tier, tier_cell_size(tier, scale));
+    log_info(LOG_GENERATE, "Created tier %f", factor);
+}
+
+// Remove blocks which are now too small to render, from anywhere in the
+// active and frozen tiers, whether on the ground or attached. This is
+// called every frame, and examines at most trim_budget blocks each time it
+// is called, picking up where it left off, so it never causes a hitch. A
+// tier is only swept again once the size being trimmed has grown
+// noticeably since it was last swept.
+void trim()
+{
+    float min_size = scale / 100.f;
+    unsigned int budget = trim_budget;
+
+    while (budget > 0) {
+        if (trim_tier >= tier_count) {
+            if (trim_reclaimed > 0) {
+                log_info(LOG_TIERS, "Trim reclaimed %lu bytes",
+                         (unsigned long)trim_reclaimed);
+            }
+            trim_tier = 0;
+            trim_index = 0;
+            trim_reclaimed = 0;
+            return;
+        }
+        Tier * tier = &tiers[trim_tier];
+        if ((tier->state != TIER_ACTIVE && tier->state != TIER_FROZEN) ||
+            tier->min_size >= min_size ||
+            min_size < tier->trim_size * trim_growth) {
+            ++trim_tier;
+            trim_index = 0;
+            continue;
+        }
+        BlockStore * blocks = &tier->blocks;
+        while (budget > 0 && trim_index < blocks->count) {
+            --budget;
+            if (blocks->scale[trim_index] < min_size) {
+                log_debug(LOG_TIERS, "Deleting %f",
+                          blocks->scale[trim_index]);
+                // The last block is moved into this index, so look again.
+                tier_remove_block(tier, trim_index);
+            } else {
+                ++trim_index;
+            }
+        }
+        if (trim_index >= blocks->count) {
+            tier->trim_size = min_size;
+            trim_reclaimed += block_store_shrink(blocks);
+            ++trim_tier;
+            trim_index = 0;
+        }
+    }
+}
+
+void setup()
+{
+    quaternion_init(&orientation);
+
+    level(1);
+    level(10);
+    chunk_stream_fill();
+}
+
+// Free every tier, and put the calamari back where it started, so a new
+// world can be set up.
+void world_clear()
+{
+    int t;
+    for (t = 0; t < tier_count; ++t) {
+        tier_evict(&tiers[t]);
+    }
+    tier_count = 0;
+    chunk_stream_reset();
+    trim_tier = 0;
+    trim_index = 0;
+    trim_reclaimed = 0;
+
+    scale = 0.1f;
+    next_level = 1;
+    pos_x = 0;
+    pos_y = -2;
+    pos_z = 0;
+    angle = 0;
+    quaternion_init(&orientation);
+    velocity[0] = velocity[1] = velocity[2] = 0;
+    flipped = false;
+    blocks_tested = 0;
+}
+
+// Take a copy of the state of the calamari, and of the world outside its
+// tiers.
+void world_get_state(WorldState * state)
+{
+    memset(state, 0, sizeof(WorldState));
+    state->seed = world_seed;
+    state->scale = scale;
+    state->next_level = next_level;
+    state->position[0] = pos_x;
+    state->position[1] = pos_y;
+    state->position[2] = pos_z;
+    state->angle = angle;
+    state->orientation = orientation;
+    state->velocity[0] = velocity[0];
+    state->velocity[1] = velocity[1];
+    state->velocity[2] = velocity[2];
+    state->flipped = flipped;
+    state->trim_tier = trim_tier;
+    state->trim_index = trim_index;
+}
+
+// Put the calamari back into a state taken by world_get_state(). The tiers
+// must be restored separately.
+void world_set_state(const WorldState * state)
+{
+    world_seed = state->seed;
+    scale = state->scale;
+    next_level = state->next_level;
+    pos_x = state->position[0];
+    pos_y = state->position[1];
+    pos_z = state->position[2];
+    angle = state->angle;
+    orientation = state->orientation;
+    velocity[0] = state->velocity[0];
+    velocity[1] = state->velocity[1];
+    velocity[2] = state->velocity[2];
+    flipped = state->flipped != 0;
+    trim_tier = state->trim_tier;
+    trim_index = state->trim_index;
+    trim_reclaimed = 0;
+}
+
+// Bounce the calamari off a block bigger than it, and return true if it
+// is climbing the block.
+static bool bounce(float x, float y, float size)
+{
+    bool climbing = false;
+    float bx = x + size / 2.f;
+    float by = y + size / 2.f;
+
+    // printf("TOO BIG!\n");
+    // FIXME collide
+    if ((pos_z + scale / 8) >= size) {
+        // on top
+    } else if (fabsf(pos_x - bx) < fabsf(pos_y - by)) {
+        // bouncing y
+        if (pos_y > by) {
+            if (velocity[1] < 0) {
+                log_debug(LOG_COLLIDE, "Bounce +x");
+                velocity[1] = -velocity[1];
+                if (velocity[1] < 0.2) {
+                    climbing = true;
+                }
+            }
+        } else {
+            if (velocity[1] > 0) {
+                log_debug(LOG_COLLIDE, "Bounce -x");
+                velocity[1] = -velocity[1];
+                if (velocity[1] > -0.2) {
+                    climbing = true;
+                }
+            }
+        }
+    } else {
+        // bouncing x
+        if (pos_x > bx) {
+            if (velocity[0] < 0) {
+                log_debug(LOG_COLLIDE, "Bounce +y");
+                velocity[0] = -velocity[0];
+                if (velocity[0] < 0.2) {
+                    climbing = true;
+                }
+            }
+        } else {
+            if (velocity[0] > 0) {
+                log_debug(LOG_COLLIDE, "Bounce -y");
+                velocity[0] = -velocity[0];
+                if (velocity[0] > -0.2) {
+                    climbing = true;
+                }
+            }
+        }
+    }
+    log_debug(LOG_COLLIDE, "Climbing %d", climbing);
+    return climbing;
+}
+
+// Attach a ground block to the calamari, and grow the calamari by its
+// volume.
+static void pick_up(int t, unsigned int i)
+{
+    Tier * tier = &tiers[t];
+    BlockStore * blocks = &tier->blocks;
+    float x = blocks->x[i];
+    float y = blocks->y[i];
+    float size = blocks->scale[i];
+
+    chunk_stream_picked_up(t, x, y);
+    unsigned int a = tier_attach_block(tier, i);
+    blocks->orientation[a] = orientation;
+    quaternion_invert(&blocks->orientation[a]);
+    blocks->x[a] = x - pos_x;
+    blocks->y[a] = y - pos_y;
+    blocks->z[a] = -(pos_z + scale);
+    if (attach_hook != 0) {
+        attach_hook(t, blocks, a);
+    }
+    // scale === ball_radius
+    log_debug(LOG_COLLIDE, "B %f", scale);
+    scale = powf(cube(scale) + cube(size) / (M_PI * 4.f / 3.f), 1.f/3.f);
+    log_debug(LOG_COLLIDE, "A %f", scale);
+}
+
+// Add the blocks hit in a batch to those to be responded to, leaving out
+// any before from in the store.
+static void add_hits(const CollideBatch * hits, unsigned int from)
+{
+    unsigned int h;
+    for (h = 0; h < hits->hit_count; ++h) {
+        unsigned int c = hits->hits[h];
+        if (hits->index[c] < from) {
+            continue;
+        }
+        if (collide_hit_count == collide_hit_capacity) {
+            collide_hit_capacity = collide_hit_capacity ?
+                                   collide_hit_capacity * 2 : 64;
+            collide_hits = realloc(collide_hits,
+                                   collide_hit_capacity * sizeof(CollideHit));
+            assert(collide_hits != 0);
+        }
+        CollideHit * hit = &collide_hits[collide_hit_count++];
+        hit->index = hits->index[c];
+        hit->x = hits->x[c];
+        hit->y = hits->y[c];
+        hit->size = hits->size[c];
+        hit->flags = hits->flags[h];
+    }
+}
+
+static int compare_hits(const void * a, const void * b)
+{
+    unsigned int i = ((const CollideHit *)a)->index;
+    unsigned int j = ((const CollideHit *)b)->index;
+    return (i > j) - (i < j);
+}
+
+// Run the response to the hits added from a tier, in the order of their
+// blocks in the store, rather than the order of the cells of the index
+// they were found in. Returns true if a block was picked up, in which
+// case the rest of the hits are left, as the calamari has grown, and next
+// is set to the packed index the block was picked up from. The last
+// ground block has been moved into that index, so it is the next one a
+// scan of the store would look at.
+static bool respond(int t, float * support, bool * climbing,
+                    unsigned int * next)
+{
+    unsigned int count = collide_hit_count;
+    collide_hit_count = 0;
+    qsort(collide_hits, count, sizeof(CollideHit), compare_hits);
+
+    unsigned int h;
+    for (h = 0; h < count; ++h) {
+        const CollideHit * hit = &collide_hits[h];
+        unsigned char flags = hit->flags;
+        float size = hit->size;
+        if (flags & COLLIDE_FOOTPRINT) {
+            *support = fmaxf(*support, size);
+            if (pos_z < size) {
+                log_debug(LOG_COLLIDE, "%f, %f", pos_z, size);
+                if (flags & COLLIDE_Y) {
+                    log_debug(LOG_COLLIDE, "COLY");
+                }
+                if (flags & COLLIDE_X) {
+                    log_debug(LOG_COLLIDE, "COLX");
+                }
+            }
+        }
+        if (flags & COLLIDE_SPHERE) {
+            log_debug(LOG_COLLIDE, "COLS");
+        }
+        if (!(flags & (COLLIDE_X | COLLIDE_Y | COLLIDE_SPHERE))) {
+            continue;
+        }
+        if (size > scale) {
+            if (bounce(hit->x, hit->y, size)) {
+                *climbing = true;
+            }
+            continue;
+        }
+        *next = hit->index;
+        pick_up(t, hit->index);
+        return true;
+    }
+    return false;
+}
+
+// Ask the index of a tier for the blocks whose footprint comes within the
+// radius of the calamari, as only those can touch it.
+static unsigned int query_tier(Tier * tier)
+{
+    return spatial_hash_query(&tier->index, pos_x - scale, pos_y - scale,
+                              pos_x + scale, pos_y + scale);
+}
+
+// Test the candidates of a tier, and respond to those hit whose packed
+// index is from or after. Picking up a block makes the calamari bigger,
+// which can bring more blocks within reach and change the result for the
+// blocks after it, so the tier is asked again after each one, and tested
+// again from where the block was. Returns the number of candidates the
+// tier has for the calamari as it ends up.
+static unsigned int collide_tier(int t, unsigned int from,
+                                 unsigned int candidates,
+                                 float * support, bool * climbing)
+{
+    Tier * tier = &tiers[t];
+    while (candidates > 0) {
+        CollideQuery query = { pos_x, pos_y, pos_z, scale };
+        collide_batch_gather(&batch, &tier->blocks, tier->index.results,
+                             candidates);
+        collide_batch_test(&batch, &query);
+        add_hits(&batch, from);
+        if (!respond(t, support, climbing, &from)) {
+            break;
+        }
+        candidates = query_tier(tier);
+    }
+    return candidates;
+}
+
+static void test_task(void * context, unsigned int task)
+{
+    CollideTask * job = &collide_tasks[task];
+    Tier * tier = &tiers[job->tier];
+    collide_batch_gather(&job->batch, &tier->blocks,
+                         tier->index.results + job->first, job->count);
+    collide_batch_test(&job->batch, context);
+}
+
+// Split the candidates of every live tier into tasks, and test them all
+// against the calamari as it is now, on every thread of the job pool.
+static unsigned int test_in_parallel(const unsigned int * candidates,
+                                     const CollideQuery * query)
+{
+    unsigned int count = 0;
+    int t;
+    for (t = 0; t < tier_count; ++t) {
+        unsigned int first;
+        for (first = 0; first < candidates[t]; first += collide_grain) {
+            if (count == collide_task_capacity) {
+                unsigned int capacity = collide_task_capacity ?
+                                        collide_task_capacity * 2 : 16;
+                collide_tasks = realloc(collide_tasks,
+                                        capacity * sizeof(CollideTask));
+                assert(collide_tasks != 0);
+                while (collide_task_capacity < capacity) {
+                    collide_batch_init(
+                        &collide_tasks[collide_task_capacity++].batch);
+                }
+            }
+            CollideTask * task = &collide_tasks[count++];
+            task->tier = t;
+            task->first = first;
+            task->count = candidates[t] - first < collide_grain ?
+                          candidates[t] - first : collide_grain;
+        }
+    }
+
+    // Make sure the kernel has been picked before the workers need it.
+    collide_kernel_name();
+    jobs_run(count, test_task, (void *)query);
+    return count;
+}
+
+// Test the calamari against the ground blocks near it in every live tier,
+// bouncing off blocks bigger than it and picking up the rest. Sets the
+// height of the tallest block under the calamari, and returns true if it
+// is climbing one.
+//
+// When there are enough candidates, they are all tested at once across
+// the job pool, and the responses then run in the same order as testing
+// them one tier at a time would, so the result does not depend on the
+// number of threads. Once a block is picked up the calamari has grown, so
+// the rest of the tests are done again one tier at a time.
+bool collide(float * support)
+{
+    bool climbing = false;
+    *support = 0;
+
+    unsigned int candidates[max_tiers];
+    unsigned int total = 0;
+    const float query_scale = scale;
+    int t;
+    for (t = 0; t < tier_count; ++t) {
+        candidates[t] = tier_live(&tiers[t]) ? query_tier(&tiers[t]) : 0;
+        total += candidates[t];
+    }
+
+    int resume_tier = 0;
+    unsigned int resume_from = 0;
+    if (total >= parallel_min_candidates && jobs_thread_count() > 1) {
+        CollideQuery query = { pos_x, pos_y, pos_z, scale };
+        unsigned int count = test_in_parallel(candidates, &query);
+        unsigned int k = 0;
+        for (resume_tier = 0; resume_tier < tier_count; ++resume_tier) {
+            for (; k < count && collide_tasks[k].tier == resume_tier; ++k) {
+                add_hits(&collide_tasks[k].batch, 0);
+            }
+            if (respond(resume_tier, support, &climbing, &resume_from)) {
+                break;
+            }
+        }
+    }
+
+    for (t = resume_tier; t < tier_count; ++t) {
+        if (!tier_live(&tiers[t])) {
+            continue;
+        }
+        if (scale != query_scale) {
+            // The calamari has grown since this tier was asked.
+            candidates[t] = query_tier(&tiers[t]);
+        }
+        candidates[t] = collide_tier(t, t == resume_tier ? resume_from : 0,
+                                     candidates[t], support, &climbing);
+    }
+
+    for (t = 0; t < tier_count; ++t) {
+        blocks_tested += candidates[t];
+    }
+    return climbing;
+}
+
+void update(float delta)
+{
+    bool vel_changed = false;
+    bool braking = false;
+    float ang_rad = (angle / 180) * M_PI;
+    // Direction camera is facing
+    float forwards[] = { sin(ang_rad),   cos(ang_rad) };
+    float sideways[] = { cos(ang_rad), - sin(ang_rad) };
+    // Speed in the camera direction
+    float speed = vector2_dot(velocity, forwards);
+    float drift = vector2_dot(velocity, sideways);
+    static float support = 0;
+
+    // printf("Velocity (%f,%f), Direction (%f,%f), Speed %f, Forward %f\n",
+           // velocity[0], velocity[1], forwards[0], forwards[1], speed,
+           // vector2_dot(velocity, forwards));
+
+    // Velociy should be a vector, so speed in facing direction can
+    // be determined by the dot product of velocity in the camera direction
+    // and this value used to determine what constraints should be placed on
+    // changes in speed, such as whether accelerating or braking, and maximums.
+    // Once vel is a vector, similar techniques can be used to handle sideways
+    // velocity, then finall deflection can be handled.
+
+    if (controls.left_forward) {
+        if (controls.right_forward) {
+            if (!(controls.left_back || controls.right_back)) {
+                // accelerate forwards
+                if (speed > 0) {
+                    speed += delta * max_accel;
+                } else {
+                    speed += delta * max_decel;
+                    braking = true;
+                }
+                vel_changed = true;
+            }
+        } else {
+            if (controls.left_back) {
+                log_debug(LOG_MOTION, "Roll left");
+                drift = -1;
+            } else {
+                if (controls.right_back) {
+                    // rotate right
+                    angle += delta * 50;
+                } else {
+                    // coast right
+                    angle += delta * 20;
+                    if (speed > 0) {
+                        speed += delta * max_accel / 2;
+                    } else {
+                        speed += delta * max_decel / 2;
+                    }
+                    vel_changed = true;
+                }
+            }
+        }
+    } else {
+        if (controls.right_forward) {
+            if (controls.right_back) {
+                log_debug(LOG_MOTION, "Roll right");
+                drift = 1;
+            } else {
+                if (controls.left_back) {
+                    // rotate left
+                    angle -= delta * 50;
+                } else {
+                    // coast left
+                    angle -= delta * 20;
+                    if (speed > 0) {
+                        speed += delta * max_accel / 2;
+                    } else {
+                        speed += delta * max_decel / 2;
+                    }
+                    vel_changed = true;
+                }
+            }
+        } else {
+            if (controls.left_back) {
+                if (controls.right_back) {
+                    // reverse
+                    if (speed < 0) {
+                        speed -= delta * max_accel;
+                    } else {
+                        speed -= delta * max_decel;
+                        braking = true;
+                    }
+                    vel_changed = true;
+                } else {
+                    // reverse coast left
+                    angle -= delta * 20;
+                    if (speed < 0) {
+                        speed -= delta * max_accel / 2;
+                    } else {
+                        speed -= delta * max_decel / 2;
+                    }
+                    vel_changed = true;
+                }
+            } else if (controls.right_back) {
+                if (!controls.left_back) {
+                    // reverse coast right
+                    angle += delta * 20;
+                    if (speed < 0) {
+                        speed -= delta * max_accel / 2;
+                    } else {
+                        speed -= delta * max_decel / 2;
+                    }
+                    vel_changed = true;
+                }
+            }
+        }
+    }
+    if (controls.flip) {
+        if (!flipped) {
+            angle += 180;
+            speed = -speed;
+            vel_changed = true;
+            flipped = true;
+        }
+    } else {
+        flipped = false;
+    }
+
+    if (vel_changed) {
+        // If the controls have had an effect on velocity, clamp it to
+        // the valid range
+        speed = fmaxf(speed, -max_velocity);
+        speed = fminf(speed, max_velocity);
+    } else {
+        // Otherwise coast gently to a stop
+        if (speed < 0.f) {
+            speed += delta;
+            speed = fminf(speed, 0.f);
+        } else {
+            speed -= delta;
+            speed = fmaxf(speed, 0.f);
+        }
+    }
+    if (drift < 0.f) {
+        drift += delta;
+        drift = fminf(drift, 0.f);
+    } else {
+        drift -= delta;
+        drift = fmaxf(drift, 0.f);
+    }
+
+    float new_ang_rad = (angle / 180) * M_PI;
+
+    velocity[0] = sin(new_ang_rad) * speed + cos(ang_rad) * drift;
+    velocity[1] = cos(new_ang_rad) * speed - sin(ang_rad) * drift;
+
+    // float axis[] = { -1, 0, 0 };
+
+    pos_x += velocity[0] * delta * scale;
+    pos_y += velocity[1] * delta * scale;
+    pos_z += velocity[2] * delta * scale;
+
+    // For a unit sphere, distance rolled is equal to angle rolled in
+    // radians
+    if (!braking) {
+        float mag = hypotf(velocity[0], velocity[1]);
+        if (mag > 0.f) {
+            float axis[3];
+
+            axis[0] =   velocity[1] / mag;
+            axis[1] = - velocity[0] / mag;
+            axis[2] = 0;
+            log_debug(LOG_MOTION, "(%f,%f) %f", axis[0], axis[1], mag);
+            orientation = quaternion_rotate(&orientation, axis, -mag * delta);
+        }
+    }
+
+    // scale *= (1 + (delta * 0.01f));
+    // The ground around the calamari must be there before it is tested.
+    chunk_stream_update();
+    profile_begin(PROFILE_COLLIDE);
+    bool climbing = collide(&support);
+    profile_end(PROFILE_COLLIDE);
+
+    log_debug(LOG_MOTION, "P %f %f", pos_z, support);
+    if (climbing) {
+        if (pos_z < support) {
+            velocity[2] = 1;
+        }
+    } else {
+        if (pos_z > support) {
+            // If we are above solid surface, fall towards it
+            velocity[2] -= 9.8 * delta;
+        } else if (velocity[2] < 0) {
+            // If we are not above, but still falling, bounce
+            velocity[2] = -0.7 * velocity[2];
+        } else {
+            // Otherwise we are below and rising, in which case we must
+            // behave under gravity, but velocity must not go negative
+            velocity[2] -= 9.8 * delta;
+            if (velocity[2] < 0.f) {
+                velocity[2] = 0;
+            }
+        }
+        log_debug(LOG_MOTION, "V %f %f", velocity[2], 9.8 * delta);
+    }
+
+    if (scale > next_level) {
+        level(next_level * 100);
+        next_level *= 10;
+    }
+    update_tiers();
+    trim();
+    // printf("%f %f\n", scale, log10(scale));
+}
+
+// Take a copy of the calamari's current position and orientation.
+void world_view(ViewState * view)
+{
+    view->x = pos_x;
+    view->y = pos_y;
+    view->z = pos_z;
+    view->angle = angle;
+    view->orientation = orientation;
+}
+
+// Blend two views, a fraction t of the way from one to the other. A flip
+// turns the camera half way round in a single step, so a large change in
+// angle is not blended, as that would sweep the camera round instead.
+void view_interpolate(const ViewState * from, const ViewState * to,
+                      float t, ViewState * view)
+{
+    view->x = from->x + (to->x - from->x) * t;
+    view->y = from->y + (to->y - from->y) * t;
+    view->z = from->z + (to->z - from->z) * t;
+    if (fabsf(to->angle - from->angle) < 90.f) {
+        view->angle = from->angle + (to->angle - from->angle) * t;
+    } else {
+        view->angle = to->angle;
+    }
+    view->orientation = quaternion_nlerp(&from->orientation,
+                                         &to->orientation, t);
+}
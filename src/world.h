@@ -0,0 +1,105 @@
+// This file may be redistributed and modified only under the terms of
+// the GNU General Public License (See COPYING for details).
+// Copyright (C) 2006 Alistair Riddoch
+
+#ifndef WORLD_H
+#define WORLD_H
+
+#include "tier.h"
+#include "quaternion.h"
+
+// The world simulation, which knows nothing about the display, so it can be
+// run without a window.
+
+typedef int bool;
+#define false 0
+#define true 1
+
+// Number of squares in the grid. The number of points is this number +1.
+// Each chunk of ground streamed in is also this many times the factor of
+// its tier across.
+#define grid_width 12
+#define grid_height 12
+
+// Maximum number of tiers of blocks. Each tier is ten times the size of
+// the last, so this is far more than a float can cope with.
+#define max_tiers 16
+
+// The controls held down by the player. Each side of the calamari has a
+// forward and back control, in the style of tank controls.
+typedef struct controls {
+    bool left_forward;
+    bool left_back;
+    bool right_forward;
+    bool right_back;
+    bool flip;
+} Controls;
+
+// The part of the calamari's state which moves smoothly, kept from one
+// simulation step to the next so the display can draw the calamari
+// between steps.
+typedef struct view_state {
+    float x;
+    float y;
+    float z;
+    float angle;
+    Quaternion orientation;
+} ViewState;
+
+// The state of the calamari, and of the world outside its tiers, as kept
+// in a snapshot. Only types which are the same size everywhere are used,
+// as snapshots are loaded straight from the file.
+typedef struct world_state {
+    unsigned long long seed;
+    float scale;
+    int next_level;
+    float position[3];
+    float angle;
+    Quaternion orientation;
+    float velocity[3];
+    int flipped;
+    int trim_tier;
+    unsigned int trim_index;
+} WorldState;
+
+// Function called when a block is picked up, with the index it has been
+// moved to in the attached range of its tier's store.
+typedef void (*AttachHook)(int tier, const BlockStore * blocks,
+                           unsigned int index);
+
+// Every block in the world, on the ground or attached to the calamari,
+// grouped by the call to level() that created it.
+extern Tier tiers[max_tiers];
+extern int tier_count;
+
+// Size, position, heading and orientation of the calamari.
+extern float scale;
+extern float pos_x;
+extern float pos_y;
+extern float pos_z;
+extern float angle;
+extern Quaternion orientation;
+
+extern Controls controls;
+extern AttachHook attach_hook;
+
+// Number of blocks tested for collision since the world was set up.
+extern unsigned long blocks_tested;
+
+// Seed every block in the world is generated from. Setting this before
+// setup() makes the same world every time.
+extern unsigned long long world_seed;
+
+void level(float factor);
+void trim();
+void setup();
+void world_clear();
+void world_get_state(WorldState * state);
+void world_set_state(const WorldState * state);
+bool collide(float * support);
+void update(float delta);
+void world_view(ViewState * view);
+void view_interpolate(const ViewState * from, const ViewState * to,
+                      float t, ViewState * view);
+
+#endif // WORLD_H